@@ -0,0 +1 @@
+# Benchmarks for Unreal MCP Server
@@ -0,0 +1,250 @@
+"""
+Scene-generation benchmarks for the Unreal MCP server.
+
+Runs the heavy generators against a running editor with fixed seeds and sizes
+and records, per scenario:
+- wall time of the tool call
+- commands sent and bytes sent/received by the Python client
+- actors created and the level's final actor count
+- editor memory delta (used physical memory, with a GC before both readings)
+
+Results are written as JSON so runs can be compared across plugin versions.
+With --baseline, each scenario's median is compared against a stored result
+file and regressions beyond the tolerances are reported with exit code 1.
+
+Run from the Python directory while the editor is up:
+    python -m benchmarks.run_benchmarks --output results.json
+    python -m benchmarks.run_benchmarks --scenarios town_small,maze_8 --repeat 3 --save-baseline benchmarks/baselines/main.json
+    python -m benchmarks.run_benchmarks --baseline benchmarks/baselines/main.json
+"""
+import argparse
+import asyncio
+import datetime
+import inspect
+import json
+import os
+import platform
+import random
+import statistics
+import sys
+import time
+from typing import Any, Dict, List, Optional, Set
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+import unreal_mcp_server_advanced as server
+from helpers.actor_name_manager import clear_actor_cache
+
+DEFAULT_SEED = 1337
+
+# Scenario name -> (tool, fixed arguments); the seed is added where the tool takes one
+SCENARIOS = {
+    "town_small": ("create_town", {"town_size": "small", "building_density": 0.7, "name_prefix": "BenchTown"}),
+    "castle_small": ("create_castle_fortress", {"castle_size": "small", "name_prefix": "BenchCastle"}),
+    "mansion_small": ("construct_mansion", {"mansion_scale": "small", "name_prefix": "BenchMansion"}),
+    "bridge_3000": ("create_suspension_bridge", {"span_length": 3000.0, "name_prefix": "BenchBridge"}),
+    "maze_8": ("create_maze", {"rows": 8, "cols": 8}),
+}
+
+# Metric -> (relative tolerance, absolute slack) before an increase counts as a regression
+METRIC_TOLERANCES = {
+    "wall_s": (0.15, 0.5),
+    "commands": (0.02, 0),
+    "bytes_sent": (0.05, 0),
+    "bytes_received": (0.10, 0),
+    "memory_delta_mb": (0.25, 32.0),
+}
+
+# Deterministic outputs that should match the baseline exactly
+EXACT_METRICS = ("actors_created",)
+
+DELETE_BATCH_SIZE = 200
+
+
+async def _result(connection, command: str, params: Dict[str, Any] = None) -> Dict[str, Any]:
+    response = await connection.send_command(command, params or {})
+    if response.get("status") != "success":
+        raise RuntimeError(f"{command} failed: {response.get('error')}")
+    return response.get("result", {})
+
+
+async def _actor_names(connection) -> Set[str]:
+    result = await _result(connection, "get_actors_in_level")
+    return {actor["name"] for actor in result.get("actors", [])}
+
+
+async def _delete_actors(connection, names: List[str]):
+    for start in range(0, len(names), DELETE_BATCH_SIZE):
+        batch = names[start:start + DELETE_BATCH_SIZE]
+        await connection.send_commands([("delete_actor", {"name": name}) for name in batch])
+
+
+def _succeeded(response: Optional[Dict[str, Any]]) -> bool:
+    if not response:
+        return False
+    if "success" in response:
+        return bool(response["success"])
+    return response.get("status") == "success"
+
+
+async def run_scenario(name: str, seed: int, keep_actors: bool) -> Dict[str, Any]:
+    """Run one scenario once and return its metrics."""
+    tool_name, arguments = SCENARIOS[name]
+    tool = getattr(server, tool_name)
+    arguments = dict(arguments)
+    if "seed" in inspect.signature(tool).parameters:
+        arguments["seed"] = seed
+
+    connection = server.get_async_connection()
+    stats_before = await _result(connection, "get_editor_stats", {"collect_garbage": True})
+    actors_before = await _actor_names(connection)
+
+    # Generators draw from the shared random module; tools that take a seed use their own generator.
+    # Forgetting earlier runs' names keeps the spawn names, and so the traffic, identical
+    clear_actor_cache()
+    random.seed(seed)
+    connection.reset_stats()
+    start = time.perf_counter()
+    if inspect.iscoroutinefunction(tool):
+        response = await tool(**arguments)
+    else:
+        response = await asyncio.to_thread(tool, **arguments)
+    wall_s = time.perf_counter() - start
+    traffic = dict(connection.stats)
+
+    stats_after = await _result(connection, "get_editor_stats", {"collect_garbage": True})
+    created = sorted((await _actor_names(connection)) - actors_before)
+
+    metrics = {
+        "success": _succeeded(response),
+        "wall_s": round(wall_s, 3),
+        "commands": traffic["commands"],
+        "bytes_sent": traffic["bytes_sent"],
+        "bytes_received": traffic["bytes_received"],
+        "actors_created": len(created),
+        "final_actor_count": stats_after["actor_count"],
+        "memory_delta_mb": round(stats_after["used_physical_mb"] - stats_before["used_physical_mb"], 1),
+        "object_delta": stats_after["object_count"] - stats_before["object_count"],
+    }
+
+    if not keep_actors:
+        await _delete_actors(connection, created)
+    return metrics
+
+
+def summarize(runs: List[Dict[str, Any]]) -> Dict[str, Any]:
+    """Median of each numeric metric over the runs."""
+    summary = {"success": all(run["success"] for run in runs)}
+    for key, value in runs[0].items():
+        if isinstance(value, (int, float)) and not isinstance(value, bool):
+            summary[key] = statistics.median(run[key] for run in runs)
+    return summary
+
+
+def compare(results: Dict[str, Any], baseline: Dict[str, Any], tolerance_scale: float) -> List[str]:
+    """Describe every metric that regressed against the baseline."""
+    regressions = []
+    for name, scenario in results["scenarios"].items():
+        base = baseline.get("scenarios", {}).get(name)
+        if not base:
+            continue
+        current, previous = scenario["median"], base["median"]
+
+        if previous.get("success") and not current.get("success"):
+            regressions.append(f"{name}: generator failed (succeeded in baseline)")
+
+        for metric, (relative, slack) in METRIC_TOLERANCES.items():
+            if metric not in current or metric not in previous:
+                continue
+            limit = previous[metric] * (1 + relative * tolerance_scale) + slack
+            if current[metric] > limit:
+                change = (current[metric] / previous[metric] - 1) * 100 if previous[metric] else float("inf")
+                regressions.append(f"{name}: {metric} {previous[metric]} -> {current[metric]} (+{change:.0f}%)")
+
+        for metric in EXACT_METRICS:
+            if metric in current and metric in previous and current[metric] != previous[metric]:
+                regressions.append(f"{name}: {metric} changed {previous[metric]} -> {current[metric]}")
+    return regressions
+
+
+async def run(args) -> int:
+    names = args.scenarios.split(",") if args.scenarios else list(SCENARIOS)
+    unknown = [name for name in names if name not in SCENARIOS]
+    if unknown:
+        print(f"Unknown scenarios: {', '.join(unknown)} (available: {', '.join(SCENARIOS)})", file=sys.stderr)
+        return 2
+
+    # The server's lifespan sets up the pooled client the tools use
+    async with server.server_lifespan(server.mcp):
+        connection = server.get_async_connection()
+        ping = await connection.send_command("ping")
+        if ping.get("status") != "success":
+            print(f"Unreal editor not reachable: {ping.get('error')}", file=sys.stderr)
+            return 2
+        editor = await _result(connection, "get_editor_stats")
+
+        results = {
+            "meta": {
+                "timestamp": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+                "seed": args.seed,
+                "repeat": args.repeat,
+                "engine_version": editor.get("engine_version"),
+                "plugin_version": editor.get("plugin_version"),
+                "encoding": connection.encoding,
+                "compression": connection.compression,
+                "pool_size": connection.pool_size,
+                "python": platform.python_version(),
+                "host": platform.node(),
+            },
+            "scenarios": {},
+        }
+
+        for name in names:
+            runs = []
+            for index in range(args.repeat):
+                print(f"{name} [{index + 1}/{args.repeat}]...", file=sys.stderr)
+                runs.append(await run_scenario(name, args.seed, args.keep_actors))
+            tool_name, arguments = SCENARIOS[name]
+            results["scenarios"][name] = {"tool": tool_name, "args": arguments, "runs": runs, "median": summarize(runs)}
+
+    output = json.dumps(results, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(output)
+    else:
+        print(output)
+    if args.save_baseline:
+        os.makedirs(os.path.dirname(os.path.abspath(args.save_baseline)), exist_ok=True)
+        with open(args.save_baseline, "w") as f:
+            f.write(output)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.tolerance_scale)
+        for regression in regressions:
+            print(f"REGRESSION {regression}", file=sys.stderr)
+        if regressions:
+            return 1
+        print(f"No regressions against {args.baseline}", file=sys.stderr)
+    return 0
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    parser = argparse.ArgumentParser(description="Benchmark the Unreal MCP scene generators")
+    parser.add_argument("--scenarios", help=f"Comma-separated subset of: {', '.join(SCENARIOS)}")
+    parser.add_argument("--seed", type=int, default=DEFAULT_SEED)
+    parser.add_argument("--repeat", type=int, default=1, help="Runs per scenario; metrics are medians")
+    parser.add_argument("--output", help="Write results JSON here instead of stdout")
+    parser.add_argument("--baseline", help="Results JSON to compare against")
+    parser.add_argument("--save-baseline", help="Also write the results to this path")
+    parser.add_argument("--tolerance-scale", type=float, default=1.0,
+                        help="Multiply the relative regression tolerances, e.g. 2 on noisy machines")
+    parser.add_argument("--keep-actors", action="store_true", help="Leave generated actors in the level")
+    args = parser.parse_args(argv)
+    args.repeat = max(1, args.repeat)
+    return asyncio.run(run(args))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -5,19 +5,27 @@ Centralized system for managing unique actor names across all MCP functions.
 Prevents duplicate name errors by automatically generating unique names and tracking actors.
 """
 
+import contextlib
+import contextvars
 import logging
+import threading
 import time
 import uuid
-from typing import Dict, Any, Set, Optional
+from typing import Dict, Any, Set, Optional, List
 
 # Configure logging
 logger = logging.getLogger("ActorNameManager")
 
+# Group actor that spawns attach to; context-local, so it follows asyncio tasks and asyncio.to_thread
+_current_group: contextvars.ContextVar = contextvars.ContextVar("actor_group", default=None)
+
 class ActorNameManager:
     """Centralized system for managing unique actor names across all MCP functions."""
     
     def __init__(self):
+        # Names of actors known to exist or reserved for a spawn in flight; guarded by _lock
         self._known_actors: Set[str] = set()
+        self._lock = threading.Lock()
         self._session_id = str(int(time.time()))[-6:]  # Last 6 digits of timestamp
         self._actor_counters: Dict[str, int] = {}
         logger.info(f"ActorNameManager initialized with session ID: {self._session_id}")
@@ -28,7 +36,9 @@ class ActorNameManager:
     
     def generate_unique_name(self, base_name: str, unreal_connection=None) -> str:
         """
-        Generate a unique actor name based on the desired base name.
+        Generate a unique actor name based on the desired base name and reserve it,
+        so concurrent callers never get the same name. Release the name with
+        release_name() if the spawn fails.
         
         Strategy:
         1. First try the base name as-is
@@ -42,40 +52,47 @@ class ActorNameManager:
             base_name = f"Actor_{self._session_id}"
         
         # Strategy 1: Try base name as-is
-        if not self._actor_exists(base_name, unreal_connection):
+        if self._try_reserve(base_name, unreal_connection):
             return base_name
         
         # Strategy 2: Try with session ID
         session_name = f"{base_name}_{self._session_id}"
-        if not self._actor_exists(session_name, unreal_connection):
+        if self._try_reserve(session_name, unreal_connection):
             return session_name
         
         # Strategy 3: Try with counter
-        counter_key = base_name
-        if counter_key not in self._actor_counters:
-            self._actor_counters[counter_key] = 0
-        
         for attempt in range(1000):  # Prevent infinite loops
-            self._actor_counters[counter_key] += 1
-            counter_name = f"{base_name}_{self._actor_counters[counter_key]}"
+            with self._lock:
+                counter = self._actor_counters.get(base_name, 0) + 1
+                self._actor_counters[base_name] = counter
+            counter_name = f"{base_name}_{counter}"
             
-            if not self._actor_exists(counter_name, unreal_connection):
+            if self._try_reserve(counter_name, unreal_connection):
                 return counter_name
         
         # Strategy 4: Ultimate fallback - session + counter + UUID
         unique_suffix = str(uuid.uuid4())[:8]
-        final_name = f"{base_name}_{self._session_id}_{self._actor_counters[counter_key]}_{unique_suffix}"
+        final_name = f"{base_name}_{self._session_id}_{counter}_{unique_suffix}"
+        with self._lock:
+            self._known_actors.add(final_name)
         
         logger.info(f"Generated unique name: {base_name} -> {final_name}")
         return final_name
     
+    def _try_reserve(self, name: str, unreal_connection=None) -> bool:
+        """
+        Reserve a name unless it is taken. The reservation is made before asking
+        Unreal, so a concurrent caller checking the same name sees it as taken.
+        """
+        with self._lock:
+            if name in self._known_actors:
+                return False
+            self._known_actors.add(name)
+        # A name found in the level stays in the cache as taken
+        return not self._actor_exists(name, unreal_connection)
+    
     def _actor_exists(self, name: str, unreal_connection=None) -> bool:
-        """Check if an actor with the given name exists."""
-        # First check our local cache
-        if name in self._known_actors:
-            return True
-        
-        # If we have a connection, check with Unreal Engine
+        """Check with Unreal Engine whether an actor with the given name exists."""
         if unreal_connection:
             try:
                 response = unreal_connection.send_command("find_actors_by_name", {"pattern": name})
@@ -86,13 +103,11 @@ class ActorNameManager:
                         for actor in actors:
                             if isinstance(actor, dict) and actor.get("name") == name:
                                 # Found exact match
-                                self._known_actors.add(name)
                                 return True
                         # Also check if any actor starts with this exact name (for safety)
                         for actor in actors:
                             if isinstance(actor, dict) and actor.get("name", "").startswith(name):
                                 # Found actor with this base name
-                                self._known_actors.add(name)
                                 return True
             except Exception as e:
                 logger.debug(f"Error checking actor existence for '{name}': {e}")
@@ -101,11 +116,17 @@ class ActorNameManager:
     
     def mark_actor_created(self, name: str):
         """Mark an actor as created (add to known actors)."""
-        self._known_actors.add(name)
+        with self._lock:
+            self._known_actors.add(name)
     
     def remove_actor(self, name: str):
         """Remove an actor from known actors (when deleted)."""
-        self._known_actors.discard(name)
+        with self._lock:
+            self._known_actors.discard(name)
+    
+    def release_name(self, name: str):
+        """Give back a name reserved by generate_unique_name whose spawn failed."""
+        self.remove_actor(name)
     
 
 # Global actor name manager instance
@@ -118,14 +139,71 @@ def get_global_actor_name_manager() -> ActorNameManager:
 def clear_actor_cache():
     """Clear the global actor cache."""
     global _global_actor_name_manager
-    _global_actor_name_manager._known_actors.clear()
-    _global_actor_name_manager._actor_counters.clear()
+    with _global_actor_name_manager._lock:
+        _global_actor_name_manager._known_actors.clear()
+        _global_actor_name_manager._actor_counters.clear()
     logger.info("Cleared global actor cache")
 
 def get_unique_actor_name(base_name: str, unreal_connection=None) -> str:
     """Public interface to get a unique actor name."""
     return _global_actor_name_manager.generate_unique_name(base_name, unreal_connection)
 
+def current_group() -> Optional[str]:
+    """Name of the group actor spawns are currently attached to, if any."""
+    return _current_group.get()
+
+def create_actor_group(unreal_connection, name: str, location: List[float] = None, folder: str = None) -> bool:
+    """
+    Create a group actor to attach generated parts under. An existing actor with
+    the same name is reused as the group.
+    
+    Returns:
+        True if the group exists afterwards
+    """
+    params = {"name": name}
+    if location:
+        params["location"] = location
+    if folder:
+        params["folder"] = folder
+    
+    response = unreal_connection.send_command("create_group", params)
+    if response and response.get("status") == "success":
+        _global_actor_name_manager.mark_actor_created(name)
+        return True
+    error = (response or {}).get("error", "No response from Unreal")
+    if "already exists" in error:
+        return True
+    logger.warning(f"Could not create group '{name}': {error}")
+    return False
+
+@contextlib.contextmanager
+def attach_to_group(name: Optional[str]):
+    """
+    Attach actors spawned through the helpers inside the block under an existing group
+    actor. Without a name the enclosing group, if any, stays in effect, so a builder
+    called by another grouped builder still attaches to the outer group.
+    """
+    if not name:
+        yield current_group()
+        return
+    token = _current_group.set(name)
+    try:
+        yield name
+    finally:
+        _current_group.reset(token)
+
+@contextlib.contextmanager
+def actor_group(unreal_connection, name: Optional[str], location: List[float] = None, folder: str = None):
+    """
+    Create the group actor and attach everything spawned through the helpers inside
+    the block under it. Without a name, or if the group can't be created, the block
+    keeps the enclosing group (if any).
+    """
+    if name and not create_actor_group(unreal_connection, name, location, folder):
+        name = None
+    with attach_to_group(name):
+        yield name
+
 def safe_spawn_actor(unreal_connection, params: Dict[str, Any], auto_unique_name: bool = True) -> Dict[str, Any]:
     """
     Safely spawn an actor with automatic unique name generation.
@@ -143,8 +221,12 @@ def safe_spawn_actor(unreal_connection, params: Dict[str, Any], auto_unique_name
     
     original_name = params.get("name", "Actor")
     
+    group = current_group()
+    if group and "parent" not in params:
+        params["parent"] = group
+    
     if auto_unique_name:
-        # Generate unique name
+        # Generate and reserve a unique name before spawning, so concurrent spawns can't pick it too
         unique_name = _global_actor_name_manager.generate_unique_name(original_name, unreal_connection)
         params["name"] = unique_name
         
@@ -165,34 +247,36 @@ def safe_spawn_actor(unreal_connection, params: Dict[str, Any], auto_unique_name
                 if isinstance(response["result"], dict):
                     response["result"]["final_name"] = params["name"]
                     response["result"]["original_name"] = original_name
+            
+            # A part left outside its group would be missed when the group is moved or deleted
+            result = response.get("result")
+            if params.get("parent") and isinstance(result, dict) and result.get("parent") != params["parent"]:
+                return {"success": False, "status": "error",
+                        "error": f"Actor '{params['name']}' was spawned but not attached to '{params['parent']}'"}
         elif response and response.get("status") == "error" and "already exists" in response.get("error", ""):
-            # Actor was created by another process/thread, mark as success
-            logger.info(f"Actor '{params['name']}' was created elsewhere, marking as success")
+            # Someone else spawned this name outside the manager; that actor isn't ours to report
             _global_actor_name_manager.mark_actor_created(params["name"])
-            return {
-                "status": "success",
-                "result": {
-                    "name": params["name"],
-                    "final_name": params["name"],
-                    "original_name": original_name,
-                    "concurrent": True,
-                    "reason": "Created by concurrent process"
-                }
-            }
+            return {"success": False, "status": "error",
+                    "error": f"Actor name collision: '{params['name']}' already exists"}
+        elif auto_unique_name:
+            _global_actor_name_manager.release_name(params["name"])
         
         return response or {"success": False, "status": "error", "error": "No response from Unreal"}
         
     except Exception as e:
         logger.error(f"Error in safe_spawn_actor: {e}")
+        if auto_unique_name:
+            _global_actor_name_manager.release_name(params["name"])
         return {"success": False, "status": "error", "error": str(e)}
 
-def safe_delete_actor(unreal_connection, actor_name: str) -> Dict[str, Any]:
+def safe_delete_actor(unreal_connection, actor_name: str, include_attached: bool = False) -> Dict[str, Any]:
     """
     Safely delete an actor and update the name tracking.
     
     Args:
         unreal_connection: The Unreal connection to use
         actor_name: Name of the actor to delete
+        include_attached: Also delete every actor attached under it, e.g. a whole group
         
     Returns:
         Response from Unreal Engine
@@ -201,7 +285,10 @@ def safe_delete_actor(unreal_connection, actor_name: str) -> Dict[str, Any]:
         return {"success": False, "message": "No Unreal connection available"}
     
     try:
-        response = unreal_connection.send_command("delete_actor", {"name": actor_name})
+        params = {"name": actor_name}
+        if include_attached:
+            params["include_attached"] = True
+        response = unreal_connection.send_command("delete_actor", params)
         
         if response and response.get("status") == "success":
             # Remove from our tracking
@@ -9,13 +9,15 @@ logger = logging.getLogger(__name__)
 
 # Import actor name manager functions
 try:
-    from .actor_name_manager import get_unique_actor_name, get_global_actor_name_manager
+    from .actor_name_manager import get_unique_actor_name, get_global_actor_name_manager, current_group
 except ImportError:
     logger.warning("Could not import actor_name_manager, unique name generation disabled")
     def get_unique_actor_name(base_name: str, unreal_connection=None) -> str:
         return base_name
     def get_global_actor_name_manager():
         return None
+    def current_group():
+        return None
 
 
 def spawn_blueprint_actor(
@@ -24,7 +26,9 @@ def spawn_blueprint_actor(
     actor_name: str,
     location: List[float] = [0, 0, 0],
     rotation: List[float] = [0, 0, 0],
-    auto_unique_name: bool = True
+    auto_unique_name: bool = True,
+    parent: str = None,
+    folder: str = None
 ) -> Dict[str, Any]:
     """
     Spawn an actor from a Blueprint using the provided Unreal connection.
@@ -36,6 +40,8 @@ def spawn_blueprint_actor(
         location: [x, y, z] position to spawn at
         rotation: [roll, pitch, yaw] rotation to apply
         auto_unique_name: Whether to automatically generate unique names (default True)
+        parent: Group or actor to attach to; defaults to the active actor_group()
+        folder: Optional outliner folder
         
     Returns:
         Dict containing success status and result data
@@ -59,6 +65,11 @@ def spawn_blueprint_actor(
             "location": location,
             "rotation": rotation
         }
+        parent = parent or current_group()
+        if parent:
+            params["parent"] = parent
+        if folder:
+            params["folder"] = folder
         
         response = unreal_connection.send_command("spawn_blueprint_actor", params)
         
@@ -80,6 +91,150 @@ def spawn_blueprint_actor(
         return {"success": False, "message": str(e)}
 
 
+def spawn_blueprint_actors(
+    unreal_connection,
+    blueprint_name: str,
+    transforms: List[List[float]],
+    names: List[str] = None,
+    name_prefix: str = None,
+    properties: Dict[str, Any] = None,
+    overrides: List[Dict[str, Any]] = None,
+    parent: str = None,
+    folder: str = None
+) -> Dict[str, Any]:
+    """
+    Spawn many instances of a Blueprint with a single command.
+    
+    Args:
+        unreal_connection: The Unreal Engine connection object
+        blueprint_name: Name of the blueprint to spawn
+        transforms: One row per instance: [x, y, z], [x, y, z, pitch, yaw, roll]
+                    or [x, y, z, pitch, yaw, roll, sx, sy, sz]
+        names: Optional actor name per instance; taken names get a numeric suffix
+        name_prefix: Name instances <prefix>_<index> when names is not given
+        properties: Property paths set on every instance before its construction script runs
+        overrides: Optional per-instance property paths (or None), applied after properties
+        parent: Group or actor to attach every instance to; defaults to the active actor_group()
+        folder: Optional outliner folder for the instances
+        
+    Returns:
+        Dict whose result's actors[i] is the name spawned for transforms[i], or None where that instance failed
+    """
+    try:
+        if not unreal_connection:
+            return {"success": False, "message": "No Unreal connection provided"}
+        
+        params = {"blueprint_name": blueprint_name, "transforms": transforms}
+        if names:
+            params["names"] = names
+        elif name_prefix:
+            params["name_prefix"] = name_prefix
+        if properties:
+            params["properties"] = properties
+        if overrides:
+            params["overrides"] = overrides
+        parent = parent or current_group()
+        if parent:
+            params["parent"] = parent
+        if folder:
+            params["folder"] = folder
+        
+        response = unreal_connection.send_command("spawn_blueprint_actors", params)
+        
+        if response and response.get("status") == "success":
+            manager = get_global_actor_name_manager()
+            if manager:
+                for actor_name in response.get("result", {}).get("actors", []):
+                    if actor_name:
+                        manager.mark_actor_created(actor_name)
+        
+        return response or {"success": False, "message": "No response from Unreal"}
+        
+    except Exception as e:
+        logger.error(f"spawn_blueprint_actors helper error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+def spawn_spline_mesh(
+    unreal_connection,
+    actor_name: str,
+    points: List[List[float]],
+    static_mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    width: float = 0.0,
+    height: float = 0.0,
+    curve_type: str = "curve",
+    closed: bool = False,
+    segment_length: float = 0.0,
+    align: str = "center",
+    forward_axis: str = "x",
+    material: str = None,
+    collision: bool = True,
+    auto_unique_name: bool = True,
+    parent: str = None,
+    folder: str = None
+) -> Dict[str, Any]:
+    """
+    Spawn one actor with a mesh deformed along a spline through the given points.
+    
+    Args:
+        unreal_connection: The Unreal Engine connection object
+        actor_name: Name to give the spline actor
+        points: World-space control points as [x, y, z] rows
+        static_mesh: Mesh laid along the spline
+        width, height: Cross-section size in cm; 0 keeps the mesh's own size
+        curve_type: "curve" for a smooth spline, "linear" for straight runs with corners
+        closed: Join the last point back to the first
+        segment_length: Split into mesh pieces of about this length; 0 for one piece per pair of points
+        align: "center" or "bottom" (the mesh rests on the spline)
+        forward_axis: Mesh axis along the spline ("z" for the engine cylinder)
+        material: Optional material asset path
+        collision: Whether the mesh pieces collide
+        auto_unique_name: Whether to automatically generate unique names (default True)
+        parent: Group or actor to attach to; defaults to the active actor_group()
+        folder: Optional outliner folder
+        
+    Returns:
+        Dict containing success status and result data
+    """
+    try:
+        if not unreal_connection:
+            return {"success": False, "message": "No Unreal connection provided"}
+        
+        if auto_unique_name:
+            actor_name = get_unique_actor_name(actor_name, unreal_connection)
+        
+        params = {
+            "name": actor_name,
+            "points": points,
+            "static_mesh": static_mesh,
+            "curve_type": curve_type,
+            "closed": closed,
+            "align": align,
+            "forward_axis": forward_axis,
+            "collision": collision
+        }
+        optional = {"width": width, "height": height, "segment_length": segment_length, "material": material}
+        params.update({key: value for key, value in optional.items() if value})
+        parent = parent or current_group()
+        if parent:
+            params["parent"] = parent
+        if folder:
+            params["folder"] = folder
+        
+        response = unreal_connection.send_command("spawn_spline_mesh", params)
+        
+        if response and response.get("status") == "success":
+            manager = get_global_actor_name_manager()
+            if manager:
+                manager.mark_actor_created(actor_name)
+        
+        return response or {"success": False, "message": "No response from Unreal"}
+        
+    except Exception as e:
+        logger.error(f"spawn_spline_mesh helper error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 def get_blueprint_material_info(
     unreal_connection,
     blueprint_name: str,
@@ -4,6 +4,7 @@ Includes skyscrapers, office towers, apartment complexes, shopping malls, and pa
 """
 from typing import Dict, Any, List
 import logging
+import random
 import sys
 import os
 
@@ -25,10 +26,9 @@ def _safe_spawn_building_actor(unreal, params):
     return resp
 
 
-def _create_skyscraper(height: int, base_width: float, base_depth: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
+def _create_skyscraper(height: int, base_width: float, base_depth: float, location: List[float], name_prefix: str, rng: random.Random) -> Dict[str, Any]:
     """Create an impressive skyscraper with multiple sections and details."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -107,8 +107,8 @@ def _create_skyscraper(height: int, base_width: float, base_depth: float, locati
         
         # Rooftop equipment
         for i in range(3):
-            equipment_x = location[0] + random.uniform(-current_width/4, current_width/4)
-            equipment_y = location[1] + random.uniform(-current_depth/4, current_depth/4)
+            equipment_x = location[0] + rng.uniform(-current_width/4, current_width/4)
+            equipment_y = location[1] + rng.uniform(-current_depth/4, current_depth/4)
             equipment_result = _safe_spawn_building_actor(unreal, {
                 "name": f"{name_prefix}_RoofEquipment_{i}",
                 "type": "StaticMeshActor",
@@ -0,0 +1,388 @@
+"""
+asyncio client for the Unreal MCP TCP server.
+
+Keeps a small pool of persistent connections. Each connection negotiates
+length-prefixed framing once, then pipelines requests: the plugin answers a
+connection's requests in the order they arrive, so each response frame goes to
+the oldest request still waiting on that connection. New requests go to the
+connection with the fewest in flight, so independent calls overlap instead of
+queueing behind one lock.
+
+Every connection holds one of the plugin's worker threads while it is open, so
+the pool is kept small and idle connections are closed after a few seconds.
+"""
+import asyncio
+import itertools
+import json
+import logging
+import os
+import socket
+from collections import deque
+from typing import Any, AsyncIterator, Callable, Dict, Iterable, Iterator, List, Optional, Tuple
+
+from helpers import wire_codec
+
+logger = logging.getLogger("UnrealMCP_Advanced")
+
+# Persistent connections per client; the plugin serves 4 connections at a time and refuses more
+DEFAULT_POOL_SIZE = int(os.environ.get("UNREAL_MCP_POOL_SIZE", "2"))
+
+
+class _PipelinedConnection:
+    """One persistent socket with requests in flight, answered in send order."""
+
+    CONNECT_TIMEOUT = 10  # seconds
+    IDLE_CLOSE_DELAY = 15  # seconds without requests before the socket is released
+
+    def __init__(self, host: str, port: int, encoding: str, compression: str, stats: Dict[str, int]):
+        self.host = host
+        self.port = port
+        self.encoding = encoding
+        self.compression = compression
+        self.stats = stats
+        self.closed = False
+        self._reader: Optional[asyncio.StreamReader] = None
+        self._writer: Optional[asyncio.StreamWriter] = None
+        self._pending: deque = deque()  # (request id, command, future), oldest first
+        self._read_task: Optional[asyncio.Task] = None
+        self._idle_handle: Optional[asyncio.TimerHandle] = None
+
+    @property
+    def in_flight(self) -> int:
+        return len(self._pending)
+
+    async def open(self, pipelined: bool = True):
+        self._reader, self._writer = await asyncio.wait_for(
+            asyncio.open_connection(self.host, self.port), self.CONNECT_TIMEOUT)
+        sock = self._writer.get_extra_info("socket")
+        if sock is not None:
+            sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+        await self._negotiate()
+        if pipelined:
+            self._read_task = asyncio.get_running_loop().create_task(self._read_loop())
+            self._schedule_idle_close()
+
+    async def _negotiate(self):
+        """Switch the connection to length-prefixed frames; the reply itself is plain JSON."""
+        params = {"encoding": self.encoding, "framing": "length_prefixed"}
+        if self.compression != "none":
+            params["compression"] = self.compression
+        reply = await self._request_plain({"type": "negotiate", "params": params})
+        # Refused because every plugin worker is taken; retried like any other connection failure
+        if str(reply.get("error", "")).startswith("Server busy"):
+            raise ConnectionError(reply["error"])
+
+        if reply.get("status") != "success" and (self.encoding != "json" or self.compression != "none"):
+            logger.warning(f"Server rejected encoding '{self.encoding}'/compression '{self.compression}' "
+                           f"({reply.get('error')}); using uncompressed json")
+            self.encoding = "json"
+            self.compression = "none"
+            reply = await self._request_plain({"type": "negotiate", "params": {"framing": "length_prefixed"}})
+
+        if reply.get("result", {}).get("framing") != "length_prefixed":
+            raise ConnectionError(f"Server did not accept length-prefixed framing: {reply.get('error')}")
+
+    async def _request_plain(self, command_obj: Dict[str, Any]) -> Dict[str, Any]:
+        self._writer.write(json.dumps(command_obj).encode("utf-8"))
+        await self._writer.drain()
+
+        data = b""
+        while True:
+            chunk = await asyncio.wait_for(self._reader.read(8192), self.CONNECT_TIMEOUT)
+            if not chunk:
+                raise ConnectionError("Connection closed during negotiation")
+            data += chunk
+            try:
+                return json.loads(data.decode("utf-8"))
+            except (json.JSONDecodeError, UnicodeDecodeError):
+                continue
+
+    def send(self, request_id: int, command: str, payload: bytes) -> asyncio.Future:
+        """Queue a request; the returned future receives its decoded response."""
+        if self.closed:
+            raise ConnectionError("Connection is closed")
+        if self._idle_handle:
+            self._idle_handle.cancel()
+            self._idle_handle = None
+
+        future = asyncio.get_running_loop().create_future()
+        # Recorded before writing so the read loop always finds it first
+        self._pending.append((request_id, command, future))
+        self._writer.write(payload)
+        return future
+
+    async def drain(self):
+        await self._writer.drain()
+
+    async def _read_loop(self):
+        error: Exception = ConnectionError("Connection closed by Unreal")
+        try:
+            while True:
+                header = await self._reader.readexactly(wire_codec.FRAME_HEADER_SIZE)
+                payload_size, flags = wire_codec.parse_frame_header(header)
+                payload = await self._reader.readexactly(payload_size)
+                self.stats["bytes_received"] += wire_codec.FRAME_HEADER_SIZE + payload_size
+                if not self._pending:
+                    logger.warning(f"Dropping unexpected {payload_size} byte frame")
+                    continue
+
+                request_id, command, future = self._pending.popleft()
+                # Callers that timed out or were cancelled leave their slot; their response is dropped
+                if not future.done():
+                    try:
+                        future.set_result(wire_codec.decode_frame_payload(payload, flags))
+                    except Exception as e:
+                        future.set_exception(ValueError(f"Invalid response to {command}: {e}"))
+                logger.debug(f"[#{request_id}] {command}: {payload_size} byte frame")
+
+                if not self._pending:
+                    self._schedule_idle_close()
+        except asyncio.CancelledError:
+            error = ConnectionError("Connection closed")
+        except (asyncio.IncompleteReadError, ConnectionError, OSError) as e:
+            error = ConnectionError(f"Connection to Unreal lost: {e}")
+        finally:
+            self._fail_pending(error)
+            self._close_transport()
+
+    def _schedule_idle_close(self):
+        if self._idle_handle:
+            self._idle_handle.cancel()
+        self._idle_handle = asyncio.get_running_loop().call_later(self.IDLE_CLOSE_DELAY, self._close_if_idle)
+
+    def _close_if_idle(self):
+        self._idle_handle = None
+        if not self._pending:
+            self.close()
+
+    def _fail_pending(self, error: Exception):
+        while self._pending:
+            _, _, future = self._pending.popleft()
+            if not future.done():
+                future.set_exception(error)
+
+    def _close_transport(self):
+        self.closed = True
+        if self._idle_handle:
+            self._idle_handle.cancel()
+            self._idle_handle = None
+        if self._writer:
+            self._writer.close()
+
+    def close(self):
+        if self._read_task and not self._read_task.done():
+            self._read_task.cancel()
+        else:
+            self._fail_pending(ConnectionError("Connection closed"))
+            self._close_transport()
+
+
+class AsyncUnrealConnection:
+    """
+    Non-blocking client with request pipelining over a small connection pool.
+
+    Methods must be awaited on the loop the client was created on. Threads
+    use ThreadedUnrealClient, which forwards to this loop.
+    """
+
+    MAX_RETRIES = 3
+    BASE_RETRY_DELAY = 0.5  # seconds
+    MAX_RETRY_DELAY = 5.0   # seconds
+
+    def __init__(self, host: str, port: int, encoding: str = "json", compression: str = "none",
+                 pool_size: int = DEFAULT_POOL_SIZE,
+                 timeout_for_command: Optional[Callable[[str], float]] = None):
+        self.host = host
+        self.port = port
+        self.encoding = encoding
+        self.compression = compression
+        self.pool_size = max(1, pool_size)
+        self._timeout_for_command = timeout_for_command or (lambda command: 30)
+        self._connections: List[_PipelinedConnection] = []
+        self._open_lock = asyncio.Lock()
+        self._request_ids = itertools.count(1)
+        # Traffic counters for benchmarks; negotiation is not counted
+        self.stats = {"commands": 0, "bytes_sent": 0, "bytes_received": 0}
+
+    def reset_stats(self):
+        for key in self.stats:
+            self.stats[key] = 0
+
+    def _pick_open_connection(self) -> Optional[_PipelinedConnection]:
+        self._connections = [c for c in self._connections if not c.closed]
+        for connection in self._connections:
+            if connection.in_flight == 0:
+                return connection
+        if len(self._connections) >= self.pool_size:
+            return min(self._connections, key=lambda c: c.in_flight)
+        return None
+
+    async def _acquire(self) -> _PipelinedConnection:
+        """Least busy open connection, opening another while the pool has room and all are busy."""
+        connection = self._pick_open_connection()
+        if connection:
+            return connection
+
+        async with self._open_lock:
+            # Another caller may have opened one while this one waited
+            connection = self._pick_open_connection()
+            if connection:
+                return connection
+            connection = _PipelinedConnection(self.host, self.port, self.encoding, self.compression, self.stats)
+            await connection.open()
+            # Later connections skip a negotiation the server already refused
+            self.encoding = connection.encoding
+            self.compression = connection.compression
+            self._connections.append(connection)
+        logger.info(f"Opened pooled Unreal connection ({len(self._connections)}/{self.pool_size})")
+        return connection
+
+    async def send_command(self, command: str, params: Dict[str, Any] = None,
+                           timeout: Optional[float] = None) -> Dict[str, Any]:
+        """
+        Send a command and wait for its response, retrying on connection failures.
+        Returns the same response dictionaries as UnrealConnection.send_command.
+        """
+        request_id = next(self._request_ids)
+        payload = json.dumps({"type": command, "params": params or {}}).encode("utf-8")
+        timeout = timeout or self._timeout_for_command(command)
+        last_error = None
+        self.stats["commands"] += 1
+
+        for attempt in range(self.MAX_RETRIES + 1):
+            try:
+                connection = await self._acquire()
+                future = connection.send(request_id, command, payload)
+                self.stats["bytes_sent"] += len(payload)
+                logger.info(f"[#{request_id}] Sending command (attempt {attempt + 1}): {command}")
+                await connection.drain()
+                try:
+                    response = await asyncio.wait_for(future, timeout)
+                except asyncio.TimeoutError:
+                    # The connection stays usable; the late response is dropped when it arrives
+                    logger.warning(f"[#{request_id}] Timeout after {timeout}s waiting for {command}")
+                    return {"status": "error", "error": f"Timeout after {timeout}s waiting for response to {command}"}
+                return self._normalize(command, response)
+            except (ConnectionError, OSError, asyncio.TimeoutError) as e:
+                last_error = str(e) or type(e).__name__
+                logger.warning(f"[#{request_id}] Command failed (attempt {attempt + 1}/{self.MAX_RETRIES + 1}): {last_error}")
+                if attempt < self.MAX_RETRIES:
+                    await asyncio.sleep(min(self.BASE_RETRY_DELAY * (2 ** attempt), self.MAX_RETRY_DELAY))
+
+        return {"status": "error", "error": f"Command failed after {self.MAX_RETRIES + 1} attempts: {last_error}"}
+
+    async def send_commands(self, commands: Iterable[Tuple[str, Dict[str, Any]]]) -> List[Dict[str, Any]]:
+        """Send independent commands concurrently; responses are returned in the same order."""
+        return list(await asyncio.gather(*(self.send_command(command, params) for command, params in commands)))
+
+    async def send_command_stream(self, command: str, params: Dict[str, Any] = None,
+                                  chunk_size: Optional[int] = None) -> AsyncIterator[Dict[str, Any]]:
+        """
+        Send a command in streaming mode and yield frames as they arrive.
+        Uses a dedicated connection, closed at the end of the stream, so the
+        pool keeps serving other requests meanwhile.
+        """
+        command_obj = {"type": command, "params": params or {}, "stream": True}
+        if chunk_size:
+            command_obj["stream_chunk_size"] = int(chunk_size)
+
+        connection = _PipelinedConnection(self.host, self.port, self.encoding, self.compression, self.stats)
+        self.stats["commands"] += 1
+        try:
+            # Stream frames are read here rather than by the one-frame-per-request read loop
+            await connection.open(pipelined=False)
+        except (ConnectionError, OSError, asyncio.TimeoutError) as e:
+            yield {"status": "error", "error": f"Failed to connect to Unreal Engine for {command}: {e}", "stream": "end"}
+            return
+
+        reader, writer = connection._reader, connection._writer
+        timeout = self._timeout_for_command(command)
+        try:
+            payload = json.dumps(command_obj).encode("utf-8")
+            self.stats["bytes_sent"] += len(payload)
+            writer.write(payload)
+            await writer.drain()
+            while True:
+                header = await asyncio.wait_for(reader.readexactly(wire_codec.FRAME_HEADER_SIZE), timeout)
+                payload_size, flags = wire_codec.parse_frame_header(header)
+                payload = await asyncio.wait_for(reader.readexactly(payload_size), timeout)
+                self.stats["bytes_received"] += wire_codec.FRAME_HEADER_SIZE + payload_size
+                frame = wire_codec.decode_frame_payload(payload, flags)
+                yield frame
+                if frame.get("stream") == "end":
+                    return
+        finally:
+            writer.close()
+
+    async def close(self):
+        for connection in self._connections:
+            connection.close()
+        self._connections = []
+
+    @staticmethod
+    def _normalize(command: str, response: Any) -> Dict[str, Any]:
+        if not isinstance(response, dict):
+            return {"status": "error", "error": f"Unexpected response to {command}"}
+        if response.get("status") == "error":
+            logger.warning(f"Unreal returned error: {response.get('error') or response.get('message', 'Unknown error')}")
+        elif response.get("success") is False:
+            error_msg = response.get("error") or response.get("message", "Unknown error")
+            logger.warning(f"Unreal returned failure: {error_msg}")
+            return {"status": "error", "error": error_msg}
+        return response
+
+
+class ThreadedUnrealClient:
+    """
+    Blocking facade over an AsyncUnrealConnection for code running in worker threads,
+    with the same send methods as UnrealConnection. Calls from several threads are
+    multiplexed over the shared pool instead of serialized.
+    """
+
+    def __init__(self, connection: AsyncUnrealConnection, loop: asyncio.AbstractEventLoop):
+        self.connection = connection
+        self.loop = loop
+
+    def _run(self, coroutine):
+        if self.loop.is_closed() or self.on_loop_thread:
+            coroutine.close()
+            raise RuntimeError("ThreadedUnrealClient must be used from a worker thread of a running loop")
+        return asyncio.run_coroutine_threadsafe(coroutine, self.loop).result()
+
+    def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
+        return self._run(self.connection.send_command(command, params))
+
+    def send_commands(self, commands: Iterable[Tuple[str, Dict[str, Any]]]) -> List[Dict[str, Any]]:
+        return self._run(self.connection.send_commands(list(commands)))
+
+    def send_command_stream(self, command: str, params: Dict[str, Any] = None,
+                            chunk_size: Optional[int] = None) -> Iterator[Dict[str, Any]]:
+        stream = self.connection.send_command_stream(command, params, chunk_size)
+        try:
+            while True:
+                try:
+                    yield self._run(stream.__anext__())
+                except StopAsyncIteration:
+                    return
+        finally:
+            self._run(stream.aclose())
+
+    def send_command_streamed_items(self, command: str, params: Dict[str, Any] = None,
+                                    chunk_size: Optional[int] = None) -> Iterator[Any]:
+        for frame in self.send_command_stream(command, params, chunk_size):
+            if frame.get("stream") == "items":
+                yield from frame.get("items", [])
+            elif frame.get("status") == "error":
+                raise RuntimeError(frame.get("error", "Unknown error"))
+
+    def disconnect(self):
+        if not self.loop.is_closed():
+            asyncio.run_coroutine_threadsafe(self.connection.close(), self.loop)
+
+    @property
+    def on_loop_thread(self) -> bool:
+        try:
+            return asyncio.get_running_loop() is self.loop
+        except RuntimeError:
+            return False
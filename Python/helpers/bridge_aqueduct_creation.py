@@ -9,6 +9,7 @@ import math
 import logging
 from typing import List, Dict, Any, Tuple
 from .actor_name_manager import safe_spawn_actor
+from .actor_utilities import spawn_spline_mesh
 
 logger = logging.getLogger("BridgeAqueductCreation")
 
@@ -77,9 +78,14 @@ def build_suspension_bridge_structure(
     tower_mesh: str,
     cable_mesh: str,
     suspender_mesh: str,
-    all_actors: List[Dict[str, Any]]
+    all_actors: List[Dict[str, Any]],
+    use_splines: bool = False
 ) -> Dict[str, int]:
-    """Build all components of a suspension bridge."""
+    """Build all components of a suspension bridge.
+
+    With use_splines each main cable and the deck are one spline mesh actor
+    instead of a block per module.
+    """
     logger.info(f"Starting bridge construction: {name_prefix}, span={span_length}, width={deck_width}")
     counts = {
         "towers": 0,
@@ -183,6 +189,19 @@ def build_suspension_bridge_structure(
     )
     
     for cable_idx, offset in enumerate(cable_offsets):
+        if use_splines:
+            if span_direction == 0:
+                points = [[point[0], point[1] + offset, point[2]] for point, _ in cable_points]
+            else:
+                points = [[location_adjusted[0] + offset, location_adjusted[1] + point[0] - location_adjusted[0], point[2]]
+                          for point, _ in cable_points]
+            resp = spawn_spline_mesh(unreal, f"{name_prefix}_Cable_{cable_idx}", points, cable_mesh,
+                                     width=30.0, height=30.0, forward_axis="z")
+            if resp and resp.get("status") == "success":
+                all_actors.append(resp)
+                counts["cable_segments"] += 1
+            continue
+        
         for i in range(len(cable_points) - 1):
             point, angle = cable_points[i]
             next_point, _ = cable_points[i + 1]
@@ -227,6 +246,20 @@ def build_suspension_bridge_structure(
     deck_segments_x = max(1, int(span_length / module_size))
     deck_segments_y = max(1, int(deck_width / module_size))
     
+    if use_splines:
+        if span_direction == 0:
+            deck_points = [[location_adjusted[0] - span_length/2, location_adjusted[1], location_adjusted[2]],
+                           [location_adjusted[0] + span_length/2, location_adjusted[1], location_adjusted[2]]]
+        else:
+            deck_points = [[location_adjusted[0], location_adjusted[1] - span_length/2, location_adjusted[2]],
+                           [location_adjusted[0], location_adjusted[1] + span_length/2, location_adjusted[2]]]
+        resp = spawn_spline_mesh(unreal, f"{name_prefix}_Deck", deck_points, deck_mesh, width=deck_width,
+                                 height=50.0, curve_type="linear", segment_length=module_size * 5)
+        if resp and resp.get("status") == "success":
+            all_actors.append(resp)
+            counts["deck_segments"] += 1
+        deck_segments_x = 0
+    
     for i in range(deck_segments_x):
         for j in range(deck_segments_y):
             if span_direction == 0:
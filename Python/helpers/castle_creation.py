@@ -17,6 +17,8 @@ except ImportError:
     def safe_spawn_actor(unreal_connection, params, auto_unique_name=True):
         return unreal_connection.send_command("spawn_actor", params)
 
+from .actor_utilities import spawn_spline_mesh
+
 def _safe_spawn_castle_actor(unreal, params):
     """Helper function to safely spawn castle actors and track results."""
     resp = safe_spawn_actor(unreal, params, auto_unique_name=True)
@@ -71,8 +73,12 @@ def calculate_scaled_dimensions(params: Dict[str, int], scale_factor: float = 2.
 
 
 def build_outer_bailey_walls(unreal, name_prefix: str, location: List[float], 
-                           dimensions: Dict[str, int], all_actors: List) -> None:
-    """Build the outer bailey walls with battlements."""
+                           dimensions: Dict[str, int], all_actors: List, use_splines: bool = False) -> None:
+    """Build the outer bailey walls with battlements.
+
+    With use_splines the walls are one spline mesh actor running around the bailey,
+    open at the west gate, instead of a block every 200 units.
+    """
     logger.info("Constructing massive outer bailey walls...")
     
     outer_width = dimensions["outer_width"]
@@ -80,19 +86,33 @@ def build_outer_bailey_walls(unreal, name_prefix: str, location: List[float],
     wall_height = dimensions["wall_height"]
     wall_thickness = dimensions["wall_thickness"]
     
+    if use_splines:
+        west = location[0] - outer_width/2
+        east = location[0] + outer_width/2
+        north = location[1] - outer_depth/2
+        south = location[1] + outer_depth/2
+        ground = location[2]
+        wall_result = spawn_spline_mesh(unreal, f"{name_prefix}_OuterWall", [
+            [west, location[1] - 700, ground], [west, north, ground], [east, north, ground],
+            [east, south, ground], [west, south, ground], [west, location[1] + 700, ground]
+        ], width=wall_thickness, height=wall_height, curve_type="linear", align="bottom")
+        if wall_result and wall_result.get("status") == "success":
+            all_actors.append(wall_result.get("result"))
+    
     # North wall
     for i in range(int(outer_width / 200)):
         wall_x = location[0] - outer_width/2 + i * 200 + 100
-        wall_name = f"{name_prefix}_WallNorth_{i}"
-        wall_result = _safe_spawn_castle_actor(unreal, {
-            "name": wall_name,
-            "type": "StaticMeshActor",
-            "location": [wall_x, location[1] - outer_depth/2, location[2] + wall_height/2],
-            "scale": [2.0, wall_thickness/100, wall_height/100],
-            "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-        })
-        if wall_result and wall_result.get("status") == "success":
-            all_actors.append(wall_result.get("result"))
+        if not use_splines:
+            wall_name = f"{name_prefix}_WallNorth_{i}"
+            wall_result = _safe_spawn_castle_actor(unreal, {
+                "name": wall_name,
+                "type": "StaticMeshActor",
+                "location": [wall_x, location[1] - outer_depth/2, location[2] + wall_height/2],
+                "scale": [2.0, wall_thickness/100, wall_height/100],
+                "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+            })
+            if wall_result and wall_result.get("status") == "success":
+                all_actors.append(wall_result.get("result"))
         
         # Dense battlements
         if i % 2 == 0:
@@ -110,16 +130,17 @@ def build_outer_bailey_walls(unreal, name_prefix: str, location: List[float],
     # South wall
     for i in range(int(outer_width / 200)):
         wall_x = location[0] - outer_width/2 + i * 200 + 100
-        wall_name = f"{name_prefix}_WallSouth_{i}"
-        wall_result = _safe_spawn_castle_actor(unreal, {
-            "name": wall_name,
-            "type": "StaticMeshActor",
-            "location": [wall_x, location[1] + outer_depth/2, location[2] + wall_height/2],
-            "scale": [2.0, wall_thickness/100, wall_height/100],
-            "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-        })
-        if wall_result and wall_result.get("status") == "success":
-            all_actors.append(wall_result.get("result"))
+        if not use_splines:
+            wall_name = f"{name_prefix}_WallSouth_{i}"
+            wall_result = _safe_spawn_castle_actor(unreal, {
+                "name": wall_name,
+                "type": "StaticMeshActor",
+                "location": [wall_x, location[1] + outer_depth/2, location[2] + wall_height/2],
+                "scale": [2.0, wall_thickness/100, wall_height/100],
+                "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+            })
+            if wall_result and wall_result.get("status") == "success":
+                all_actors.append(wall_result.get("result"))
         
         if i % 2 == 0:
             battlement_name = f"{name_prefix}_BattlementSouth_{i}"
@@ -133,6 +154,9 @@ def build_outer_bailey_walls(unreal, name_prefix: str, location: List[float],
             if battlement_result and battlement_result.get("status") == "success":
                 all_actors.append(battlement_result.get("result"))
     
+    if use_splines:
+        return
+    
     # East wall
     for i in range(int(outer_depth / 200)):
         wall_y = location[1] - outer_depth/2 + i * 200 + 100
@@ -4,6 +4,7 @@ Includes streets, lights, vehicles, and decorations.
 """
 from typing import Dict, Any, List
 import logging
+import random
 import sys
 import os
 
@@ -19,14 +20,21 @@ except ImportError:
     def safe_spawn_actor(unreal_connection, params, auto_unique_name=True):
         return unreal_connection.send_command("spawn_actor", params)
 
+from .actor_utilities import spawn_spline_mesh
+
 def _safe_spawn_infrastructure_actor(unreal, params):
     """Helper function to safely spawn infrastructure actors and track results."""
     resp = safe_spawn_actor(unreal, params, auto_unique_name=True)
     return resp
 
 
-def _create_street_grid(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
-    """Create a grid of streets for the town."""
+def _create_street_grid(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str,
+                        use_splines: bool = False) -> Dict[str, Any]:
+    """Create a grid of streets for the town.
+
+    With use_splines each street is one spline mesh actor across the whole grid
+    instead of a block per segment.
+    """
     try:
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
@@ -39,6 +47,23 @@ def _create_street_grid(blocks: int, block_size: float, street_width: float, loc
             
         streets = []
         
+        if use_splines:
+            half = blocks / 2 * block_size
+            for i in range(blocks + 1):
+                offset = (i - blocks/2) * block_size
+                for axis, points in (
+                    ("H", [[location[0] - half, location[1] + offset, location[2] - 5],
+                           [location[0] + half, location[1] + offset, location[2] - 5]]),
+                    ("V", [[location[0] + offset, location[1] - half, location[2] - 5],
+                           [location[0] + offset, location[1] + half, location[2] - 5]])
+                ):
+                    result = spawn_spline_mesh(unreal, f"{name_prefix}_Street_{axis}_{i}", points,
+                                               width=street_width, height=10, curve_type="linear",
+                                               segment_length=block_size)
+                    if result and result.get("status") == "success":
+                        streets.append(result.get("result"))
+            return {"success": True, "actors": streets}
+        
         # Create horizontal streets
         for i in range(blocks + 1):
             street_y = location[1] + (i - blocks/2) * block_size
@@ -92,10 +117,9 @@ def _create_street_grid(blocks: int, block_size: float, street_width: float, loc
         return {"success": False, "actors": []}
 
 
-def _create_street_lights(blocks: int, block_size: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
+def _create_street_lights(blocks: int, block_size: float, location: List[float], name_prefix: str, rng: random.Random) -> Dict[str, Any]:
     """Create street lights throughout the town."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -111,7 +135,7 @@ def _create_street_lights(blocks: int, block_size: float, location: List[float],
         for i in range(blocks + 1):
             for j in range(blocks + 1):
                 # Skip some randomly for variety
-                if random.random() > 0.7:
+                if rng.random() > 0.7:
                     continue
                     
                 light_x = location[0] + (i - blocks/2) * block_size
@@ -146,10 +170,9 @@ def _create_street_lights(blocks: int, block_size: float, location: List[float],
         return {"success": False, "actors": []}
 
 
-def _create_town_vehicles(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str, vehicle_count: int) -> Dict[str, Any]:
+def _create_town_vehicles(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str, vehicle_count: int, rng: random.Random) -> Dict[str, Any]:
     """Create vehicles throughout the town."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -163,8 +186,8 @@ def _create_town_vehicles(blocks: int, block_size: float, street_width: float, l
         
         for i in range(vehicle_count):
             # Random position on streets
-            street_x = location[0] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
-            street_y = location[1] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
+            street_x = location[0] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
+            street_y = location[1] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
             
             # Create simple car (basic cube)
             car_name = f"{name_prefix}_Car_{i}"
@@ -186,10 +209,9 @@ def _create_town_vehicles(blocks: int, block_size: float, street_width: float, l
         return {"success": False, "actors": []}
 
 
-def _create_town_decorations(blocks: int, block_size: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
+def _create_town_decorations(blocks: int, block_size: float, location: List[float], name_prefix: str, rng: random.Random) -> Dict[str, Any]:
     """Create parks, trees, and other decorative elements."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -204,14 +226,14 @@ def _create_town_decorations(blocks: int, block_size: float, location: List[floa
         # Create a few parks with trees
         num_parks = max(1, blocks // 3)
         for park_id in range(num_parks):
-            park_x = location[0] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
-            park_y = location[1] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
+            park_x = location[0] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
+            park_y = location[1] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
             
             # Create several trees in each park
-            trees_per_park = random.randint(3, 8)
+            trees_per_park = rng.randint(3, 8)
             for tree_id in range(trees_per_park):
-                tree_x = park_x + random.uniform(-200, 200)
-                tree_y = park_y + random.uniform(-200, 200)
+                tree_x = park_x + rng.uniform(-200, 200)
+                tree_y = park_y + rng.uniform(-200, 200)
                 
                 # Tree trunk (simple cylinder)
                 trunk_name = f"{name_prefix}_TreeTrunk_{park_id}_{tree_id}"
@@ -302,10 +324,9 @@ def _create_traffic_lights(blocks: int, block_size: float, location: List[float]
         return {"success": False, "actors": []}
 
 
-def _create_street_signage(blocks: int, block_size: float, location: List[float], name_prefix: str, town_size: str) -> Dict[str, Any]:
+def _create_street_signage(blocks: int, block_size: float, location: List[float], name_prefix: str, town_size: str, rng: random.Random) -> Dict[str, Any]:
     """Create street signs and billboards."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -321,7 +342,7 @@ def _create_street_signage(blocks: int, block_size: float, location: List[float]
         
         for i in range(0, blocks + 1, 2):
             for j in range(0, blocks + 1, 2):
-                if random.random() > 0.5:
+                if rng.random() > 0.5:
                     continue
                     
                 sign_x = location[0] + (i - blocks/2) * block_size + 100
@@ -353,10 +374,10 @@ def _create_street_signage(blocks: int, block_size: float, location: List[float]
         
         # Billboards for larger towns
         if town_size in ["large", "metropolis"]:
-            num_billboards = random.randint(3, 8)
+            num_billboards = rng.randint(3, 8)
             for b in range(num_billboards):
-                billboard_x = location[0] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
-                billboard_y = location[1] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
+                billboard_x = location[0] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
+                billboard_y = location[1] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
                 
                 # Billboard structure
                 billboard_name = f"{name_prefix}_Billboard_{b}"
@@ -390,8 +411,13 @@ def _create_street_signage(blocks: int, block_size: float, location: List[float]
         return {"success": False, "actors": []}
 
 
-def _create_sidewalks_crosswalks(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
-    """Create sidewalks and crosswalks."""
+def _create_sidewalks_crosswalks(blocks: int, block_size: float, street_width: float, location: List[float], name_prefix: str,
+                                 use_splines: bool = False) -> Dict[str, Any]:
+    """Create sidewalks and crosswalks.
+
+    With use_splines each sidewalk is one spline mesh actor along the whole street;
+    crosswalk stripes stay separate blocks.
+    """
     try:
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
@@ -404,62 +430,82 @@ def _create_sidewalks_crosswalks(blocks: int, block_size: float, street_width: f
         sidewalks = []
         sidewalk_width = 150.0
         
-        # Create sidewalks along streets
-        for i in range(blocks):
-            for j in range(blocks + 1):
-                # Horizontal sidewalks
-                sidewalk_y = location[1] + (j - blocks/2) * block_size
-                sidewalk_x = location[0] + (i - blocks/2 + 0.5) * block_size
+        if use_splines:
+            half = blocks / 2 * block_size
+            edge = street_width/2 - sidewalk_width/2
+            for i in range(blocks + 1):
+                offset = (i - blocks/2) * block_size
+                for side, sign in (("North", -1), ("South", 1)):
+                    y = location[1] + offset + sign * edge
+                    result = spawn_spline_mesh(unreal, f"{name_prefix}_SidewalkH_{side}_{i}",
+                                               [[location[0] - half, y, location[2]], [location[0] + half, y, location[2]]],
+                                               width=sidewalk_width, height=5, curve_type="linear", segment_length=block_size)
+                    if result and result.get("status") == "success":
+                        sidewalks.append(result.get("result"))
+                for side, sign in (("East", -1), ("West", 1)):
+                    x = location[0] + offset + sign * edge
+                    result = spawn_spline_mesh(unreal, f"{name_prefix}_SidewalkV_{side}_{i}",
+                                               [[x, location[1] - half, location[2]], [x, location[1] + half, location[2]]],
+                                               width=sidewalk_width, height=5, curve_type="linear", segment_length=block_size)
+                    if result and result.get("status") == "success":
+                        sidewalks.append(result.get("result"))
+        else:
+            # Create sidewalks along streets
+            for i in range(blocks):
+                for j in range(blocks + 1):
+                    # Horizontal sidewalks
+                    sidewalk_y = location[1] + (j - blocks/2) * block_size
+                    sidewalk_x = location[0] + (i - blocks/2 + 0.5) * block_size
                 
-                # North sidewalk
-                north_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
-                    "name": f"{name_prefix}_SidewalkH_North_{i}_{j}",
-                    "type": "StaticMeshActor",
-                    "location": [sidewalk_x, sidewalk_y - street_width/2 + sidewalk_width/2, location[2]],
-                    "scale": [block_size/100.0 * 0.7, sidewalk_width/100.0, 0.05],
-                    "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-                })
-                if north_sidewalk_result and north_sidewalk_result.get("status") == "success":
-                    sidewalks.append(north_sidewalk_result.get("result"))
+                    # North sidewalk
+                    north_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
+                        "name": f"{name_prefix}_SidewalkH_North_{i}_{j}",
+                        "type": "StaticMeshActor",
+                        "location": [sidewalk_x, sidewalk_y - street_width/2 + sidewalk_width/2, location[2]],
+                        "scale": [block_size/100.0 * 0.7, sidewalk_width/100.0, 0.05],
+                        "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+                    })
+                    if north_sidewalk_result and north_sidewalk_result.get("status") == "success":
+                        sidewalks.append(north_sidewalk_result.get("result"))
                 
-                # South sidewalk
-                south_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
-                    "name": f"{name_prefix}_SidewalkH_South_{i}_{j}",
-                    "type": "StaticMeshActor",
-                    "location": [sidewalk_x, sidewalk_y + street_width/2 - sidewalk_width/2, location[2]],
-                    "scale": [block_size/100.0 * 0.7, sidewalk_width/100.0, 0.05],
-                    "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-                })
-                if south_sidewalk_result and south_sidewalk_result.get("status") == "success":
-                    sidewalks.append(south_sidewalk_result.get("result"))
-        
-        # Vertical sidewalks
-        for i in range(blocks + 1):
-            for j in range(blocks):
-                sidewalk_x = location[0] + (i - blocks/2) * block_size
-                sidewalk_y = location[1] + (j - blocks/2 + 0.5) * block_size
+                    # South sidewalk
+                    south_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
+                        "name": f"{name_prefix}_SidewalkH_South_{i}_{j}",
+                        "type": "StaticMeshActor",
+                        "location": [sidewalk_x, sidewalk_y + street_width/2 - sidewalk_width/2, location[2]],
+                        "scale": [block_size/100.0 * 0.7, sidewalk_width/100.0, 0.05],
+                        "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+                    })
+                    if south_sidewalk_result and south_sidewalk_result.get("status") == "success":
+                        sidewalks.append(south_sidewalk_result.get("result"))
+        
+            # Vertical sidewalks
+            for i in range(blocks + 1):
+                for j in range(blocks):
+                    sidewalk_x = location[0] + (i - blocks/2) * block_size
+                    sidewalk_y = location[1] + (j - blocks/2 + 0.5) * block_size
                 
-                # East sidewalk
-                east_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
-                    "name": f"{name_prefix}_SidewalkV_East_{i}_{j}",
-                    "type": "StaticMeshActor",
-                    "location": [sidewalk_x - street_width/2 + sidewalk_width/2, sidewalk_y, location[2]],
-                    "scale": [sidewalk_width/100.0, block_size/100.0 * 0.7, 0.05],
-                    "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-                })
-                if east_sidewalk_result and east_sidewalk_result.get("status") == "success":
-                    sidewalks.append(east_sidewalk_result.get("result"))
+                    # East sidewalk
+                    east_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
+                        "name": f"{name_prefix}_SidewalkV_East_{i}_{j}",
+                        "type": "StaticMeshActor",
+                        "location": [sidewalk_x - street_width/2 + sidewalk_width/2, sidewalk_y, location[2]],
+                        "scale": [sidewalk_width/100.0, block_size/100.0 * 0.7, 0.05],
+                        "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+                    })
+                    if east_sidewalk_result and east_sidewalk_result.get("status") == "success":
+                        sidewalks.append(east_sidewalk_result.get("result"))
                 
-                # West sidewalk
-                west_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
-                    "name": f"{name_prefix}_SidewalkV_West_{i}_{j}",
-                    "type": "StaticMeshActor",
-                    "location": [sidewalk_x + street_width/2 - sidewalk_width/2, sidewalk_y, location[2]],
-                    "scale": [sidewalk_width/100.0, block_size/100.0 * 0.7, 0.05],
-                    "static_mesh": "/Engine/BasicShapes/Cube.Cube"
-                })
-                if west_sidewalk_result and west_sidewalk_result.get("status") == "success":
-                    sidewalks.append(west_sidewalk_result.get("result"))
+                    # West sidewalk
+                    west_sidewalk_result = _safe_spawn_infrastructure_actor(unreal, {
+                        "name": f"{name_prefix}_SidewalkV_West_{i}_{j}",
+                        "type": "StaticMeshActor",
+                        "location": [sidewalk_x + street_width/2 - sidewalk_width/2, sidewalk_y, location[2]],
+                        "scale": [sidewalk_width/100.0, block_size/100.0 * 0.7, 0.05],
+                        "static_mesh": "/Engine/BasicShapes/Cube.Cube"
+                    })
+                    if west_sidewalk_result and west_sidewalk_result.get("status") == "success":
+                        sidewalks.append(west_sidewalk_result.get("result"))
         
         # Create crosswalks at intersections
         crosswalk_width = 200.0
@@ -501,10 +547,9 @@ def _create_sidewalks_crosswalks(blocks: int, block_size: float, street_width: f
         return {"success": False, "actors": []}
 
 
-def _create_urban_furniture(blocks: int, block_size: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
+def _create_urban_furniture(blocks: int, block_size: float, location: List[float], name_prefix: str, rng: random.Random) -> Dict[str, Any]:
     """Create benches, trash cans, and bus stops."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -520,19 +565,19 @@ def _create_urban_furniture(blocks: int, block_size: float, location: List[float
         
         for f in range(num_furniture_items):
             # Random position along a street
-            street_x = location[0] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
-            street_y = location[1] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
+            street_x = location[0] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
+            street_y = location[1] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
             
             # Offset to sidewalk
-            sidewalk_offset = random.choice([-200, 200])
-            if random.random() > 0.5:
+            sidewalk_offset = rng.choice([-200, 200])
+            if rng.random() > 0.5:
                 furniture_x = street_x + sidewalk_offset
                 furniture_y = street_y
             else:
                 furniture_x = street_x
                 furniture_y = street_y + sidewalk_offset
             
-            furniture_type = random.choice(["bench", "trash", "bus_stop"])
+            furniture_type = rng.choice(["bench", "trash", "bus_stop"])
             
             if furniture_type == "bench":
                 # Create bench
@@ -618,10 +663,9 @@ def _create_urban_furniture(blocks: int, block_size: float, location: List[float
         return {"success": False, "actors": []}
 
 
-def _create_street_utilities(blocks: int, block_size: float, location: List[float], name_prefix: str) -> Dict[str, Any]:
+def _create_street_utilities(blocks: int, block_size: float, location: List[float], name_prefix: str, rng: random.Random) -> Dict[str, Any]:
     """Create parking meters and fire hydrants."""
     try:
-        import random
         # Import here to avoid circular imports
         import unreal_mcp_server_advanced as server
         get_unreal_connection = server.get_unreal_connection
@@ -635,12 +679,12 @@ def _create_street_utilities(blocks: int, block_size: float, location: List[floa
         # Parking meters along commercial streets
         num_meters = blocks * 4
         for m in range(num_meters):
-            meter_x = location[0] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
-            meter_y = location[1] + random.uniform(-blocks*block_size/3, blocks*block_size/3)
+            meter_x = location[0] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
+            meter_y = location[1] + rng.uniform(-blocks*block_size/3, blocks*block_size/3)
             
             # Place on sidewalk edge
-            sidewalk_offset = random.choice([-180, 180])
-            if random.random() > 0.5:
+            sidewalk_offset = rng.choice([-180, 180])
+            if rng.random() > 0.5:
                 meter_x += sidewalk_offset
             else:
                 meter_y += sidewalk_offset
@@ -672,8 +716,8 @@ def _create_street_utilities(blocks: int, block_size: float, location: List[floa
         # Fire hydrants at corners
         num_hydrants = blocks + 2
         for h in range(num_hydrants):
-            hydrant_x = location[0] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
-            hydrant_y = location[1] + random.uniform(-blocks*block_size/2, blocks*block_size/2)
+            hydrant_x = location[0] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
+            hydrant_y = location[1] + rng.uniform(-blocks*block_size/2, blocks*block_size/2)
             
             # Fire hydrant
             hydrant_name = f"{name_prefix}_Hydrant_{h}"
@@ -283,10 +283,51 @@ def clear_tower_blueprint_cache():
     _tower_blueprint_cache.clear()
     logger.info("Cleared tower blueprint cache")
 
+def get_or_create_tower_template(unreal, mesh: str, base_name: str = "TowerPiece") -> Optional[str]:
+    """
+    Get or create the uncolored template blueprint that colored tower pieces are duplicated from:
+    an Actor with a physics-enabled static mesh component named "Mesh".
+    
+    Returns:
+        Template blueprint name, or None on failure
+    """
+    cache_key = (mesh, None)
+    if cache_key in _tower_blueprint_cache:
+        return _tower_blueprint_cache[cache_key]
+    
+    template_name = f"{base_name}_Template_{abs(hash(mesh)) % 10000}_BP"
+    create_result = unreal.send_command("create_blueprint", {"name": template_name, "parent_class": "Actor"})
+    if create_result and "already exists" in create_result.get("error", "").lower():
+        logger.info(f"Template blueprint {template_name} already exists, reusing it")
+        _tower_blueprint_cache[cache_key] = template_name
+        return template_name
+    if not create_result or create_result.get("status") != "success":
+        logger.error(f"Failed to create template blueprint {template_name}: {(create_result or {}).get('error', 'Unknown error')}")
+        return None
+    
+    define_result = unreal.send_command("define_components", {
+        "blueprint_name": template_name,
+        "components": [{
+            "name": "Mesh",
+            "type": "StaticMeshComponent",
+            "static_mesh": mesh,
+            "physics": {"simulate_physics": True, "gravity_enabled": True, "mass": 1.0}
+        }]
+    })
+    if not define_result or define_result.get("status") != "success":
+        logger.warning(f"Failed to set up components of {template_name}")
+        return None
+    
+    _tower_blueprint_cache[cache_key] = template_name
+    logger.info(f"Created template blueprint {template_name} for mesh {mesh}")
+    return template_name
+
 def get_or_create_colored_blueprint(unreal, mesh: str, color: List[float], base_name: str = "TowerPiece") -> str:
     """
     Get or create a reusable colored blueprint for tower pieces.
     Uses a global cache to avoid creating duplicate blueprints for the same color.
+    Each color is a variant of one template blueprint per mesh, created in a single
+    create_blueprint_variant call without a recompile.
     
     Args:
         unreal: Unreal connection object
@@ -309,83 +350,33 @@ def get_or_create_colored_blueprint(unreal, mesh: str, color: List[float], base_
     
     logger.info(f"CACHE MISS: Creating new blueprint for color {color} -> {color_key}. Cache has {len(_tower_blueprint_cache)} entries.")
     
+    template_name = get_or_create_tower_template(unreal, mesh, base_name)
+    if not template_name:
+        return None
+    
     # Generate a stable, unique blueprint name for this color/mesh combination
     color_hash = abs(hash(cache_key)) % 10000
     bp_name = f"{base_name}_Color_{color_hash}_BP"
     
-    # Check if this blueprint already exists from a previous session
-    # If so, just use it and cache it - no need to create a new one
-    create_result = unreal.send_command("create_blueprint", {"name": bp_name, "parent_class": "Actor"})
-    
-    blueprint_exists = False
-    if create_result and create_result.get("status") == "success":
-        # Blueprint was created successfully
-        logger.info(f"Created new blueprint {bp_name}")
-    elif create_result and "already exists" in create_result.get("error", "").lower():
-        # Blueprint already exists from previous session - we can reuse it!
-        logger.info(f"Blueprint {bp_name} already exists, reusing it")
-        blueprint_exists = True
-    else:
-        # Some other error occurred
-        logger.error(f"Failed to create blueprint {bp_name}: {create_result.get('error', 'Unknown error')}")
-        return None
-    
-    # If blueprint already existed, just cache and return it
-    if blueprint_exists:
-        _tower_blueprint_cache[cache_key] = bp_name
-        logger.info(f"CACHED EXISTING: Reusing existing blueprint {bp_name} for color {color} -> {color_key}")
-        return bp_name
-    
-    # Set up the newly created blueprint
     try:
-        # Add mesh component
-        add_result = unreal.send_command("add_component_to_blueprint", {
-            "blueprint_name": bp_name,
-            "component_type": "StaticMeshComponent", 
-            "component_name": "Mesh"
+        # A blueprint left over from a previous session is reused as is
+        result = unreal.send_command("create_blueprint_variant", {
+            "template": template_name,
+            "name": bp_name,
+            "colors": {"Mesh": list(color)},
+            "reuse_existing": True
         })
-        if not add_result or not add_result.get("status") == "success":
-            logger.warning(f"Failed to add component to {bp_name}")
+        if not result or result.get("status") != "success":
+            logger.error(f"Failed to create blueprint {bp_name}: {(result or {}).get('error', 'Unknown error')}")
             return None
         
-        # Set mesh properties
-        mesh_result = unreal.send_command("set_static_mesh_properties", {
-            "blueprint_name": bp_name,
-            "component_name": "Mesh",
-            "static_mesh": mesh
-        })
-        if not mesh_result or not mesh_result.get("status") == "success":
-            logger.warning(f"Failed to set mesh properties for {bp_name}")
-        
-        # Set physics properties
-        physics_result = unreal.send_command("set_physics_properties", {
-            "blueprint_name": bp_name,
-            "component_name": "Mesh",
-            "simulate_physics": True,
-            "gravity_enabled": True,
-            "mass": 1.0
-        })
-        if not physics_result or not physics_result.get("status") == "success":
-            logger.warning(f"Failed to set physics properties for {bp_name}")
-        
-        # Apply color
-        color_result = unreal.send_command("set_mesh_material_color", {
-            "blueprint_name": bp_name,
-            "component_name": "Mesh",
-            "color": color,
-            "material_slot": 0
-        })
-        if not color_result or not color_result.get("status") == "success":
-            logger.warning(f"Failed to set color for {bp_name}")
-        
-        # Compile blueprint
-        compile_result = unreal.send_command("compile_blueprint", {"blueprint_name": bp_name})
-        if not compile_result or not compile_result.get("status") == "success":
-            logger.warning(f"Failed to compile blueprint {bp_name}")
+        variant = result.get("result", {})
+        if variant.get("errors"):
+            logger.warning(f"Overrides failed for {bp_name}: {variant['errors']}")
         
         # Cache the blueprint for reuse
         _tower_blueprint_cache[cache_key] = bp_name
-        logger.info(f"CACHED NEW: Created and cached new blueprint {bp_name} for color {color} -> {color_key}. Cache now has {len(_tower_blueprint_cache)} entries.")
+        logger.info(f"CACHED {'NEW' if variant.get('created') else 'EXISTING'}: blueprint {bp_name} for color {color} -> {color_key}. Cache now has {len(_tower_blueprint_cache)} entries.")
         
         return bp_name
         
@@ -415,7 +406,7 @@ def create_tower_blueprints_and_batch_spawn(
         Dict with success status and spawned actors list
     """
     try:
-        from helpers.actor_utilities import spawn_blueprint_actor
+        from helpers.actor_utilities import spawn_blueprint_actors
         
         logger.info(f"Creating tower with {len(tower_pieces)} pieces")
         spawned_actors = []
@@ -435,74 +426,25 @@ def create_tower_blueprints_and_batch_spawn(
             color = list(color_key)  # Convert back to list
             logger.info(f"Processing {len(pieces)} pieces with color {color}")
             
-            # Create blueprint for this color
-            color_hash = abs(hash(color_key)) % 10000
-            bp_name = f"{name_prefix}_Color_{color_hash}_BP"
-            
-            # Try to create blueprint (or reuse if exists)
-            create_result = unreal.send_command("create_blueprint", {"name": bp_name, "parent_class": "Actor"})
-            
-            blueprint_exists = False
-            if create_result and create_result.get("status") == "success":
-                logger.info(f"Created new blueprint {bp_name} for color {color}")
-                
-                # Set up the blueprint
-                # Add mesh component
-                unreal.send_command("add_component_to_blueprint", {
-                    "blueprint_name": bp_name,
-                    "component_type": "StaticMeshComponent", 
-                    "component_name": "Mesh"
-                })
-                
-                # Set mesh properties
-                unreal.send_command("set_static_mesh_properties", {
-                    "blueprint_name": bp_name,
-                    "component_name": "Mesh",
-                    "static_mesh": mesh
-                })
-                
-                # Set physics properties
-                unreal.send_command("set_physics_properties", {
-                    "blueprint_name": bp_name,
-                    "component_name": "Mesh",
-                    "simulate_physics": True,
-                    "gravity_enabled": True,
-                    "mass": 1.0
-                })
-                
-                # Apply color
-                unreal.send_command("set_mesh_material_color", {
-                    "blueprint_name": bp_name,
-                    "component_name": "Mesh",
-                    "color": color,
-                    "material_slot": 0
-                })
-                
-                # Compile blueprint
-                unreal.send_command("compile_blueprint", {"blueprint_name": bp_name})
-                
-            elif create_result and "already exists" in create_result.get("error", "").lower():
-                logger.info(f"Blueprint {bp_name} already exists, reusing it")
-                blueprint_exists = True
-            else:
-                logger.error(f"Failed to create blueprint {bp_name}: {create_result.get('error', 'Unknown error')}")
+            # Variant of the shared template for this color (or reuse if exists)
+            bp_name = get_or_create_colored_blueprint(unreal, mesh, color, name_prefix)
+            if not bp_name:
+                logger.error(f"Failed to create blueprint for color {color}")
                 continue
             
-            # Now spawn all pieces of this color using the same blueprint
+            # Now spawn all pieces of this color in one command, scale included in the transform
+            spawn_result = spawn_blueprint_actors(
+                unreal, bp_name,
+                [list(piece["location"]) + [0.0, 0.0, 0.0] + list(piece["scale"]) for piece in pieces],
+                names=[piece["name"] for piece in pieces]
+            )
             pieces_spawned = 0
-            for piece in pieces:
-                spawn_result = spawn_blueprint_actor(unreal, bp_name, piece["name"], piece["location"])
-                if spawn_result.get("status") == "success":
-                    # Set correct scale
-                    spawned_name = spawn_result.get("result", {}).get("name", piece["name"])
-                    unreal.send_command("set_actor_transform", {
-                        "name": spawned_name,
-                        "scale": piece["scale"]
-                    })
-                    spawned_actors.append(spawn_result)
+            if spawn_result.get("status") == "success":
+                for actor_name in filter(None, spawn_result.get("result", {}).get("actors", [])):
+                    spawned_actors.append({"status": "success", "result": {"name": actor_name}})
                     pieces_spawned += 1
-                else:
-                    logger.warning(f"Failed to spawn piece {piece['name']}")
+            else:
+                logger.warning(f"Failed to spawn pieces for color {color}: {spawn_result.get('error', spawn_result.get('message'))}")
             
             logger.info(f"Spawned {pieces_spawned}/{len(pieces)} pieces for color {color}")
         
@@ -0,0 +1,156 @@
+"""
+Wire codec for Unreal MCP responses.
+Decodes the length-prefixed frames a connection switches to after the
+"negotiate" command, including a small pure-Python MessagePack decoder
+so no extra dependency is needed.
+"""
+import json
+import struct
+import zlib
+from typing import Any, List, Tuple
+
+try:
+    import lz4.block as _lz4_block
+except ImportError:
+    _lz4_block = None
+
+# Flags byte that follows the 4-byte big-endian frame length
+FRAME_FLAG_MSGPACK = 0x01
+# Compressed payloads start with their 4-byte big-endian uncompressed size
+FRAME_FLAG_ZLIB = 0x02
+FRAME_FLAG_LZ4 = 0x04
+
+FRAME_HEADER_SIZE = 5
+
+
+class MessagePackError(ValueError):
+    """Raised when a MessagePack payload is malformed or uses an unsupported type."""
+
+
+def _unpack(data: bytes, pos: int) -> Tuple[Any, int]:
+    """Decode one value starting at pos. Returns (value, next position)."""
+    tag = data[pos]
+    pos += 1
+
+    # Fixed-size forms
+    if tag <= 0x7f:
+        return tag, pos
+    if tag >= 0xe0:
+        return tag - 0x100, pos
+    if 0xa0 <= tag <= 0xbf:
+        length = tag & 0x1f
+        return data[pos:pos + length].decode('utf-8'), pos + length
+    if 0x90 <= tag <= 0x9f:
+        return _unpack_array(data, pos, tag & 0x0f)
+    if 0x80 <= tag <= 0x8f:
+        return _unpack_map(data, pos, tag & 0x0f)
+
+    if tag == 0xc0:
+        return None, pos
+    if tag == 0xc2:
+        return False, pos
+    if tag == 0xc3:
+        return True, pos
+
+    # Numbers
+    if tag == 0xca:
+        return struct.unpack_from('>f', data, pos)[0], pos + 4
+    if tag == 0xcb:
+        return struct.unpack_from('>d', data, pos)[0], pos + 8
+    if tag in _INT_FORMATS:
+        fmt, size = _INT_FORMATS[tag]
+        return struct.unpack_from(fmt, data, pos)[0], pos + size
+
+    # Strings and binary
+    if tag in (0xd9, 0xda, 0xdb, 0xc4, 0xc5, 0xc6):
+        size = {0xd9: 1, 0xda: 2, 0xdb: 4, 0xc4: 1, 0xc5: 2, 0xc6: 4}[tag]
+        length = int.from_bytes(data[pos:pos + size], 'big')
+        pos += size
+        raw = data[pos:pos + length]
+        pos += length
+        if tag in (0xd9, 0xda, 0xdb):
+            return raw.decode('utf-8'), pos
+        return bytes(raw), pos
+
+    # Containers
+    if tag in (0xdc, 0xdd):
+        size = 2 if tag == 0xdc else 4
+        return _unpack_array(data, pos + size, int.from_bytes(data[pos:pos + size], 'big'))
+    if tag in (0xde, 0xdf):
+        size = 2 if tag == 0xde else 4
+        return _unpack_map(data, pos + size, int.from_bytes(data[pos:pos + size], 'big'))
+
+    raise MessagePackError(f"Unsupported MessagePack type 0x{tag:02x} at offset {pos - 1}")
+
+
+_INT_FORMATS = {
+    0xcc: ('>B', 1), 0xcd: ('>H', 2), 0xce: ('>I', 4), 0xcf: ('>Q', 8),
+    0xd0: ('>b', 1), 0xd1: ('>h', 2), 0xd2: ('>i', 4), 0xd3: ('>q', 8),
+}
+
+
+def _unpack_array(data: bytes, pos: int, count: int) -> Tuple[list, int]:
+    items = []
+    append = items.append
+    for _ in range(count):
+        value, pos = _unpack(data, pos)
+        append(value)
+    return items, pos
+
+
+def _unpack_map(data: bytes, pos: int, count: int) -> Tuple[dict, int]:
+    result = {}
+    for _ in range(count):
+        key, pos = _unpack(data, pos)
+        value, pos = _unpack(data, pos)
+        result[key] = value
+    return result, pos
+
+
+def unpackb(data: bytes) -> Any:
+    """Decode a complete MessagePack document."""
+    try:
+        value, pos = _unpack(data, 0)
+    except (IndexError, struct.error, UnicodeDecodeError) as e:
+        raise MessagePackError(f"Truncated or malformed MessagePack payload: {e}")
+    if pos != len(data):
+        raise MessagePackError(f"Trailing data after MessagePack document ({len(data) - pos} bytes)")
+    return value
+
+
+def parse_frame_header(header: bytes) -> Tuple[int, int]:
+    """Return (payload length, flags) from a 5-byte frame header."""
+    frame_length, flags = struct.unpack('>IB', header)
+    return frame_length - 1, flags
+
+
+def supported_compression() -> List[str]:
+    """Compression formats this client can decode, preferred first."""
+    return ["lz4", "zlib"] if _lz4_block is not None else ["zlib"]
+
+
+def decompress_payload(payload: bytes, flags: int) -> bytes:
+    """Undo frame compression, if any, and check the result against the size header."""
+    if not flags & (FRAME_FLAG_ZLIB | FRAME_FLAG_LZ4):
+        return payload
+
+    uncompressed_size = struct.unpack_from('>I', payload, 0)[0]
+    body = payload[4:]
+    if flags & FRAME_FLAG_LZ4:
+        if _lz4_block is None:
+            raise ValueError("Received an LZ4 frame but the lz4 package is not installed")
+        data = _lz4_block.decompress(body, uncompressed_size=uncompressed_size)
+    else:
+        data = zlib.decompress(body)
+
+    if len(data) != uncompressed_size:
+        raise ValueError(f"Decompressed {len(data)} bytes, frame header says {uncompressed_size}")
+    return data
+
+
+def decode_frame_payload(payload: bytes, flags: int) -> Any:
+    """Decode a frame payload according to its flags byte."""
+    payload = decompress_payload(payload, flags)
+    if flags & FRAME_FLAG_MSGPACK:
+        return unpackb(payload)
+    return json.loads(payload.decode('utf-8'))
@@ -5,7 +5,13 @@ A streamlined MCP server focused on advanced composition tools for Unreal Engine
 Contains only the advanced tools from the expanded MCP tool system to keep tool count manageable.
 """
 
+import asyncio
+import csv
+import functools
+import inspect
+import io
 import logging
+import os
 import socket
 import json
 import math
@@ -13,8 +19,8 @@ import struct
 import time
 import threading
 from contextlib import asynccontextmanager
-from typing import AsyncIterator, Dict, Any, Optional, List
-from mcp.server.fastmcp import FastMCP
+from typing import AsyncIterator, Dict, Any, Iterator, Optional, List
+from mcp.server.fastmcp import FastMCP, Context
 
 from helpers.infrastructure_creation import (
     _create_street_grid, _create_street_lights, _create_town_vehicles, _create_town_decorations,
@@ -35,9 +41,12 @@ from helpers.mansion_creation import (
     get_mansion_size_params, calculate_mansion_layout, build_mansion_main_structure,
     build_mansion_exterior, add_mansion_interior
 )
-from helpers.actor_utilities import spawn_blueprint_actor, get_blueprint_material_info
+from helpers.actor_utilities import (
+    spawn_blueprint_actor, spawn_blueprint_actors as spawn_blueprint_actors_helper, get_blueprint_material_info,
+    spawn_spline_mesh as spawn_spline_mesh_helper
+)
 from helpers.actor_name_manager import (
-    safe_spawn_actor, safe_delete_actor
+    safe_spawn_actor, safe_delete_actor, create_actor_group, attach_to_group, actor_group, current_group
 )
 from helpers.bridge_aqueduct_creation import (
     build_suspension_bridge_structure, build_aqueduct_structure
@@ -46,6 +55,8 @@ from helpers.bridge_aqueduct_creation import (
 # ============================================================================
 # Blueprint Node Graph Tools
 # ============================================================================
+from helpers import wire_codec
+from helpers.async_connection import AsyncUnrealConnection, ThreadedUnrealClient
 from helpers.blueprint_graph import node_manager
 from helpers.blueprint_graph import variable_manager
 from helpers.blueprint_graph import connector_manager
@@ -69,6 +80,19 @@ logger = logging.getLogger("UnrealMCP_Advanced")
 # Configuration
 UNREAL_HOST = "127.0.0.1"
 UNREAL_PORT = 55557
+# Response encoding to negotiate per connection: "json" (default) or "msgpack"
+UNREAL_ENCODING = os.environ.get("UNREAL_MCP_ENCODING", "json").lower()
+# Compression for large responses: "none" (default), "zlib", "lz4" or "auto" (best available)
+UNREAL_COMPRESSION = os.environ.get("UNREAL_MCP_COMPRESSION", "none").lower()
+
+def _resolve_compression(compression: str) -> str:
+    """Map "auto" to the best available codec and unavailable codecs to "none"."""
+    if compression == "auto":
+        return wire_codec.supported_compression()[0]
+    if compression not in ("none", *wire_codec.supported_compression()):
+        logger.warning(f"Compression '{compression}' is not available; responses will be uncompressed")
+        return "none"
+    return compression
 
 class UnrealConnection:
     """
@@ -77,6 +101,7 @@ class UnrealConnection:
     Features:
     - Exponential backoff retry for connection attempts
     - Automatic reconnection on failure
+    - Reuses one negotiated socket across commands while it is in use
     - Configurable timeouts per command type
     - Thread-safe operations
     - Detailed logging for debugging
@@ -89,6 +114,7 @@ class UnrealConnection:
     CONNECT_TIMEOUT = 10    # seconds
     DEFAULT_RECV_TIMEOUT = 30  # seconds
     LARGE_OP_RECV_TIMEOUT = 300  # seconds for large operations
+    IDLE_REUSE_LIMIT = 15   # seconds an idle socket is reused before reconnecting; the plugin drops silent ones
     BUFFER_SIZE = 8192
     
     # Commands that need longer timeouts
@@ -99,7 +125,13 @@ class UnrealConnection:
         "construct_mansion",
         "create_suspension_bridge",
         "create_aqueduct",
-        "create_maze"
+        "create_maze",
+        "upsert_datatable_rows",
+        "save_dirty_packages",
+        "spawn_blueprint_actors",
+        "run_generator",
+        "create_material_instances",
+        "wait_for_shader_compiles"
     }
     
     def __init__(self):
@@ -108,6 +140,10 @@ class UnrealConnection:
         self.connected = False
         self._lock = threading.RLock()  # RLock allows reentrant acquisition for retry logic
         self._last_error = None
+        self.encoding = UNREAL_ENCODING
+        self.compression = _resolve_compression(UNREAL_COMPRESSION)
+        self._framed = False  # whether the open socket was negotiated to length-prefixed frames
+        self._last_used = 0.0
     
     def _create_socket(self) -> socket.socket:
         """Create and configure a new socket."""
@@ -192,6 +228,7 @@ class UnrealConnection:
                 pass
             self.socket = None
         self.connected = False
+        self._last_used = 0.0
     
     def disconnect(self):
         """Safely disconnect from Unreal Engine."""
@@ -199,11 +236,12 @@ class UnrealConnection:
             self._close_socket_unsafe()
             logger.debug("Disconnected from Unreal Engine")
 
-    def _get_timeout_for_command(self, command_type: str) -> int:
+    @classmethod
+    def _get_timeout_for_command(cls, command_type: str) -> int:
         """Get appropriate timeout for command type."""
-        if any(large_cmd in command_type for large_cmd in self.LARGE_OPERATION_COMMANDS):
-            return self.LARGE_OP_RECV_TIMEOUT
-        return self.DEFAULT_RECV_TIMEOUT
+        if any(large_cmd in command_type for large_cmd in cls.LARGE_OPERATION_COMMANDS):
+            return cls.LARGE_OP_RECV_TIMEOUT
+        return cls.DEFAULT_RECV_TIMEOUT
 
     def _receive_response(self, command_type: str) -> bytes:
         """
@@ -293,6 +331,73 @@ class UnrealConnection:
         
         raise ConnectionError("Connection closed without response")
 
+    def _negotiate_connection(self, sock: socket.socket) -> bool:
+        """
+        Ask the server to answer the rest of this connection in self.encoding,
+        compressing large responses with self.compression.
+        
+        The reply itself is still plain JSON. Falls back to uncompressed JSON
+        for the rest of the session if the server rejects the options.
+        
+        Returns:
+            True if responses on this socket are now length-prefixed frames
+        """
+        if self.encoding == "json" and self.compression == "none":
+            return False
+        
+        negotiate_params = {"encoding": self.encoding}
+        if self.compression != "none":
+            negotiate_params["compression"] = self.compression
+        
+        sock.settimeout(10)
+        sock.sendall(json.dumps({"type": "negotiate", "params": negotiate_params}).encode('utf-8'))
+        
+        data = b''
+        while True:
+            chunk = sock.recv(self.BUFFER_SIZE)
+            if not chunk:
+                raise ConnectionError("Connection closed during encoding negotiation")
+            data += chunk
+            try:
+                reply = json.loads(data.decode('utf-8'))
+                break
+            except (json.JSONDecodeError, UnicodeDecodeError):
+                continue
+        
+        # Refused because every plugin worker is taken; not a verdict on the encoding
+        if str(reply.get("error", "")).startswith("Server busy"):
+            raise ConnectionError(reply["error"])
+        
+        if reply.get("status") != "success":
+            logger.warning(f"Server rejected encoding '{self.encoding}'/compression '{self.compression}' "
+                           f"({reply.get('error')}); using uncompressed json")
+            self.encoding = "json"
+            self.compression = "none"
+            return False
+        
+        return reply.get("result", {}).get("framing") == "length_prefixed"
+
+    def _receive_frame(self, sock: socket.socket, command_type: str) -> Any:
+        """
+        Receive and decode one length-prefixed frame (4-byte big-endian length, flags byte, payload).
+        """
+        sock.settimeout(self._get_timeout_for_command(command_type))
+        header = self._recv_exact(sock, wire_codec.FRAME_HEADER_SIZE)
+        payload_size, flags = wire_codec.parse_frame_header(header)
+        payload = self._recv_exact(sock, payload_size)
+        logger.info(f"Received {payload_size} byte frame (flags=0x{flags:02x}) for {command_type}")
+        return wire_codec.decode_frame_payload(payload, flags)
+
+    def _recv_exact(self, sock: socket.socket, size: int) -> bytes:
+        """Read exactly size bytes from the socket."""
+        buffer = bytearray()
+        while len(buffer) < size:
+            chunk = sock.recv(min(size - len(buffer), self.BUFFER_SIZE * 8))
+            if not chunk:
+                raise ConnectionError(f"Connection closed mid-frame ({len(buffer)}/{size} bytes)")
+            buffer += chunk
+        return bytes(buffer)
+
     def send_command(self, command: str, params: Dict[str, Any] = None) -> Optional[Dict[str, Any]]:
         """
         Send a command to Unreal Engine with automatic retry.
@@ -328,6 +433,97 @@ class UnrealConnection:
         
         return {"status": "error", "error": f"Command failed after {self.MAX_RETRIES + 1} attempts: {last_error}"}
 
+    def send_command_stream(self, command: str, params: Dict[str, Any] = None,
+                            chunk_size: Optional[int] = None) -> Iterator[Dict[str, Any]]:
+        """
+        Send a command in streaming mode and yield frames as they arrive.
+        
+        Top-level arrays of the result arrive as item frames
+        {"stream": "items", "field": ..., "items": [...]}; the last frame yielded
+        is the usual response envelope, marked "stream": "end", whose result has
+        a "streamed" map of item counts in place of the arrays.
+        
+        Uses its own socket, so other commands are not blocked while the caller
+        consumes the stream. Retries only apply before the first frame arrives.
+        
+        Args:
+            command: Command type string
+            params: Command parameters dictionary
+            chunk_size: Maximum items per frame (server default when None)
+            
+        Yields:
+            Frame dictionaries
+        """
+        command_obj = {"type": command, "params": params or {}, "stream": True}
+        if chunk_size:
+            command_obj["stream_chunk_size"] = int(chunk_size)
+        
+        sock = None
+        framed = False
+        for attempt in range(self.MAX_RETRIES + 1):
+            try:
+                sock = self._create_socket()
+                sock.connect((UNREAL_HOST, UNREAL_PORT))
+                framed = self._negotiate_connection(sock)
+                sock.settimeout(10)
+                sock.sendall(json.dumps(command_obj).encode('utf-8'))
+                break
+            except (ConnectionError, socket.error, OSError) as e:
+                logger.warning(f"Stream connect failed (attempt {attempt + 1}/{self.MAX_RETRIES + 1}): {e}")
+                if sock:
+                    sock.close()
+                    sock = None
+                if attempt < self.MAX_RETRIES:
+                    time.sleep(min(self.BASE_RETRY_DELAY * (2 ** attempt), self.MAX_RETRY_DELAY))
+        
+        if sock is None:
+            yield {"status": "error", "error": f"Failed to connect to Unreal Engine for {command}", "stream": "end"}
+            return
+        
+        try:
+            if framed:
+                while True:
+                    frame = self._receive_frame(sock, command)
+                    yield frame
+                    if frame.get("stream") == "end":
+                        return
+            
+            sock.settimeout(self._get_timeout_for_command(command))
+            pending = b''
+            while True:
+                chunk = sock.recv(self.BUFFER_SIZE * 8)
+                if not chunk:
+                    raise ConnectionError(f"Connection closed before end of stream for {command}")
+                pending += chunk
+                
+                while b'\n' in pending:
+                    line, pending = pending.split(b'\n', 1)
+                    if not line.strip():
+                        continue
+                    frame = json.loads(line.decode('utf-8'))
+                    yield frame
+                    if frame.get("stream") == "end":
+                        return
+        finally:
+            try:
+                sock.close()
+            except OSError:
+                pass
+
+    def send_command_streamed_items(self, command: str, params: Dict[str, Any] = None,
+                                    chunk_size: Optional[int] = None) -> Iterator[Any]:
+        """
+        Yield individual result items from a streamed command, ignoring which field they belong to.
+        
+        Raises:
+            RuntimeError: If the final frame reports an error
+        """
+        for frame in self.send_command_stream(command, params, chunk_size):
+            if frame.get("stream") == "items":
+                yield from frame.get("items", [])
+            elif frame.get("status") == "error":
+                raise RuntimeError(frame.get("error", "Unknown error"))
+
     def _send_command_once(self, command: str, params: Dict[str, Any], attempt: int) -> Dict[str, Any]:
         """
         Send command once (internal method).
@@ -347,11 +543,17 @@ class UnrealConnection:
         # where another thread could close/reconnect the socket mid-operation.
         # RLock allows nested acquisition from connect()/disconnect() calls.
         with self._lock:
-            # Connect (or reconnect)
-            if not self.connect():
-                raise ConnectionError(f"Failed to connect to Unreal Engine: {self._last_error}")
+            # Reuse the negotiated socket while it is fresh; the plugin closes idle connections
+            if not self.connected or time.monotonic() - self._last_used > self.IDLE_REUSE_LIMIT:
+                if not self.connect():
+                    raise ConnectionError(f"Failed to connect to Unreal Engine: {self._last_error}")
             
             try:
+                if self._last_used == 0.0:
+                    self._framed = self._negotiate_connection(self.socket)
+                    self._last_used = time.monotonic()
+                framed = self._framed
+                
                 # Build and send command
                 command_obj = {
                     "type": command,
@@ -367,19 +569,25 @@ class UnrealConnection:
                 self.socket.sendall(command_json.encode('utf-8'))
                 
                 # Receive response
-                response_data = self._receive_response(command)
-                
-                # Parse response
-                try:
-                    response = json.loads(response_data.decode('utf-8'))
-                except json.JSONDecodeError as e:
-                    logger.error(f"JSON decode error: {e}")
-                    logger.debug(f"Raw response: {response_data[:500]}")
-                    raise ValueError(f"Invalid JSON response: {e}")
+                if framed:
+                    response = self._receive_frame(self.socket, command)
+                else:
+                    response_data = self._receive_response(command)
+                    
+                    # Parse response
+                    try:
+                        response = json.loads(response_data.decode('utf-8'))
+                    except json.JSONDecodeError as e:
+                        logger.error(f"JSON decode error: {e}")
+                        logger.debug(f"Raw response: {response_data[:500]}")
+                        raise ValueError(f"Invalid JSON response: {e}")
                 
                 logger.info(f"Command {command} completed successfully")
+                self._last_used = time.monotonic()
                 
                 # Normalize error responses
+                if str(response.get("error", "")).startswith("Server busy"):
+                    raise ConnectionError(response["error"])
                 if response.get("status") == "error":
                     error_msg = response.get("error") or response.get("message", "Unknown error")
                     logger.warning(f"Unreal returned error: {error_msg}")
@@ -390,27 +598,37 @@ class UnrealConnection:
                 
                 return response
                 
-            finally:
-                # Always clean up connection after command
+            except BaseException:
+                # A failed or timed-out exchange may leave a late response on the socket
                 self._close_socket_unsafe()
+                raise
 
 # Global connection instance (singleton pattern)
 _unreal_connection: Optional[UnrealConnection] = None
 _connection_lock = threading.Lock()
 
-def get_unreal_connection() -> UnrealConnection:
+# Pipelined client on the server's event loop, created by server_lifespan
+_async_connection: Optional[AsyncUnrealConnection] = None
+_threaded_client: Optional[ThreadedUnrealClient] = None
+
+def get_unreal_connection():
     """
     Get the global Unreal connection instance.
     
-    Uses lazy initialization - connection is created on first access.
-    The connection handles its own retry logic, so we don't need to
-    pre-connect here.
+    Tools run on worker threads while the server is up; they get a blocking
+    client that multiplexes over the shared async connection pool, so
+    concurrent tool calls don't wait for each other. Otherwise (e.g. on the
+    event loop thread or when used as a library) this is the lazily created
+    UnrealConnection, which handles its own retry logic.
     
     Returns:
-        UnrealConnection instance (always returns an instance, never None)
+        A client with send_command/send_command_stream (never None)
     """
     global _unreal_connection
     
+    if _threaded_client is not None and not _threaded_client.on_loop_thread:
+        return _threaded_client
+    
     with _connection_lock:
         if _unreal_connection is None:
             logger.info("Creating new UnrealConnection instance")
@@ -418,6 +636,17 @@ def get_unreal_connection() -> UnrealConnection:
         return _unreal_connection
 
 
+def get_async_connection() -> AsyncUnrealConnection:
+    """Get the pipelined client for async tools; call from the server's event loop."""
+    global _async_connection
+    
+    if _async_connection is None:
+        _async_connection = AsyncUnrealConnection(
+            UNREAL_HOST, UNREAL_PORT, UNREAL_ENCODING, _resolve_compression(UNREAL_COMPRESSION),
+            timeout_for_command=UnrealConnection._get_timeout_for_command)
+    return _async_connection
+
+
 def reset_unreal_connection():
     """Reset the global connection (useful for error recovery)."""
     global _unreal_connection
@@ -431,12 +660,17 @@ def reset_unreal_connection():
 @asynccontextmanager
 async def server_lifespan(server: FastMCP) -> AsyncIterator[Dict[str, Any]]:
     """Handle server startup and shutdown."""
+    global _async_connection, _threaded_client
     logger.info("UnrealMCP Advanced server starting up")
     logger.info("Connection will be established lazily on first tool call")
 
+    _threaded_client = ThreadedUnrealClient(get_async_connection(), asyncio.get_running_loop())
     try:
         yield {}
     finally:
+        _threaded_client = None
+        await _async_connection.close()
+        _async_connection = None
         reset_unreal_connection()
         logger.info("Unreal MCP Advanced server shut down")
 
@@ -446,53 +680,226 @@ mcp = FastMCP(
     lifespan=server_lifespan
 )
 
+def unreal_tool():
+    """
+    Register a tool. Synchronous tools are registered through a wrapper that runs
+    them on a worker thread, so a slow call doesn't block the event loop and the
+    other tool calls in flight. The function itself is returned unchanged, so
+    helpers can still call it directly.
+    """
+    def decorator(fn):
+        if inspect.iscoroutinefunction(fn):
+            return mcp.tool()(fn)
+        
+        @functools.wraps(fn)
+        async def run_in_thread(*args, **kwargs):
+            return await asyncio.to_thread(fn, *args, **kwargs)
+        
+        mcp.tool()(run_in_thread)
+        return fn
+    return decorator
+
+def actor_grouped(fn):
+    """
+    Run a builder with every part it spawns attached under one group actor.
+    The builder declares `group` and `folder` parameters; when group is set the
+    group actor is created at the builder's `location` (or reused if it exists)
+    and folder places it in the outliner. The whole structure can then be moved
+    with set_actor_transform, hidden with set_actor_hidden and removed with
+    delete_actor(include_attached=True) on the group.
+    """
+    signature = inspect.signature(fn)
+    doc = (fn.__doc__ or "").rstrip() + (
+        "\n\n    Pass group to attach every part under a group actor of that name (created at location"
+        "\n    if needed) so the structure moves, hides and deletes as one; folder sets its outliner folder.\n    ")
+    
+    def group_arguments(args, kwargs):
+        bound = signature.bind(*args, **kwargs)
+        bound.apply_defaults()
+        return bound.arguments.get("group"), bound.arguments.get("location"), bound.arguments.get("folder")
+    
+    if inspect.iscoroutinefunction(fn):
+        @functools.wraps(fn)
+        async def run_grouped_async(*args, **kwargs):
+            group, location, folder = group_arguments(args, kwargs)
+            if group and not await asyncio.to_thread(create_actor_group, get_unreal_connection(), group, location, folder):
+                group = None
+            with attach_to_group(group):
+                return await fn(*args, **kwargs)
+        run_grouped_async.__doc__ = doc
+        return run_grouped_async
+    
+    @functools.wraps(fn)
+    def run_grouped(*args, **kwargs):
+        group, location, folder = group_arguments(args, kwargs)
+        with actor_group(get_unreal_connection(), group, location, folder):
+            return fn(*args, **kwargs)
+    run_grouped.__doc__ = doc
+    return run_grouped
+
+def _actor_filter_params(group: str, class_name: str, folder: str, tags: Optional[List[str]]) -> Dict[str, Any]:
+    """The actor query filters that are set, as command params."""
+    params = {"group": group, "class_name": class_name, "folder": folder, "tags": tags}
+    return {key: value for key, value in params.items() if value}
+
 # Essential Actor Management Tools
-@mcp.tool()
-def get_actors_in_level(random_string: str = "") -> Dict[str, Any]:
-    """Get a list of all actors in the current level."""
+@unreal_tool()
+async def get_actors_in_level(
+    random_string: str = "",
+    include_bounds: bool = False,
+    group: str = "",
+    class_name: str = "",
+    folder: str = "",
+    tags: List[str] = None
+) -> Dict[str, Any]:
+    """Get a list of all actors in the current level.
+
+    Served from the editor's actor snapshot, so it answers even while the editor is busy.
+    Set include_bounds to also return each actor's world-space bounding box, and group
+    to list only the actors attached under that group actor. class_name (matching
+    subclasses too, e.g. "Light"), folder (with its subfolders) and tags (all required)
+    are answered from the snapshot's indexes instead of a scan.
+    """
+    try:
+        params = {"include_bounds": True} if include_bounds else {}
+        params.update(_actor_filter_params(group, class_name, folder, tags))
+        response = await get_async_connection().send_command("get_actors_in_level", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_actors_in_level error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+async def find_actors_by_name(
+    pattern: str,
+    include_bounds: bool = False,
+    group: str = "",
+    class_name: str = "",
+    folder: str = "",
+    tags: List[str] = None
+) -> Dict[str, Any]:
+    """Find actors by name pattern, optionally narrowed by group, class_name, folder and tags
+    as in get_actors_in_level."""
+    try:
+        params = {"pattern": pattern}
+        if include_bounds:
+            params["include_bounds"] = True
+        params.update(_actor_filter_params(group, class_name, folder, tags))
+        response = await get_async_connection().send_command("find_actors_by_name", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"find_actors_by_name error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+
+@unreal_tool()
+def delete_actor(name: str, include_attached: bool = False) -> Dict[str, Any]:
+    """Delete an actor by name. With include_attached, everything attached under it
+    (e.g. all parts of a group) is deleted in the same call."""
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
     
     try:
-        response = unreal.send_command("get_actors_in_level", {})
-        return response or {"success": False, "message": "No response from Unreal"}
+        # Use the safe delete function to update tracking
+        response = safe_delete_actor(unreal, name, include_attached)
+        return response
     except Exception as e:
-        logger.error(f"get_actors_in_level error: {e}")
+        logger.error(f"delete_actor error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
-def find_actors_by_name(pattern: str) -> Dict[str, Any]:
-    """Find actors by name pattern."""
+@unreal_tool()
+def spawn_spline_mesh(
+    name: str,
+    points: List[List[float]],
+    static_mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    width: float = 0.0,
+    height: float = 0.0,
+    curve_type: str = "curve",
+    closed: bool = False,
+    segment_length: float = 0.0,
+    align: str = "center",
+    forward_axis: str = "x",
+    material: str = "",
+    collision: bool = True,
+    parent: str = "",
+    folder: str = ""
+) -> Dict[str, Any]:
+    """Spawn one actor with a mesh deformed along a spline through world-space points.
+
+    Use it for long continuous structures - walls, roads, pipes, cables - instead of
+    placing hundreds of blocks. width/height set the cross-section in cm (0 keeps the
+    mesh's size). curve_type "curve" passes smoothly through the points, "linear" makes
+    straight runs with corners; closed joins the ends. segment_length splits the spline
+    into mesh pieces of about that length (default: one piece per pair of points).
+    align "bottom" rests the mesh on the spline (walls, roads), "center" centers it
+    (cables). forward_axis is the mesh's long axis, e.g. "z" for the engine cylinder.
+    parent defaults to the current group.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    return spawn_spline_mesh_helper(unreal, name, points, static_mesh, width, height, curve_type, closed,
+                                    segment_length, align, forward_axis, material or None, collision,
+                                    parent=parent or None, folder=folder or None)
+
+@unreal_tool()
+def create_group(
+    name: str,
+    location: List[float] = None,
+    rotation: List[float] = None,
+    folder: str = ""
+) -> Dict[str, Any]:
+    """Create an empty group actor to attach parts under (pass it as parent/group to spawns and builders).
+
+    Moving the group with set_actor_transform moves every attached part, set_actor_hidden
+    hides them all, and delete_actor(include_attached=True) removes the whole structure.
+    folder places the group in a World Outliner folder, e.g. "Generated/Castles".
+    """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
     
     try:
-        response = unreal.send_command("find_actors_by_name", {"pattern": pattern})
+        params = {"name": name}
+        if location is not None:
+            params["location"] = location
+        if rotation is not None:
+            params["rotation"] = rotation
+        if folder:
+            params["folder"] = folder
+        response = unreal.send_command("create_group", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
-        logger.error(f"find_actors_by_name error: {e}")
+        logger.error(f"create_group error: {e}")
         return {"success": False, "message": str(e)}
 
+@unreal_tool()
+def set_actor_hidden(
+    name: str,
+    hidden: bool = True,
+    include_attached: bool = True,
+    in_game: bool = False
+) -> Dict[str, Any]:
+    """Hide or show an actor and, by default, everything attached under it, in the editor viewport.
 
-
-@mcp.tool()
-def delete_actor(name: str) -> Dict[str, Any]:
-    """Delete an actor by name."""
+    With in_game the hidden-in-game flag is set too, which is saved with the level.
+    """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
     
     try:
-        # Use the safe delete function to update tracking
-        response = safe_delete_actor(unreal, name)
-        return response
+        params = {"name": name, "hidden": hidden, "include_attached": include_attached, "in_game": in_game}
+        response = unreal.send_command("set_actor_hidden", params)
+        return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
-        logger.error(f"delete_actor error: {e}")
+        logger.error(f"set_actor_hidden error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def set_actor_transform(
     name: str,
     location: List[float] = None,
@@ -519,8 +926,331 @@ def set_actor_transform(
         logger.error(f"set_actor_transform error: {e}")
         return {"success": False, "message": str(e)}
 
+@unreal_tool()
+def get_properties(
+    paths: List[str],
+    actors: List[str] = None,
+    blueprints: List[str] = None
+) -> Dict[str, Any]:
+    """Read dotted property paths from many actors and/or Blueprint class defaults in one call.
+
+    Paths walk nested structs, array elements and object references, e.g.
+    "StaticMeshComponent.BodyInstance.bSimulatePhysics", "Tags[0]" or "RootComponent.RelativeScale3D".
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"paths": paths}
+        if actors:
+            params["actors"] = actors
+        if blueprints:
+            params["blueprints"] = blueprints
+        response = unreal.send_command("get_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def set_properties(
+    properties: Dict[str, Any],
+    actors: List[str] = None,
+    blueprints: List[str] = None
+) -> Dict[str, Any]:
+    """Apply property values to many actors and/or Blueprint class defaults in one undoable step.
+
+    properties maps dotted paths to values, e.g. {"StaticMeshComponent.CastShadow": false,
+    "StaticMeshComponent.Mobility": "Movable"}. Vectors and rotators are [X, Y, Z] lists.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"properties": properties}
+        if actors:
+            params["actors"] = actors
+        if blueprints:
+            params["blueprints"] = blueprints
+        response = unreal.send_command("set_properties", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"set_properties error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def upsert_datatable_rows(
+    table: str,
+    rows: Any = None,
+    csv_text: str = "",
+    replace: bool = False,
+    chunk_size: int = 2000
+) -> Dict[str, Any]:
+    """Add or update DataTable rows in chunks, one editor change notification per chunk.
+
+    rows is {"RowName": {"Field": value}} or a list of {"name": ..., "fields": {...}}
+    row objects (the export_datatable JSON format); csv_text is CSV with a header row whose first
+    column is the row name. Fields left out keep their current value. With replace,
+    existing rows are removed first, unless none of the first chunk's rows decode.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        chunk_size = max(1, int(chunk_size))
+        chunks = []
+        if rows:
+            if isinstance(rows, list):
+                rows = {row["name"]: row.get("fields", {}) for row in rows}
+            items = list(rows.items())
+            for start in range(0, len(items), chunk_size):
+                chunks.append({"rows": dict(items[start:start + chunk_size])})
+        if csv_text:
+            records = list(csv.reader(io.StringIO(csv_text)))
+            header, body = records[0], records[1:]
+            for start in range(0, max(len(body), 1), chunk_size):
+                out = io.StringIO()
+                csv.writer(out, lineterminator="\n").writerows([header] + body[start:start + chunk_size])
+                chunks.append({"csv": out.getvalue()})
+        if not chunks:
+            chunks.append({})
+        
+        totals = {"added": 0, "updated": 0, "failed": 0}
+        errors = []
+        result = {}
+        for index, chunk in enumerate(chunks):
+            params = {"table": table, **chunk}
+            if replace and index == 0:
+                params["replace"] = True
+            response = unreal.send_command("upsert_datatable_rows", params)
+            if not response or response.get("status") == "error":
+                return response or {"success": False, "message": "No response from Unreal"}
+            result = response.get("result", {})
+            for key in totals:
+                totals[key] += result.get(key, 0)
+            errors.extend(result.get("errors", []))
+        
+        return {"success": True, "table": result.get("table", table), "row_count": result.get("row_count"),
+                "chunks": len(chunks), **totals, "errors": errors}
+    except Exception as e:
+        logger.error(f"upsert_datatable_rows error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def export_datatable(table: str, format: str = "json", offset: int = 0, limit: int = 0) -> Dict[str, Any]:
+    """Export DataTable rows as JSON row objects ({"name": ..., "fields": {...}}) or CSV text; use offset/limit to page through large tables."""
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"table": table, "format": format, "offset": offset, "limit": limit}
+        if format == "json":
+            # Rows arrive in chunks instead of one large response
+            rows = []
+            final = None
+            for frame in unreal.send_command_stream("export_datatable", params):
+                if frame.get("stream") == "items":
+                    rows.extend(frame.get("items", []))
+                else:
+                    final = frame
+            if not final or final.get("status") == "error":
+                return final or {"success": False, "message": "No response from Unreal"}
+            result = dict(final.get("result", {}))
+            result.pop("streamed", None)
+            result["rows"] = rows
+            return {"status": "success", "result": result}
+        response = unreal.send_command("export_datatable", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"export_datatable error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def save_dirty_packages(
+    path_prefix: str = "",
+    created_this_session: bool = False,
+    include_content: bool = True,
+    include_maps: bool = True,
+    concurrent: bool = False,
+    dry_run: bool = False
+) -> Dict[str, Any]:
+    """Save dirty assets and maps in one batch and report per-package timings and sizes.
+
+    Filter with path_prefix (e.g. "/Game/Generated") and/or created_this_session (packages
+    never saved to disk). concurrent serializes asset packages in parallel; dry_run only
+    lists what would be saved.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {
+            "created_this_session": created_this_session,
+            "include_content": include_content,
+            "include_maps": include_maps,
+            "concurrent": concurrent,
+            "dry_run": dry_run
+        }
+        if path_prefix:
+            params["path_prefix"] = path_prefix
+        response = unreal.send_command("save_dirty_packages", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"save_dirty_packages error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+async def get_editor_stats(collect_garbage: bool = False) -> Dict[str, Any]:
+    """Report editor memory use (MB), actor and UObject counts, and engine/plugin versions.
+
+    Set collect_garbage to run a full GC first so memory figures are comparable between calls.
+    """
+    try:
+        params = {"collect_garbage": True} if collect_garbage else {}
+        response = await get_async_connection().send_command("get_editor_stats", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_editor_stats error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def search_assets(
+    query: str = "",
+    classes: List[str] = None,
+    path_prefix: str = "",
+    limit: int = 20
+) -> Dict[str, Any]:
+    """Find assets by fuzzy name/path match, best matches first.
+
+    Use this before loading meshes, materials or Blueprints by path. classes keeps only
+    exact asset classes (e.g. ["StaticMesh"], ["Material", "MaterialInstanceConstant"]);
+    path_prefix restricts the search to a folder such as "/Game/Props".
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"query": query, "limit": limit}
+        if classes:
+            params["classes"] = classes
+        if path_prefix:
+            params["path_prefix"] = path_prefix
+        response = unreal.send_command("search_assets", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"search_assets error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def generate_mesh(
+    shapes: List[Dict[str, Any]],
+    asset_path: str,
+    material: str = "",
+    collision: str = "complex",
+    overwrite: bool = False,
+    actor_name: str = "",
+    location: List[float] = None,
+    rotation: List[float] = None,
+    parent: str = "",
+    folder: str = ""
+) -> Dict[str, Any]:
+    """Build solid shapes into one mesh in the editor and bake it to a static mesh asset.
+
+    Each shape is {"type": ..., "location", "rotation", "scale", "operation"}, combined in
+    order with operation "union" (default), "subtract" or "append" (no boolean). Types and
+    their fields, all in cm, each shape resting on Z=0 centered on its footprint:
+    - box: size [X, Y, Z]
+    - cylinder: radius, height, segments
+    - pyramid: size [X, Y, Height], steps (0 for smooth sides, N for stepped tiers)
+    - stairs: steps, step_width, step_height, step_depth (rising towards +X)
+    - arch: span (inner width), thickness, depth, leg_height, segments (spanning X)
+
+    collision is "complex" (the mesh itself), "box" or "none". With actor_name the mesh is
+    also placed as a StaticMeshActor at location/rotation (reusing an actor of that name),
+    attached to parent (default: the current group) and filed under folder. One actor
+    replaces the hundreds of cubes the block builders spawn.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"shapes": shapes, "asset_path": asset_path, "collision": collision, "overwrite": overwrite}
+        if material:
+            params["material"] = material
+        if actor_name:
+            params["actor_name"] = actor_name
+            parent = parent or current_group()
+            optional = {"location": location, "rotation": rotation, "parent": parent, "folder": folder}
+            params.update({key: value for key, value in optional.items() if value})
+        response = unreal.send_command("generate_mesh", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"generate_mesh error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+async def create_material_instances(
+    instances: List[Dict[str, Any]],
+    path: str = "",
+    parent: str = "",
+    wait: bool = False,
+    timeout: float = 300.0
+) -> Dict[str, Any]:
+    """Create or update many material instances in one batch without stalling on shaders.
+
+    Each instance is {"name", "parent", "scalars": {Name: value}, "vectors": {Name: [R, G, B, A]},
+    "textures": {Name: texture path}, "switches": {Name: bool}}; name is a full asset path or a
+    name under path (default /Game/Materials/Instances), parent defaults to the batch's parent.
+    Parameter names are checked against the parent. Only static switches need new shaders: each
+    distinct parent and switch set is compiled once, in the background, and the call returns
+    without waiting unless wait is set. Use get_shader_compile_status / wait_for_shader_compiles
+    to schedule around the compiles, e.g. before saving or taking screenshots.
+    """
+    try:
+        params = {"instances": instances, "wait": wait, "timeout": timeout}
+        if path:
+            params["path"] = path
+        if parent:
+            params["parent"] = parent
+        response = await get_async_connection().send_command("create_material_instances", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"create_material_instances error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+async def get_shader_compile_status() -> Dict[str, Any]:
+    """Report outstanding shader compile jobs (remaining_jobs) and assets still compiling."""
+    try:
+        response = await get_async_connection().send_command("get_shader_compile_status", {})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_shader_compile_status error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+async def wait_for_shader_compiles(timeout: float = 300.0) -> Dict[str, Any]:
+    """Wait until outstanding shader compiles finish, or timeout seconds pass.
+
+    Returns finished (false if it timed out), waited_seconds and the remaining job counts.
+    Call it once after a batch of material work instead of letting later commands hitch.
+    """
+    try:
+        response = await get_async_connection().send_command("wait_for_shader_compiles", {"timeout": timeout})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"wait_for_shader_compiles error: {e}")
+        return {"success": False, "message": str(e)}
+
 # Essential Blueprint Tools for Physics Actors
-@mcp.tool()
+@unreal_tool()
 def create_blueprint(name: str, parent_class: str) -> Dict[str, Any]:
     """Create a new Blueprint class."""
     unreal = get_unreal_connection()
@@ -538,7 +1268,7 @@ def create_blueprint(name: str, parent_class: str) -> Dict[str, Any]:
         logger.error(f"create_blueprint error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def add_component_to_blueprint(
     blueprint_name: str,
     component_type: str,
@@ -569,7 +1299,40 @@ def add_component_to_blueprint(
         logger.error(f"add_component_to_blueprint error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+def define_components(
+    blueprint_name: str,
+    components: List[Dict[str, Any]],
+    replace: bool = False,
+    compile: bool = True
+) -> Dict[str, Any]:
+    """Build or update a Blueprint's whole component tree in one call, with one compile.
+
+    Each component is {"name", "type", "parent", "location", "rotation", "scale",
+    "static_mesh", "material" or "materials", "physics": {"simulate_physics",
+    "gravity_enabled", "mass", "linear_damping", "angular_damping", "collision_profile"},
+    "properties": {"Property.Path": value}}. Parents must come before their children;
+    components that already exist are updated in place and need no type. With replace,
+    the Blueprint's existing components are removed first.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {
+            "blueprint_name": blueprint_name,
+            "components": components,
+            "replace": replace,
+            "compile": compile
+        }
+        response = unreal.send_command("define_components", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"define_components error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
 def set_static_mesh_properties(
     blueprint_name: str,
     component_name: str,
@@ -592,7 +1355,7 @@ def set_static_mesh_properties(
         logger.error(f"set_static_mesh_properties error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def set_physics_properties(
     blueprint_name: str,
     component_name: str,
@@ -623,7 +1386,7 @@ def set_physics_properties(
         logger.error(f"set_physics_properties error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
     """Compile a Blueprint."""
     unreal = get_unreal_connection()
@@ -638,7 +1401,74 @@ def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
         logger.error(f"compile_blueprint error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+def create_blueprint_variant(
+    template: str,
+    name: str,
+    components: Dict[str, Dict[str, Any]] = None,
+    defaults: Dict[str, Any] = None,
+    colors: Dict[str, List[float]] = None,
+    path: str = "/Game/Blueprints",
+    reuse_existing: bool = False,
+    compile: bool = False
+) -> Dict[str, Any]:
+    """Duplicate a template Blueprint and apply overrides in one call, without recompiling.
+
+    components maps component names to dotted property paths, e.g.
+    {"Mesh": {"StaticMesh": "/Engine/BasicShapes/Sphere.Sphere", "BodyInstance.bSimulatePhysics": false}};
+    defaults sets class default properties the same way; colors maps primitive components
+    to [R, G, B, A] for their material's BaseColor. Overriding a component inherited from a
+    parent Blueprint compiles the copy. With reuse_existing, an existing Blueprint of that name
+    is returned unchanged and the result carries a warning if overrides were given.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"template": template, "name": name, "path": path,
+                  "reuse_existing": reuse_existing, "compile": compile}
+        if components:
+            params["components"] = components
+        if defaults:
+            params["defaults"] = defaults
+        if colors:
+            params["colors"] = colors
+        response = unreal.send_command("create_blueprint_variant", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"create_blueprint_variant error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def spawn_blueprint_actors(
+    blueprint_name: str,
+    transforms: List[List[float]],
+    names: List[str] = None,
+    name_prefix: str = None,
+    properties: Dict[str, Any] = None,
+    overrides: List[Dict[str, Any]] = None,
+    parent: str = "",
+    folder: str = ""
+) -> Dict[str, Any]:
+    """Spawn many instances of a Blueprint in one call.
+
+    transforms has one row per instance: [x, y, z], [x, y, z, pitch, yaw, roll] or
+    [x, y, z, pitch, yaw, roll, sx, sy, sz]. properties (for every instance) and
+    overrides (one dict or None per instance) map property paths, e.g. expose-on-spawn
+    variables, to values; they are applied before the construction script runs.
+    parent attaches every instance under a group actor, folder sets their outliner folder.
+    Returns actors with one entry per transform: the spawned name, or None where that
+    instance failed to spawn or attach (see errors).
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    return spawn_blueprint_actors_helper(unreal, blueprint_name, transforms, names, name_prefix, properties, overrides,
+                                         parent or None, folder or None)
+
+@unreal_tool()
 def read_blueprint_content(
     blueprint_path: str,
     include_event_graph: bool = True,
@@ -696,7 +1526,7 @@ def read_blueprint_content(
         logger.error(f"read_blueprint_content error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def open_asset_in_editor(asset_path: str) -> Dict[str, Any]:
     """
     Open any asset in the Unreal Editor UI.
@@ -724,7 +1554,7 @@ def open_asset_in_editor(asset_path: str) -> Dict[str, Any]:
         logger.error(f"open_asset_in_editor error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def analyze_blueprint_graph(
     blueprint_path: str,
     graph_name: str = "EventGraph",
@@ -777,7 +1607,7 @@ def analyze_blueprint_graph(
         logger.error(f"analyze_blueprint_graph error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def get_blueprint_variable_details(
     blueprint_path: str,
     variable_name: str = None
@@ -814,7 +1644,7 @@ def get_blueprint_variable_details(
         logger.error(f"get_blueprint_variable_details error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def get_blueprint_function_details(
     blueprint_path: str,
     function_name: str = None,
@@ -857,16 +1687,48 @@ def get_blueprint_function_details(
 
 
 # Advanced Composition Tools
-@mcp.tool()
+GENERATED_MESH_PATH = "/Game/Generated/Meshes"
+
+def _build_single_mesh(name_prefix: str, shapes: List[Dict[str, Any]], location: List[float]) -> Dict[str, Any]:
+    """Bake a builder's shapes into SM_<name_prefix> and place it as one actor named name_prefix."""
+    response = generate_mesh(
+        shapes,
+        f"{GENERATED_MESH_PATH}/SM_{name_prefix}",
+        overwrite=True,
+        actor_name=name_prefix,
+        location=location
+    )
+    result = response.get("result", response)
+    if response.get("status") == "error" or "actor" not in result:
+        return {"success": False, "message": response.get("error") or response.get("message", "generate_mesh failed")}
+    return {"success": True, "actors": [result["actor"]], "mesh": result["asset_path"], "triangles": result["triangles"]}
+
+@unreal_tool()
+@actor_grouped
 def create_pyramid(
     base_size: int = 3,
     block_size: float = 100.0,
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "PyramidBlock",
-    mesh: str = "/Engine/BasicShapes/Cube.Cube"
+    mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    group: str = "",
+    folder: str = "",
+    single_mesh: bool = False
 ) -> Dict[str, Any]:
-    """Spawn a pyramid made of cube actors."""
+    """Spawn a pyramid made of cube actors.
+
+    With single_mesh the stepped pyramid is generated as one static mesh actor instead
+    (see generate_mesh), occupying the same space as the cubes.
+    """
     try:
+        if single_mesh:
+            size = base_size * block_size
+            return _build_single_mesh(name_prefix, [{
+                "type": "pyramid",
+                "size": [size, size, size],
+                "steps": base_size,
+                "location": [0.0, 0.0, -block_size / 2]
+            }], location)
         unreal = get_unreal_connection()
         if not unreal:
             return {"success": False, "message": "Failed to connect to Unreal Engine"}
@@ -897,7 +1759,8 @@ def create_pyramid(
         logger.error(f"create_pyramid error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_wall(
     length: int = 5,
     height: int = 2,
@@ -905,7 +1768,9 @@ def create_wall(
     location: List[float] = [0.0, 0.0, 0.0],
     orientation: str = "x",
     name_prefix: str = "WallBlock",
-    mesh: str = "/Engine/BasicShapes/Cube.Cube"
+    mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """Create a simple wall from cubes."""
     try:
@@ -936,7 +1801,8 @@ def create_wall(
         logger.error(f"create_wall error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_tower(
     height: int = 10,
     base_size: int = 4,
@@ -944,7 +1810,9 @@ def create_tower(
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "TowerBlock",
     mesh: str = "/Engine/BasicShapes/Cube.Cube",
-    tower_style: str = "cylindrical"  # "cylindrical", "square", "tapered"
+    tower_style: str = "cylindrical",  # "cylindrical", "square", "tapered"
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """Create a realistic tower with various architectural styles."""
     try:
@@ -1012,6 +1880,8 @@ def create_tower(
                             "scale": [scale, scale, scale],
                             "static_mesh": mesh
                         }
+                        if current_group():
+                            params["parent"] = current_group()
                         resp = unreal.send_command("spawn_actor", params)
                         if resp:
                             spawned.append(resp)
@@ -1047,6 +1917,8 @@ def create_tower(
                             "scale": [scale, scale, scale],
                             "static_mesh": mesh
                         }
+                        if current_group():
+                            params["parent"] = current_group()
                         resp = unreal.send_command("spawn_actor", params)
                         if resp:
                             spawned.append(resp)
@@ -1076,21 +1948,38 @@ def create_tower(
         logger.error(f"create_tower error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_staircase(
     steps: int = 5,
     step_size: List[float] = [100.0, 100.0, 50.0],
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "Stair",
-    mesh: str = "/Engine/BasicShapes/Cube.Cube"
+    mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    group: str = "",
+    folder: str = "",
+    single_mesh: bool = False
 ) -> Dict[str, Any]:
-    """Create a staircase from cubes."""
+    """Create a staircase from cubes.
+
+    With single_mesh the staircase is generated as one solid static mesh actor instead
+    (see generate_mesh), with the same treads as the cubes and filled underneath.
+    """
     try:
+        sx, sy, sz = step_size
+        if single_mesh:
+            return _build_single_mesh(name_prefix, [{
+                "type": "stairs",
+                "steps": steps,
+                "step_width": sy,
+                "step_height": sz,
+                "step_depth": sx,
+                "location": [(steps - 1) * sx / 2, 0.0, -sz / 2]
+            }], location)
         unreal = get_unreal_connection()
         if not unreal:
             return {"success": False, "message": "Failed to connect to Unreal Engine"}
         spawned = []
-        sx, sy, sz = step_size
         for i in range(steps):
             actor_name = f"{name_prefix}_{i}"
             loc = [location[0] + i * sx, location[1], location[2] + i * sz]
@@ -1110,7 +1999,8 @@ def create_staircase(
         logger.error(f"create_staircase error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def construct_house(
     width: int = 1200,
     depth: int = 1000,
@@ -1118,7 +2008,9 @@ def construct_house(
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "House",
     mesh: str = "/Engine/BasicShapes/Cube.Cube",
-    house_style: str = "modern"  # "modern", "cottage"
+    house_style: str = "modern",  # "modern", "cottage"
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """Construct a realistic house with architectural details and multiple rooms."""
     try:
@@ -1135,11 +2027,14 @@ def construct_house(
 
 
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def construct_mansion(
     mansion_scale: str = "large",  # "small", "large", "epic", "legendary"
     location: List[float] = [0.0, 0.0, 0.0],
-    name_prefix: str = "Mansion"
+    name_prefix: str = "Mansion",
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """
     Construct a magnificent mansion with multiple wings, grand rooms, gardens,
@@ -1189,22 +2084,39 @@ def construct_mansion(
         logger.error(f"construct_mansion error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_arch(
     radius: float = 300.0,
     segments: int = 6,
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "ArchBlock",
-    mesh: str = "/Engine/BasicShapes/Cube.Cube"
+    mesh: str = "/Engine/BasicShapes/Cube.Cube",
+    group: str = "",
+    folder: str = "",
+    single_mesh: bool = False
 ) -> Dict[str, Any]:
-    """Create a simple arch using cubes in a semicircle."""
+    """Create a simple arch using cubes in a semicircle.
+
+    With single_mesh a smooth, continuous arch of the same radius and block thickness is
+    generated as one static mesh actor instead (see generate_mesh).
+    """
     try:
+        scale = radius / 300.0 / 2
+        if single_mesh:
+            thickness = scale * 100.0
+            return _build_single_mesh(name_prefix, [{
+                "type": "arch",
+                "span": 2 * radius - thickness,
+                "thickness": thickness,
+                "depth": thickness,
+                "segments": max(12, segments * 4)
+            }], location)
         unreal = get_unreal_connection()
         if not unreal:
             return {"success": False, "message": "Failed to connect to Unreal Engine"}
         spawned = []
         angle_step = math.pi / segments
-        scale = radius / 300.0 / 2
         for i in range(segments + 1):
             theta = angle_step * i
             x = radius * math.cos(theta)
@@ -1225,7 +2137,7 @@ def create_arch(
         logger.error(f"create_arch error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def spawn_physics_blueprint_actor (
     name: str,
     mesh_path: str = "/Engine/BasicShapes/Cube.Cube",
@@ -1251,9 +2163,19 @@ def spawn_physics_blueprint_actor (
     try:
         bp_name = f"{name}_BP"
         create_blueprint(bp_name, "Actor")
-        add_component_to_blueprint(bp_name, "StaticMeshComponent", "Mesh", scale=scale)
-        set_static_mesh_properties(bp_name, "Mesh", mesh_path)
-        set_physics_properties(bp_name, "Mesh", simulate_physics, gravity_enabled, mass)
+        define_components(bp_name, [{
+            "name": "Mesh",
+            "type": "StaticMeshComponent",
+            "scale": scale,
+            "static_mesh": mesh_path,
+            "physics": {
+                "simulate_physics": simulate_physics,
+                "gravity_enabled": gravity_enabled,
+                "mass": mass,
+                "linear_damping": 0.01,
+                "angular_damping": 0
+            }
+        }], compile=False)
 
         # Set color if provided
         if color is not None:
@@ -1286,13 +2208,16 @@ def spawn_physics_blueprint_actor (
         logger.error(f"spawn_physics_blueprint_actor  error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_maze(
     rows: int = 8,
     cols: int = 8,
     cell_size: float = 300.0,
     wall_height: int = 3,
-    location: List[float] = [0.0, 0.0, 0.0]
+    location: List[float] = [0.0, 0.0, 0.0],
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """Create a proper solvable maze with entrance, exit, and guaranteed path using recursive backtracking algorithm."""
     try:
@@ -1395,7 +2320,7 @@ def create_maze(
         logger.error(f"create_maze error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def get_available_materials(
     search_path: str = "/Game/",
     include_engine_materials: bool = True
@@ -1416,7 +2341,7 @@ def get_available_materials(
         logger.error(f"get_available_materials error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def apply_material_to_actor(
     actor_name: str,
     material_path: str,
@@ -1439,7 +2364,7 @@ def apply_material_to_actor(
         logger.error(f"apply_material_to_actor error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def apply_material_to_blueprint(
     blueprint_name: str,
     component_name: str,
@@ -1464,7 +2389,7 @@ def apply_material_to_blueprint(
         logger.error(f"apply_material_to_blueprint error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def get_actor_material_info(
     actor_name: str
 ) -> Dict[str, Any]:
@@ -1481,7 +2406,7 @@ def get_actor_material_info(
         logger.error(f"get_actor_material_info error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def set_mesh_material_color(
     blueprint_name: str,
     component_name: str,
@@ -1544,24 +2469,139 @@ def set_mesh_material_color(
         logger.error(f"set_mesh_material_color error: {e}")
         return {"success": False, "message": str(e)}
 
+@unreal_tool()
+async def run_generator(
+    generator: str,
+    arguments: Dict[str, Any] = None,
+    reload: bool = False,
+    ctx: Context = None
+) -> Dict[str, Any]:
+    """Run a scene generator inside the editor instead of from this server.
+
+    The same builder code runs in the editor's Python, so each part is a function call
+    rather than a socket round trip and static mesh parts are spawned without JSON.
+    generator is "castle", "town", "mansion", "house", "bridge", "aqueduct" or "maze"
+    (taking the arguments of create_castle_fortress, create_town, construct_mansion,
+    construct_house, create_suspension_bridge, create_aqueduct and create_maze), or a
+    name a project script registered. Progress is reported while it runs.
+    Needs the Python Editor Script Plugin, and GeneratorScriptRoot under [UnrealMCP] in the
+    project's DefaultEditor.ini pointing at this server's folder, which the builders are
+    loaded from; set reload after editing them.
+    """
+    params = {"generator": generator, "arguments": arguments or {}, "reload": reload}
+    try:
+        # Streamed, so the editor sends progress frames while the generator runs
+        items: Dict[str, List[Any]] = {}
+        final = None
+        async for frame in get_async_connection().send_command_stream("run_generator", params):
+            kind = frame.get("stream")
+            if kind == "progress":
+                if ctx is not None:
+                    await ctx.report_progress(frame.get("done", 0), frame.get("total") or None)
+            elif kind == "items":
+                items.setdefault(frame.get("field"), []).extend(frame.get("items", []))
+            else:
+                final = frame
+        
+        if not final or final.get("status") != "success":
+            return {"success": False, "message": (final or {}).get("error", "No response from Unreal")}
+        result = dict(final.get("result", {}))
+        result.pop("streamed", None)
+        result.update(items)
+        return result
+    except Exception as e:
+        logger.error(f"run_generator error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def execute_pcg_graph(
+    name: str,
+    graph: str = "",
+    location: List[float] = None,
+    size: List[float] = None,
+    parameters: Dict[str, Any] = None,
+    seed: int = None,
+    generate: bool = True,
+    parent: str = "",
+    folder: str = ""
+) -> Dict[str, Any]:
+    """Start generating a PCG graph on a volume, for scattering at high volume.
+
+    The engine's PCG framework samples and instances in parallel, so one call can place
+    thousands of meshes that would otherwise be separate spawns. name is a PCG volume
+    (created at location with size [X, Y, Z] in cm if missing) or any actor with a PCG
+    component. graph is the PCG graph asset path, needed the first time. parameters sets
+    the graph's user parameters by name ({"Density": 0.5, "Offset": [0, 0, 100]});
+    seed sets the component seed. Returns as soon as generation has started, with
+    generating true; poll get_pcg_generation_status(name) until generating is false to read
+    output points, mesh instances per mesh and spawned actors. With generate false nothing is
+    regenerated and the status of the last generation is reported. parent defaults to the
+    current group.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        params = {"name": name, "generate": generate}
+        optional = {"graph": graph, "location": location, "size": size, "parameters": parameters,
+                    "parent": parent or current_group(), "folder": folder}
+        params.update({key: value for key, value in optional.items() if value})
+        if seed is not None:
+            params["seed"] = seed
+        response = unreal.send_command("execute_pcg_graph", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"execute_pcg_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+@unreal_tool()
+def get_pcg_generation_status(name: str, cancel: bool = False) -> Dict[str, Any]:
+    """Report whether the PCG volume name is still generating, with its counts once done.
+
+    Poll after execute_pcg_graph until generating is false; cancel stops a generation
+    that is still running.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    
+    try:
+        response = unreal.send_command("get_pcg_generation_status", {"name": name, "cancel": cancel})
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_pcg_generation_status error: {e}")
+        return {"success": False, "message": str(e)}
+
 # Advanced Town Generation System
-@mcp.tool()
-def create_town(
+@unreal_tool()
+@actor_grouped
+async def create_town(
     town_size: str = "medium",  # "small", "medium", "large", "metropolis"
     building_density: float = 0.7,  # 0.0 to 1.0
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "Town",
     include_infrastructure: bool = True,
-    architectural_style: str = "mixed"  # "modern", "cottage", "mansion", "mixed", "downtown", "futuristic"
+    architectural_style: str = "mixed",  # "modern", "cottage", "mansion", "mixed", "downtown", "futuristic"
+    seed: Optional[int] = None,
+    use_splines: bool = False,
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
-    """Create a full dynamic town with buildings, streets, infrastructure, and vehicles."""
+    """Create a full dynamic town with buildings, streets, infrastructure, and vehicles.
+
+    Pass a seed to get the same town every time. Set use_splines to lay each street and
+    sidewalk as one spline mesh actor instead of a block per segment.
+    """
     try:
         import random
-        random.seed()  # Use different seed each time for variety
+        # Different town each time unless a seed is given. Each phase draws from its own generator,
+        # seeded from this one in a fixed order, so the concurrent phases stay reproducible and the
+        # process-wide random state other tools use is left alone
+        town_rng = random.Random(seed)
         
-        unreal = get_unreal_connection()
-        if not unreal:
-            return {"success": False, "message": "Failed to connect to Unreal Engine"}
+        def phase_rng() -> random.Random:
+            return random.Random(town_rng.getrandbits(64))
         
         logger.info(f"Creating {town_size} town with {building_density} density at {location}")
         
@@ -1580,113 +2620,95 @@ def create_town(
         target_population = int(params["population"] * building_density)
         skyscraper_chance = params["skyscraper_chance"]
         
-        all_spawned = []
         street_width = block_size * 0.3
         building_area = block_size * 0.7
         
-        # Create street grid first
-        logger.info("Creating street grid...")
-        street_results = _create_street_grid(blocks, block_size, street_width, location, name_prefix)
-        all_spawned.extend(street_results.get("actors", []))
-        
-        # Create buildings in each block
-        logger.info("Placing buildings...")
-        building_count = 0
-        for block_x in range(blocks):
-            for block_y in range(blocks):
-                if building_count >= target_population:
-                    break
+        def place_buildings(rng: random.Random) -> Dict[str, Any]:
+            """Create buildings in each block."""
+            actors = []
+            building_count = 0
+            for block_x in range(blocks):
+                for block_y in range(blocks):
+                    if building_count >= target_population:
+                        break
+                        
+                    # Skip some blocks randomly for variety
+                    if rng.random() > building_density:
+                        continue
                     
-                # Skip some blocks randomly for variety
-                if random.random() > building_density:
-                    continue
-                
-                block_center_x = location[0] + (block_x - blocks/2) * block_size
-                block_center_y = location[1] + (block_y - blocks/2) * block_size
-                
-                # Randomly choose building type based on style and location
-                if architectural_style == "downtown" or architectural_style == "futuristic":
-                    building_types = ["skyscraper", "office_tower", "apartment_complex", "shopping_mall", "parking_garage", "hotel"]
-                elif architectural_style == "mixed":
-                    # Central blocks get taller buildings
-                    is_central = abs(block_x - blocks//2) <= 1 and abs(block_y - blocks//2) <= 1
-                    if is_central and random.random() < skyscraper_chance:
-                        building_types = ["skyscraper", "office_tower", "apartment_complex", "hotel", "shopping_mall"]
+                    block_center_x = location[0] + (block_x - blocks/2) * block_size
+                    block_center_y = location[1] + (block_y - blocks/2) * block_size
+                    
+                    # Randomly choose building type based on style and location
+                    if architectural_style == "downtown" or architectural_style == "futuristic":
+                        building_types = ["skyscraper", "office_tower", "apartment_complex", "shopping_mall", "parking_garage", "hotel"]
+                    elif architectural_style == "mixed":
+                        # Central blocks get taller buildings
+                        is_central = abs(block_x - blocks//2) <= 1 and abs(block_y - blocks//2) <= 1
+                        if is_central and rng.random() < skyscraper_chance:
+                            building_types = ["skyscraper", "office_tower", "apartment_complex", "hotel", "shopping_mall"]
+                        else:
+                            building_types = ["house", "tower", "mansion", "commercial", "apartment_building", "restaurant", "store"]
                     else:
-                        building_types = ["house", "tower", "mansion", "commercial", "apartment_building", "restaurant", "store"]
-                else:
-                    building_types = [architectural_style] * 3 + ["commercial", "restaurant", "store"]
-                
-                building_type = random.choice(building_types)
-                
-                # Create building with variety
-                building_result = _create_town_building(
-                    building_type, 
-                    [block_center_x, block_center_y, location[2]],
-                    building_area,
-                    max_height,
-                    f"{name_prefix}_Building_{block_x}_{block_y}",
-                    building_count
-                )
-                
-                if building_result.get("status") == "success":
-                    all_spawned.extend(building_result.get("actors", []))
-                    building_count += 1
+                        building_types = [architectural_style] * 3 + ["commercial", "restaurant", "store"]
+                    
+                    building_type = rng.choice(building_types)
+                    
+                    # Create building with variety
+                    building_result = _create_town_building(
+                        building_type, 
+                        [block_center_x, block_center_y, location[2]],
+                        building_area,
+                        max_height,
+                        f"{name_prefix}_Building_{block_x}_{block_y}",
+                        building_count,
+                        rng
+                    )
+                    
+                    if building_result.get("status") == "success":
+                        actors.extend(building_result.get("actors", []))
+                        building_count += 1
+            return {"actors": actors, "count": building_count}
+        
+        # The phases build disjoint sets of actors, so they are issued concurrently:
+        # each runs on its own worker thread over the shared connection pool
+        logger.info("Creating street grid and placing buildings...")
+        phases = [
+            (_create_street_grid, blocks, block_size, street_width, location, name_prefix, use_splines),
+            (place_buildings, phase_rng())
+        ]
         
         # Add infrastructure if requested
-        infrastructure_count = 0
         if include_infrastructure:
             logger.info("Adding infrastructure...")
-            
-            # Street lights
-            light_results = _create_street_lights(blocks, block_size, location, name_prefix)
-            all_spawned.extend(light_results.get("actors", []))
-            infrastructure_count += len(light_results.get("actors", []))
-            
-            # Vehicles
-            vehicle_results = _create_town_vehicles(blocks, block_size, street_width, location, name_prefix, target_population // 3)
-            all_spawned.extend(vehicle_results.get("actors", []))
-            infrastructure_count += len(vehicle_results.get("actors", []))
-            
-            # Parks and decorations
-            decoration_results = _create_town_decorations(blocks, block_size, location, name_prefix)
-            all_spawned.extend(decoration_results.get("actors", []))
-            infrastructure_count += len(decoration_results.get("actors", []))
-            
-            
-            # Add advanced infrastructure
-            logger.info("Adding advanced infrastructure...")
-            
-            # Traffic lights at intersections
-            traffic_results = _create_traffic_lights(blocks, block_size, location, name_prefix)
-            all_spawned.extend(traffic_results.get("actors", []))
-            infrastructure_count += len(traffic_results.get("actors", []))
-            
-            # Street signs and billboards
-            signage_results = _create_street_signage(blocks, block_size, location, name_prefix, town_size)
-            all_spawned.extend(signage_results.get("actors", []))
-            infrastructure_count += len(signage_results.get("actors", []))
-            
-            # Sidewalks and crosswalks
-            sidewalk_results = _create_sidewalks_crosswalks(blocks, block_size, street_width, location, name_prefix)
-            all_spawned.extend(sidewalk_results.get("actors", []))
-            infrastructure_count += len(sidewalk_results.get("actors", []))
-            
-            # Urban furniture (benches, trash cans, bus stops)
-            furniture_results = _create_urban_furniture(blocks, block_size, location, name_prefix)
-            all_spawned.extend(furniture_results.get("actors", []))
-            infrastructure_count += len(furniture_results.get("actors", []))
-            
-            # Parking meters and hydrants
-            utility_results = _create_street_utilities(blocks, block_size, location, name_prefix)
-            all_spawned.extend(utility_results.get("actors", []))
-            infrastructure_count += len(utility_results.get("actors", []))
-            
+            phases += [
+                # Street lights, vehicles, parks and decorations
+                (_create_street_lights, blocks, block_size, location, name_prefix, phase_rng()),
+                (_create_town_vehicles, blocks, block_size, street_width, location, name_prefix, target_population // 3, phase_rng()),
+                (_create_town_decorations, blocks, block_size, location, name_prefix, phase_rng()),
+                # Traffic lights at intersections, street signs and billboards
+                (_create_traffic_lights, blocks, block_size, location, name_prefix),
+                (_create_street_signage, blocks, block_size, location, name_prefix, town_size, phase_rng()),
+                # Sidewalks, crosswalks and urban furniture (benches, trash cans, bus stops)
+                (_create_sidewalks_crosswalks, blocks, block_size, street_width, location, name_prefix, use_splines),
+                (_create_urban_furniture, blocks, block_size, location, name_prefix, phase_rng()),
+                # Parking meters and hydrants
+                (_create_street_utilities, blocks, block_size, location, name_prefix, phase_rng())
+            ]
             # Add plaza/square in center for large towns
             if town_size in ["large", "metropolis"]:
-                plaza_results = _create_central_plaza(blocks, block_size, location, name_prefix)
-                all_spawned.extend(plaza_results.get("actors", []))
-                infrastructure_count += len(plaza_results.get("actors", []))
+                phases.append((_create_central_plaza, blocks, block_size, location, name_prefix))
+        
+        phase_results = await asyncio.gather(*(asyncio.to_thread(*phase) for phase in phases))
+        street_results, building_results, *infrastructure_results = phase_results
+        
+        all_spawned = list(street_results.get("actors", []))
+        all_spawned.extend(building_results["actors"])
+        building_count = building_results["count"]
+        infrastructure_count = 0
+        for results in infrastructure_results:
+            all_spawned.extend(results.get("actors", []))
+            infrastructure_count += len(results.get("actors", []))
         
         return {
             "success": True,
@@ -1708,19 +2730,25 @@ def create_town(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_castle_fortress(
     castle_size: str = "large",  # "small", "medium", "large", "epic"
     location: List[float] = [0.0, 0.0, 0.0],
     name_prefix: str = "Castle",
     include_siege_weapons: bool = True,
     include_village: bool = True,
-    architectural_style: str = "medieval"  # "medieval", "fantasy", "gothic"
+    architectural_style: str = "medieval",  # "medieval", "fantasy", "gothic"
+    use_splines: bool = False,
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """
     Create a massive castle fortress with walls, towers, courtyards, throne room,
     and surrounding village. Perfect for dramatic TikTok reveals showing
     the scale and detail of a complete medieval fortress.
+    Set use_splines to build the outer walls as one spline mesh actor instead of
+    a block every 200 units.
     """
     try:
         unreal = get_unreal_connection()
@@ -1735,7 +2763,7 @@ def create_castle_fortress(
         dimensions = calculate_scaled_dimensions(params, scale_factor=2.0)
         
         # Build castle components using helper functions
-        build_outer_bailey_walls(unreal, name_prefix, location, dimensions, all_actors)
+        build_outer_bailey_walls(unreal, name_prefix, location, dimensions, all_actors, use_splines)
         build_inner_bailey_walls(unreal, name_prefix, location, dimensions, all_actors)
         build_gate_complex(unreal, name_prefix, location, dimensions, all_actors)
         build_corner_towers(unreal, name_prefix, location, dimensions, architectural_style, all_actors)
@@ -1778,7 +2806,8 @@ def create_castle_fortress(
         logger.error(f"create_castle_fortress error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_suspension_bridge(
     span_length: float = 6000.0,
     deck_width: float = 800.0,
@@ -1792,7 +2821,10 @@ def create_suspension_bridge(
     tower_mesh: str = "/Engine/BasicShapes/Cube.Cube",
     cable_mesh: str = "/Engine/BasicShapes/Cylinder.Cylinder",
     suspender_mesh: str = "/Engine/BasicShapes/Cylinder.Cylinder",
-    dry_run: bool = False
+    dry_run: bool = False,
+    use_splines: bool = False,
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """
     Build a suspension bridge with towers, deck, cables, and suspenders.
@@ -1815,6 +2847,8 @@ def create_suspension_bridge(
         cable_mesh: Mesh for cable segments
         suspender_mesh: Mesh for vertical suspenders
         dry_run: If True, calculate metrics without spawning
+        use_splines: Build each main cable and the deck as one spline mesh actor
+            (see spawn_spline_mesh) instead of a block per module
     
     Returns:
         Dictionary with success status, spawned actors, and performance metrics
@@ -1836,6 +2870,8 @@ def create_suspension_bridge(
             expected_towers = 10  # 2 towers with main, base, top, and 2 attachment points each
             expected_deck = max(1, int(span_length / module_size)) * max(1, int(deck_width / module_size))
             expected_cables = 2 * max(1, int(span_length / module_size))  # 2 main cables
+            if use_splines:
+                expected_deck, expected_cables = 1, 2
             expected_suspenders = 2 * max(1, int(span_length / (module_size * 3)))  # Every 3 modules
             
             elapsed_ms = int((time.perf_counter() - start_time) * 1000)
@@ -1871,7 +2907,8 @@ def create_suspension_bridge(
             tower_mesh,
             cable_mesh,
             suspender_mesh,
-            all_actors
+            all_actors,
+            use_splines
         )
         
         # Calculate metrics
@@ -1901,7 +2938,8 @@ def create_suspension_bridge(
         logger.error(f"create_suspension_bridge error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
+@actor_grouped
 def create_aqueduct(
     arches: int = 18,
     arch_radius: float = 600.0,
@@ -1915,7 +2953,9 @@ def create_aqueduct(
     arch_mesh: str = "/Engine/BasicShapes/Cylinder.Cylinder",
     pier_mesh: str = "/Engine/BasicShapes/Cube.Cube",
     deck_mesh: str = "/Engine/BasicShapes/Cube.Cube",
-    dry_run: bool = False
+    dry_run: bool = False,
+    group: str = "",
+    folder: str = ""
 ) -> Dict[str, Any]:
     """
     Build a multi-tier Roman-style aqueduct with arches and water channel.
@@ -2040,7 +3080,7 @@ def create_aqueduct(
 # Blueprint Node Graph Tool
 # ============================================================================
 
-@mcp.tool()
+@unreal_tool()
 def add_node(
     blueprint_name: str,
     node_type: str,
@@ -2158,7 +3198,7 @@ def add_node(
         logger.error(f"add_node error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def connect_nodes(
     blueprint_name: str,
     source_node_id: str,
@@ -2203,7 +3243,7 @@ def connect_nodes(
         logger.error(f"connect_nodes error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def create_variable(
     blueprint_name: str,
     variable_name: str,
@@ -2251,7 +3291,7 @@ def create_variable(
         logger.error(f"create_variable error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def set_blueprint_variable_properties(
     blueprint_name: str,
     variable_name: str,
@@ -2421,7 +3461,7 @@ def set_blueprint_variable_properties(
         logger.error(f"set_blueprint_variable_properties error: {e}")
         return {"success": False, "message": str(e)}
 
-@mcp.tool()
+@unreal_tool()
 def add_event_node(
     blueprint_name: str,
     event_name: str,
@@ -2462,7 +3502,7 @@ def add_event_node(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def delete_node(
     blueprint_name: str,
     node_id: str,
@@ -2499,7 +3539,7 @@ def delete_node(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def set_node_property(
     blueprint_name: str,
     node_id: str,
@@ -2634,7 +3674,7 @@ def set_node_property(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def create_function(
     blueprint_name: str,
     function_name: str,
@@ -2668,7 +3708,7 @@ def create_function(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def add_function_input(
     blueprint_name: str,
     function_name: str,
@@ -2708,7 +3748,7 @@ def add_function_input(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def add_function_output(
     blueprint_name: str,
     function_name: str,
@@ -2748,7 +3788,7 @@ def add_function_output(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def delete_function(
     blueprint_name: str,
     function_name: str
@@ -2779,7 +3819,7 @@ def delete_function(
         return {"success": False, "message": str(e)}
 
 
-@mcp.tool()
+@unreal_tool()
 def rename_function(
     blueprint_name: str,
     old_function_name: str,
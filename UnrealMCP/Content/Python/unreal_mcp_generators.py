@@ -0,0 +1,261 @@
+"""
+In-editor host for the MCP server's scene generators.
+
+The run_generator command runs run() here, in the editor's Python. It imports the
+builders from the MCP server's Python folder (GeneratorScriptRoot in the editor config,
+passed along as the request's script_root) and hands
+them an EditorConnection in place of the TCP client, so every command they send is
+a function call into the plugin, and static mesh spawns skip JSON altogether.
+Progress is reported after every command and reaches streamed run_generator
+requests as {"stream": "progress", ...} frames.
+
+Project scripts can add their own generators:
+    import unreal_mcp_generators
+    unreal_mcp_generators.register_generator("village", "my_generators:build_village")
+A generator function with an `unreal` parameter is passed the connection.
+"""
+import asyncio
+import concurrent.futures
+import importlib
+import inspect
+import json
+import os
+import sys
+import threading
+import time
+import traceback
+import types
+from typing import Any, Dict, Iterable, List, Optional, Tuple
+
+import unreal
+
+# Generator name -> "module:function"; the builders are the server's tools, called directly
+GENERATORS = {
+    "castle": "unreal_mcp_server_advanced:create_castle_fortress",
+    "town": "unreal_mcp_server_advanced:create_town",
+    "mansion": "unreal_mcp_server_advanced:construct_mansion",
+    "house": "unreal_mcp_server_advanced:construct_house",
+    "bridge": "unreal_mcp_server_advanced:create_suspension_bridge",
+    "aqueduct": "unreal_mcp_server_advanced:create_aqueduct",
+    "maze": "unreal_mcp_server_advanced:create_maze",
+}
+
+SERVER_MODULE = "unreal_mcp_server_advanced"
+
+
+class GeneratorCancelled(Exception):
+    """The client that started the generator has gone away."""
+
+
+def register_generator(name: str, target: str):
+    """Make a "module:function" generator available to run_generator by name."""
+    if ":" not in target:
+        raise ValueError(f"Generator target must be 'module:function', got {target!r}")
+    GENERATORS[name] = target
+
+
+class EditorConnection:
+    """
+    Stands in for the server's Unreal connection inside the editor.
+
+    Commands run on the editor thread. Async generators (create_town) build their
+    phases on worker threads; their commands are handed to the editor thread's event
+    loop, which is idle while it waits for them.
+    """
+
+    def __init__(self):
+        self.loop: Optional[asyncio.AbstractEventLoop] = None
+        self.commands = 0
+        self.direct_spawns = 0
+        self._thread_id = threading.get_ident()
+
+    def send_command(self, command: str, params: Dict[str, Any] = None) -> Dict[str, Any]:
+        if threading.get_ident() != self._thread_id:
+            return self._call_on_editor_thread(self.send_command, command, params)
+        params = params or {}
+        if _is_static_mesh_spawn(command, params):
+            return self.spawn_static_mesh_actors([params])[0]
+        self._report(command, params)
+        return json.loads(unreal.MCPGeneratorLibrary.execute_command(command, json.dumps(params)))
+
+    def send_commands(self, commands: Iterable[Tuple[str, Dict[str, Any]]]) -> List[Dict[str, Any]]:
+        """Send commands in order; runs of static mesh spawns go to the plugin as one batch."""
+        commands = list(commands)
+        if threading.get_ident() != self._thread_id:
+            return self._call_on_editor_thread(self.send_commands, commands)
+        responses = []
+        spawns = []
+        for command, params in commands:
+            if _is_static_mesh_spawn(command, params or {}):
+                spawns.append(params)
+                continue
+            if spawns:
+                responses.extend(self.spawn_static_mesh_actors(spawns))
+                spawns = []
+            responses.append(self.send_command(command, params))
+        if spawns:
+            responses.extend(self.spawn_static_mesh_actors(spawns))
+        return responses
+
+    def spawn_static_mesh_actors(self, spawns: List[Dict[str, Any]]) -> List[Dict[str, Any]]:
+        """Spawn StaticMeshActors from spawn_actor params in one plugin call, without JSON."""
+        if threading.get_ident() != self._thread_id:
+            return self._call_on_editor_thread(self.spawn_static_mesh_actors, spawns)
+        specs = []
+        for params in spawns:
+            self._report("spawn_actor", params)
+            location = params.get("location") or [0.0, 0.0, 0.0]
+            rotation = params.get("rotation") or [0.0, 0.0, 0.0]
+            scale = params.get("scale") or [1.0, 1.0, 1.0]
+            specs.append(unreal.MCPGeneratorActor(
+                name=params.get("name", ""),
+                static_mesh=params.get("static_mesh", ""),
+                location=unreal.Vector(*location),
+                rotation=unreal.Rotator(pitch=rotation[0], yaw=rotation[1], roll=rotation[2]),
+                scale=unreal.Vector(*scale),
+                parent=params.get("parent", ""),
+                folder=params.get("folder", "")))
+
+        names = unreal.MCPGeneratorLibrary.spawn_static_mesh_actors(specs)
+        self.direct_spawns += len(specs)
+
+        responses = []
+        for params, name in zip(spawns, names):
+            if not name:
+                responses.append({"status": "error", "error": f"Failed to spawn StaticMeshActor {params.get('name', '')}"})
+                continue
+            responses.append({"status": "success", "result": {
+                "name": str(name),
+                "class": "StaticMeshActor",
+                "location": list(params.get("location") or [0.0, 0.0, 0.0]),
+                "rotation": list(params.get("rotation") or [0.0, 0.0, 0.0]),
+                "scale": list(params.get("scale") or [1.0, 1.0, 1.0]),
+            }})
+        return responses
+
+    def _report(self, command: str, params: Dict[str, Any]):
+        self.commands += 1
+        if not unreal.MCPGeneratorLibrary.report_progress(self.commands, 0, f"{command} {params.get('name', '')}".rstrip()):
+            raise GeneratorCancelled("run_generator client disconnected")
+
+    def _call_on_editor_thread(self, function, *args):
+        if self.loop is None:
+            raise RuntimeError("Unreal commands can only be sent from the editor thread")
+        future = concurrent.futures.Future()
+
+        def call():
+            try:
+                future.set_result(function(*args))
+            except BaseException as e:
+                future.set_exception(e)
+
+        self.loop.call_soon_threadsafe(call)
+        return future.result()
+
+
+def _is_static_mesh_spawn(command: str, params: Dict[str, Any]) -> bool:
+    return command == "spawn_actor" and params.get("type") == "StaticMeshActor"
+
+
+def _provide_mcp_stand_in():
+    """The server module declares its tools with FastMCP, which the editor's Python usually lacks."""
+    try:
+        import mcp.server.fastmcp  # noqa: F401
+        return
+    except ImportError:
+        pass
+
+    class FastMCP:
+        def __init__(self, *args, **kwargs):
+            pass
+
+        def tool(self, *args, **kwargs):
+            return lambda fn: fn
+
+        def run(self, *args, **kwargs):
+            raise RuntimeError("The MCP server cannot run inside the editor")
+
+    class Context:
+        pass
+
+    fastmcp = types.ModuleType("mcp.server.fastmcp")
+    fastmcp.FastMCP = FastMCP
+    fastmcp.Context = Context
+    server = types.ModuleType("mcp.server")
+    server.fastmcp = fastmcp
+    package = types.ModuleType("mcp")
+    package.server = server
+    sys.modules.update({"mcp": package, "mcp.server": server, "mcp.server.fastmcp": fastmcp})
+
+
+def _unload_scripts(script_root: str):
+    """Forget the modules loaded from script_root so the next import picks up edits."""
+    root = os.path.normcase(os.path.abspath(script_root))
+    for name, module in list(sys.modules.items()):
+        path = getattr(module, "__file__", None)
+        if path and os.path.normcase(os.path.abspath(path)).startswith(root):
+            del sys.modules[name]
+
+
+def _run(request: Dict[str, Any]) -> Dict[str, Any]:
+    name = request["generator"]
+    arguments = dict(request.get("arguments") or {})
+    script_root = request.get("script_root")
+    if script_root:
+        if script_root not in sys.path:
+            sys.path.insert(0, script_root)
+        if request.get("reload"):
+            _unload_scripts(script_root)
+
+    # Only registered names; clients never choose the module to import
+    target = GENERATORS.get(name)
+    if target is None:
+        raise ValueError(f"Unknown generator {name!r}; registered: {', '.join(sorted(GENERATORS))}")
+    module_name, function_name = target.split(":", 1)
+    _provide_mcp_stand_in()
+    function = getattr(importlib.import_module(module_name), function_name)
+
+    connection = EditorConnection()
+    if "unreal" in inspect.signature(function).parameters:
+        arguments.setdefault("unreal", connection)
+
+    # The builders and the helpers they call look the connection up on the server module
+    server = sys.modules.get(SERVER_MODULE)
+    original = server.get_unreal_connection if server else None
+    if server:
+        server.get_unreal_connection = lambda: connection
+
+    start = time.perf_counter()
+    try:
+        if inspect.iscoroutinefunction(function):
+            async def main():
+                connection.loop = asyncio.get_running_loop()
+                return await function(**arguments)
+            result = asyncio.run(main())
+        else:
+            result = function(**arguments)
+    finally:
+        if server:
+            server.get_unreal_connection = original
+
+    result = dict(result) if isinstance(result, dict) else {"success": True, "result": result}
+    if result.get("success") is False:
+        result.setdefault("error", result.get("message", f"Generator {name} failed"))
+    result["generator"] = {
+        "name": name,
+        "commands": connection.commands,
+        "direct_spawns": connection.direct_spawns,
+        "seconds": round(time.perf_counter() - start, 3),
+    }
+    return result
+
+
+def run():
+    """Entry point for run_generator: run the requested generator and hand its result back."""
+    request = json.loads(unreal.MCPGeneratorLibrary.get_generator_request())
+    try:
+        result = _run(request)
+    except Exception as e:
+        unreal.log_error(traceback.format_exc())
+        result = {"success": False, "error": f"{type(e).__name__}: {e}"}
+    unreal.MCPGeneratorLibrary.set_generator_result(json.dumps(result, default=str))
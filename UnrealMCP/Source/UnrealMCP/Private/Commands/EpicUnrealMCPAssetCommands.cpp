@@ -0,0 +1,1344 @@
+#include "Commands/EpicUnrealMCPAssetCommands.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPCommandRegistry.h"
+#include "MCPPropertyPath.h"
+#include "MCPAssetSearchIndex.h"
+#include "MCPProceduralMesh.h"
+#include "MCPProgress.h"
+#include "MCPPayloadWriter.h"
+#include "MCPActorSnapshot.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/DataTable.h"
+#include "DataTableUtils.h"
+#include "DataTableEditorUtils.h"
+#include "Serialization/Csv/CsvParser.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+#include "FileHelpers.h"
+#include "HAL/FileManager.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Engine/Texture.h"
+#include "ShaderCompiler.h"
+#include "AssetCompilingManager.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+
+// Per-row errors reported back before the rest are only counted
+#define MCP_MAX_REPORTED_ROW_ERRORS 20
+
+// Seconds between progress checks while waiting for shader compiles
+#define MCP_SHADER_WAIT_POLL_SECONDS 0.05f
+
+namespace
+{
+    UDataTable* LoadDataTable(const FString& Path, FString& OutError)
+    {
+        UDataTable* Table = Cast<UDataTable>(UEditorAssetLibrary::LoadAsset(Path));
+        if (!Table)
+        {
+            OutError = FString::Printf(TEXT("DataTable not found: %s"), *Path);
+            return nullptr;
+        }
+        if (!Table->GetRowStruct())
+        {
+            OutError = FString::Printf(TEXT("DataTable %s has no row struct"), *Path);
+            return nullptr;
+        }
+        return Table;
+    }
+
+    /**
+     * Decodes a chunk of rows and then applies them to a table. Every row is decoded
+     * into its own copy first and nothing is written before Apply, so rows that fail
+     * to decode, or a replacement whose rows all fail, leave the table untouched.
+     */
+    class FDataTableRowWriter
+    {
+    public:
+        FDataTableRowWriter(UDataTable* InTable, bool bInReplace)
+            : Table(InTable)
+            , RowStruct(InTable->GetRowStruct())
+            , bReplace(bInReplace)
+        {
+        }
+
+        // Start a row: a copy of the row decoded earlier in this chunk or of the existing row, or a default one
+        uint8* BeginRow(FName RowName)
+        {
+            Current = MakeUnique<FStructOnScope>(RowStruct);
+            uint8* RowData = Current->GetStructMemory();
+            if (const int32* DecodedIndex = DecodedByName.Find(RowName))
+            {
+                RowStruct->CopyScriptStruct(RowData, Decoded[*DecodedIndex].Data->GetStructMemory());
+            }
+            else if (const uint8* Existing = bReplace ? nullptr : Table->FindRowUnchecked(RowName))
+            {
+                RowStruct->CopyScriptStruct(RowData, Existing);
+            }
+            return RowData;
+        }
+
+        // Keep the row started by BeginRow for Apply
+        void CommitRow(FName RowName)
+        {
+            if (const int32* DecodedIndex = DecodedByName.Find(RowName))
+            {
+                Decoded[*DecodedIndex].Data = MoveTemp(Current);
+            }
+            else
+            {
+                DecodedByName.Add(RowName, Decoded.Num());
+                Decoded.Add({ RowName, MoveTemp(Current) });
+            }
+        }
+
+        void FailRow(const FString& RowName, const FString& Error)
+        {
+            Current.Reset();
+            if (Errors.Num() < MCP_MAX_REPORTED_ROW_ERRORS)
+            {
+                TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+                ErrorObj->SetStringField(TEXT("row"), RowName);
+                ErrorObj->SetStringField(TEXT("error"), Error);
+                Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+            }
+            ++NumFailed;
+        }
+
+        // Column or field name to row property, looked up once per call
+        FProperty* FindProperty(const FString& Name)
+        {
+            if (FProperty** Cached = Properties.Find(Name))
+            {
+                return *Cached;
+            }
+            FProperty* Property = Table->FindTableProperty(FName(*Name));
+            Properties.Add(Name, Property);
+            return Property;
+        }
+
+        int32 NumDecoded() const
+        {
+            return Decoded.Num();
+        }
+
+        // Write the decoded rows, emptying the table first when replacing
+        void Apply()
+        {
+            if (bReplace)
+            {
+                Table->EmptyTable();
+            }
+            for (const FDecodedRow& Row : Decoded)
+            {
+                if (uint8* Existing = Table->FindRowUnchecked(Row.Name))
+                {
+                    RowStruct->CopyScriptStruct(Existing, Row.Data->GetStructMemory());
+                    ++NumUpdated;
+                }
+                else
+                {
+                    Table->AddRow(Row.Name, *reinterpret_cast<const FTableRowBase*>(Row.Data->GetStructMemory()));
+                    ++NumAdded;
+                }
+            }
+        }
+
+        struct FDecodedRow
+        {
+            FName Name;
+            TUniquePtr<FStructOnScope> Data;
+        };
+
+        UDataTable* Table;
+        const UScriptStruct* RowStruct;
+        bool bReplace;
+        TMap<FString, FProperty*> Properties;
+        TArray<FDecodedRow> Decoded;
+        TMap<FName, int32> DecodedByName;
+        TUniquePtr<FStructOnScope> Current;
+
+        int32 NumAdded = 0;
+        int32 NumUpdated = 0;
+        int32 NumFailed = 0;
+        TArray<TSharedPtr<FJsonValue>> Errors;
+    };
+
+    void UpsertJsonRows(FDataTableRowWriter& Writer, const FJsonObject& Rows)
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Row : Rows.Values)
+        {
+            const TSharedPtr<FJsonObject>* Fields = nullptr;
+            if (Row.Key.IsEmpty() || !Row.Value.IsValid() || !Row.Value->TryGetObject(Fields))
+            {
+                Writer.FailRow(Row.Key, TEXT("Row must be a named object of field values"));
+                continue;
+            }
+
+            const FName RowName(*Row.Key);
+            uint8* RowData = Writer.BeginRow(RowName);
+
+            FString Error;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*Fields)->Values)
+            {
+                FProperty* Property = Writer.FindProperty(Field.Key);
+                if (!Property)
+                {
+                    Error = FString::Printf(TEXT("Unknown field '%s'"), *Field.Key);
+                    break;
+                }
+                if (!FMCPPropertyPath::ImportJsonValue(Property, Property->ContainerPtrToValuePtr<void>(RowData), Field.Value, Error))
+                {
+                    break;
+                }
+            }
+
+            if (Error.IsEmpty())
+            {
+                Writer.CommitRow(RowName);
+            }
+            else
+            {
+                Writer.FailRow(Row.Key, Error);
+            }
+        }
+    }
+
+    // Map the header row to row properties; column 0 holds the row names
+    bool ResolveCsvColumns(FDataTableRowWriter& Writer, const FCsvParser::FRows& Rows, TArray<FProperty*>& OutColumns, FString& OutError)
+    {
+        if (Rows.Num() == 0)
+        {
+            return true;
+        }
+
+        const TArray<const TCHAR*>& Header = Rows[0];
+        OutColumns.Add(nullptr);
+        for (int32 Column = 1; Column < Header.Num(); ++Column)
+        {
+            FProperty* Property = Writer.FindProperty(Header[Column]);
+            if (!Property)
+            {
+                OutError = FString::Printf(TEXT("Unknown column '%s'"), Header[Column]);
+                return false;
+            }
+            OutColumns.Add(Property);
+        }
+        return true;
+    }
+
+    void UpsertCsvRows(FDataTableRowWriter& Writer, const FCsvParser::FRows& Rows, const TArray<FProperty*>& Columns)
+    {
+        if (Rows.Num() == 0)
+        {
+            return;
+        }
+
+        const TArray<const TCHAR*>& Header = Rows[0];
+        for (int32 RowIndex = 1; RowIndex < Rows.Num(); ++RowIndex)
+        {
+            const TArray<const TCHAR*>& Cells = Rows[RowIndex];
+            const FString RowNameText = Cells.Num() > 0 ? FString(Cells[0]) : FString();
+            if (RowNameText.IsEmpty())
+            {
+                // Trailing blank lines
+                if (Cells.Num() <= 1)
+                {
+                    continue;
+                }
+                Writer.FailRow(FString::Printf(TEXT("#%d"), RowIndex), TEXT("Missing row name"));
+                continue;
+            }
+
+            const FName RowName(*RowNameText);
+            uint8* RowData = Writer.BeginRow(RowName);
+
+            FString Error;
+            for (int32 Column = 1; Column < Cells.Num() && Column < Columns.Num(); ++Column)
+            {
+                Error = DataTableUtils::AssignStringToProperty(Cells[Column], Columns[Column], RowData);
+                if (!Error.IsEmpty())
+                {
+                    Error = FString::Printf(TEXT("%s: %s"), Header[Column], *Error);
+                    break;
+                }
+            }
+
+            if (Error.IsEmpty())
+            {
+                Writer.CommitRow(RowName);
+            }
+            else
+            {
+                Writer.FailRow(RowNameText, Error);
+            }
+        }
+    }
+
+    FString EscapeCsvCell(const FString& Cell)
+    {
+        if (!Cell.Contains(TEXT(",")) && !Cell.Contains(TEXT("\"")) && !Cell.Contains(TEXT("\n")))
+        {
+            return Cell;
+        }
+        return FString::Printf(TEXT("\"%s\""), *Cell.Replace(TEXT("\""), TEXT("\"\"")));
+    }
+
+    struct FDataTableColumns
+    {
+        TArray<FProperty*> Properties;
+        TArray<FString> Names;
+    };
+
+    FDataTableColumns GetDataTableColumns(const UScriptStruct* RowStruct)
+    {
+        FDataTableColumns Columns;
+        for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+        {
+            Columns.Properties.Add(*It);
+            Columns.Names.Add(DataTableUtils::GetPropertyExportName(*It));
+        }
+        return Columns;
+    }
+
+    // {"name": RowName, "fields": {...}}; fields are nested so a column called Name can't hide the row name
+    TSharedPtr<FJsonObject> MakeExportRow(FName RowName, const uint8* RowData, const FDataTableColumns& Columns)
+    {
+        TSharedPtr<FJsonObject> Fields = MakeShared<FJsonObject>();
+        for (int32 Column = 0; Column < Columns.Properties.Num(); ++Column)
+        {
+            FProperty* Property = Columns.Properties[Column];
+            Fields->SetField(Columns.Names[Column], FMCPPropertyPath::ExportJsonValue(Property, Property->ContainerPtrToValuePtr<void>(RowData)));
+        }
+
+        TSharedPtr<FJsonObject> RowObj = MakeShared<FJsonObject>();
+        RowObj->SetStringField(TEXT("name"), RowName.ToString());
+        RowObj->SetObjectField(TEXT("fields"), Fields);
+        return RowObj;
+    }
+
+    // Shared between a streamed export's worker thread and the game thread tasks reading its rows
+    struct FDataTableExportState
+    {
+        TWeakObjectPtr<UDataTable> Table;
+        FDataTableColumns Columns;
+        TArray<FName> RowNames;
+        TSharedPtr<FJsonObject> Summary;
+        TUniquePtr<FMCPPayloadWriter> Frame;
+        int32 NumSent = 0;
+    };
+
+    // Encode rows [Start, End) of the export as one items frame; rows removed since the export began are skipped
+    void WriteExportRowsFrame(FDataTableExportState& State, int32 Start, int32 End)
+    {
+        TArray<TPair<FName, const uint8*>> Rows;
+        if (const UDataTable* Table = State.Table.Get())
+        {
+            for (int32 Index = Start; Index < End; ++Index)
+            {
+                if (const uint8* RowData = Table->FindRowUnchecked(State.RowNames[Index]))
+                {
+                    Rows.Emplace(State.RowNames[Index], RowData);
+                }
+            }
+        }
+
+        FMCPPayloadWriter& Frame = *State.Frame;
+        Frame.BeginObject(3);
+        Frame.WriteKey(TEXT("stream"));
+        Frame.WriteString(TEXT("items"));
+        Frame.WriteKey(TEXT("field"));
+        Frame.WriteString(TEXT("rows"));
+        Frame.WriteKey(TEXT("items"));
+        Frame.BeginArray(Rows.Num());
+        for (const TPair<FName, const uint8*>& Row : Rows)
+        {
+            Frame.WriteJsonObject(MakeExportRow(Row.Key, Row.Value, State.Columns));
+        }
+        Frame.EndArray();
+        Frame.EndObject();
+
+        State.NumSent += Rows.Num();
+    }
+}
+
+namespace
+{
+    struct FPackageSaveEntry
+    {
+        UPackage* Package;
+        UObject* Asset;
+        FString Filename;
+        bool bSaved = false;
+        double Milliseconds = -1.0;
+        FString Error;
+    };
+
+    FPackageSaveEntry MakeSaveEntry(UPackage* Package)
+    {
+        FPackageSaveEntry Entry;
+        Entry.Package = Package;
+
+        UWorld* World = UWorld::FindWorldInPackage(Package);
+        Entry.Asset = World ? static_cast<UObject*>(World) : Package->FindAssetInPackage();
+
+        const FString& Extension = World ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+        Entry.Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), Extension);
+        return Entry;
+    }
+
+    FSavePackageArgs MakeSaveArgs(bool bConcurrent)
+    {
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+        SaveArgs.Error = GWarn;
+        // File writes overlap with serializing the next package; flushed before sizes are read
+        SaveArgs.SaveFlags = SAVE_NoError | (bConcurrent ? SAVE_Concurrent : SAVE_Async);
+        return SaveArgs;
+    }
+}
+
+FEpicUnrealMCPAssetCommands::FEpicUnrealMCPAssetCommands()
+    : SearchIndex(MakeUnique<FMCPAssetSearchIndex>())
+{
+}
+
+FEpicUnrealMCPAssetCommands::~FEpicUnrealMCPAssetCommands()
+{
+}
+
+void FEpicUnrealMCPAssetCommands::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+    Registry.RegisterTyped<FMCPUpsertDataTableRowsParams>(TEXT("upsert_datatable_rows"), TEXT("Add or update a chunk of DataTable rows from JSON or CSV"),
+        [this](const FMCPUpsertDataTableRowsParams& Params) { return HandleUpsertDataTableRows(Params); });
+    Registry.RegisterTyped<FMCPExportDataTableParams>(TEXT("export_datatable"), TEXT("Export DataTable rows as JSON or CSV, optionally a page at a time"),
+        [this](const FMCPExportDataTableParams& Params) { return HandleExportDataTable(Params); });
+    Registry.SetStreamingHandler<FMCPExportDataTableParams>(TEXT("export_datatable"),
+        [this](const FMCPExportDataTableParams& Params, const FMCPStreamContext& Context, TSharedPtr<FJsonObject>& OutResult)
+        {
+            // A CSV export is one string, sent whole like any other result
+            if (!Params.Format.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+            {
+                return false;
+            }
+            OutResult = StreamExportDataTable(Params, Context);
+            return true;
+        });
+    Registry.RegisterTyped<FMCPSaveDirtyPackagesParams>(TEXT("save_dirty_packages"), TEXT("Save dirty asset and map packages in one batch, with per-package timings and sizes"),
+        [this](const FMCPSaveDirtyPackagesParams& Params) { return HandleSaveDirtyPackages(Params); });
+    Registry.RegisterTyped<FMCPSearchAssetsParams>(TEXT("search_assets"), TEXT("Fuzzy search of asset names and paths, ranked, with class and path filters"),
+        [this](const FMCPSearchAssetsParams& Params) { return HandleSearchAssets(Params); });
+    Registry.RegisterTyped<FMCPGenerateMeshParams>(TEXT("generate_mesh"), TEXT("Build boxes, cylinders, pyramids, stairs and arches into one solid mesh, with unions and cuts, and bake it to a static mesh asset"),
+        [this](const FMCPGenerateMeshParams& Params) { return HandleGenerateMesh(Params); });
+    Registry.RegisterTyped<FMCPCreateMaterialInstancesParams>(TEXT("create_material_instances"), TEXT("Create or update many material instances in one batch; shader compiles are queued once per new permutation and left to run in the background"),
+        [this](const FMCPCreateMaterialInstancesParams& Params) { return HandleCreateMaterialInstances(Params); });
+    Registry.RegisterTyped<FMCPGetShaderCompileStatusParams>(TEXT("get_shader_compile_status"), TEXT("Report outstanding shader compile jobs and compiling assets"),
+        [this](const FMCPGetShaderCompileStatusParams& Params) { return HandleGetShaderCompileStatus(Params); });
+    Registry.RegisterTyped<FMCPWaitForShaderCompilesParams>(TEXT("wait_for_shader_compiles"), TEXT("Wait until outstanding shader compiles finish, or the timeout passes; send with stream=true for progress frames"),
+        [this](const FMCPWaitForShaderCompilesParams& Params) { return HandleWaitForShaderCompiles(Params); });
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleUpsertDataTableRows(const FMCPUpsertDataTableRowsParams& Params)
+{
+    const TSharedPtr<FJsonObject>& JsonRows = Params.Rows.JsonObject;
+    if (!JsonRows.IsValid() && Params.Csv.IsEmpty() && !Params.bReplace)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'rows' or 'csv'"));
+    }
+
+    FString Error;
+    UDataTable* Table = LoadDataTable(Params.Table, Error);
+    if (!Table)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    FDataTableRowWriter Writer(Table, Params.bReplace);
+
+    // Reject a bad CSV header before anything is changed
+    const FCsvParser Parser(Params.Csv);
+    TArray<FProperty*> CsvColumns;
+    if (!ResolveCsvColumns(Writer, Parser.GetRows(), CsvColumns, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    // Decode the whole chunk before the table is touched
+    if (JsonRows.IsValid())
+    {
+        UpsertJsonRows(Writer, *JsonRows);
+    }
+    UpsertCsvRows(Writer, Parser.GetRows(), CsvColumns);
+
+    // A replacement is applied only if some of its rows decoded; one with no rows at all clears the table
+    if (Params.bReplace && Writer.NumDecoded() == 0 && Writer.NumFailed > 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("None of the %d replacement rows decoded, %s is unchanged: %s"),
+            Writer.NumFailed, *Table->GetPathName(), *Writer.Errors[0]->AsObject()->GetStringField(TEXT("error"))));
+    }
+
+    if (Params.bReplace || Writer.NumDecoded() > 0)
+    {
+        // One change notification for the whole chunk instead of one per row
+        Table->Modify();
+        FDataTableEditorUtils::BroadcastPreChange(Table, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+        Writer.Apply();
+        FDataTableEditorUtils::BroadcastPostChange(Table, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+        Table->MarkPackageDirty();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("table"), Table->GetPathName());
+    ResultObj->SetNumberField(TEXT("added"), Writer.NumAdded);
+    ResultObj->SetNumberField(TEXT("updated"), Writer.NumUpdated);
+    ResultObj->SetNumberField(TEXT("failed"), Writer.NumFailed);
+    ResultObj->SetNumberField(TEXT("row_count"), Table->GetRowMap().Num());
+    if (Writer.Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Writer.Errors);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleExportDataTable(const FMCPExportDataTableParams& Params)
+{
+    const bool bCsv = Params.Format.Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+    if (!bCsv && !Params.Format.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown format '%s' (expected json or csv)"), *Params.Format));
+    }
+
+    FString Error;
+    UDataTable* Table = LoadDataTable(Params.Table, Error);
+    if (!Table)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    const UScriptStruct* RowStruct = Table->GetRowStruct();
+    const FDataTableColumns Columns = GetDataTableColumns(RowStruct);
+
+    const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+    const int32 First = FMath::Clamp(Params.Offset, 0, RowMap.Num());
+    const int32 Count = Params.Limit > 0 ? FMath::Min(Params.Limit, RowMap.Num() - First) : RowMap.Num() - First;
+
+    TArray<TSharedPtr<FJsonValue>> JsonRows;
+    FString Csv;
+    if (bCsv)
+    {
+        Csv = TEXT("---");
+        for (const FString& ColumnName : Columns.Names)
+        {
+            Csv += TEXT(",") + EscapeCsvCell(ColumnName);
+        }
+        Csv += TEXT("\n");
+    }
+    else
+    {
+        JsonRows.Reserve(Count);
+    }
+
+    int32 RowIndex = 0;
+    for (const TPair<FName, uint8*>& Row : RowMap)
+    {
+        if (RowIndex++ < First)
+        {
+            continue;
+        }
+        if (RowIndex > First + Count)
+        {
+            break;
+        }
+
+        if (bCsv)
+        {
+            Csv += EscapeCsvCell(Row.Key.ToString());
+            for (FProperty* Column : Columns.Properties)
+            {
+                Csv += TEXT(",") + EscapeCsvCell(DataTableUtils::GetPropertyValueAsString(Column, Row.Value, EDataTableExportFlags::None));
+            }
+            Csv += TEXT("\n");
+        }
+        else
+        {
+            JsonRows.Add(MakeShared<FJsonValueObject>(MakeExportRow(Row.Key, Row.Value, Columns)));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("table"), Table->GetPathName());
+    ResultObj->SetStringField(TEXT("row_struct"), RowStruct->GetName());
+    ResultObj->SetNumberField(TEXT("total"), RowMap.Num());
+    ResultObj->SetNumberField(TEXT("offset"), First);
+    ResultObj->SetNumberField(TEXT("count"), Count);
+    if (bCsv)
+    {
+        ResultObj->SetStringField(TEXT("csv"), Csv);
+    }
+    else
+    {
+        ResultObj->SetArrayField(TEXT("rows"), JsonRows);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::StreamExportDataTable(const FMCPExportDataTableParams& Params, const FMCPStreamContext& Context)
+{
+    // Captured by the game thread tasks, which may outlive this call if the server shuts down
+    TSharedPtr<FDataTableExportState, ESPMode::ThreadSafe> State = MakeShared<FDataTableExportState, ESPMode::ThreadSafe>();
+
+    const bool bLoaded = Context.RunOnGameThread([State, Params]()
+    {
+        FString Error;
+        UDataTable* Table = LoadDataTable(Params.Table, Error);
+        if (!Table)
+        {
+            State->Summary = FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+            return;
+        }
+
+        // Only the row names of the page are kept; row contents are read a frame at a time
+        const TMap<FName, uint8*>& RowMap = Table->GetRowMap();
+        const int32 First = FMath::Clamp(Params.Offset, 0, RowMap.Num());
+        const int32 Count = Params.Limit > 0 ? FMath::Min(Params.Limit, RowMap.Num() - First) : RowMap.Num() - First;
+
+        State->RowNames.Reserve(Count);
+        int32 RowIndex = 0;
+        for (const TPair<FName, uint8*>& Row : RowMap)
+        {
+            if (RowIndex++ < First)
+            {
+                continue;
+            }
+            if (RowIndex > First + Count)
+            {
+                break;
+            }
+            State->RowNames.Add(Row.Key);
+        }
+
+        State->Table = Table;
+        State->Columns = GetDataTableColumns(Table->GetRowStruct());
+        State->Summary = MakeShared<FJsonObject>();
+        State->Summary->SetStringField(TEXT("table"), Table->GetPathName());
+        State->Summary->SetStringField(TEXT("row_struct"), Table->GetRowStruct()->GetName());
+        State->Summary->SetNumberField(TEXT("total"), RowMap.Num());
+        State->Summary->SetNumberField(TEXT("offset"), First);
+        State->Summary->SetNumberField(TEXT("count"), Count);
+    });
+    if (!bLoaded)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Server is shutting down"));
+    }
+    if (!State->Table.IsValid())
+    {
+        return State->Summary;
+    }
+
+    // Rows are encoded on the game thread and sent from here, so the editor keeps ticking between frames
+    for (int32 Start = 0; Start < State->RowNames.Num(); Start += Context.ChunkSize)
+    {
+        const int32 End = FMath::Min(Start + Context.ChunkSize, State->RowNames.Num());
+        State->Frame = Context.Sink.MakeWriter();
+        if (!Context.RunOnGameThread([State, Start, End]() { WriteExportRowsFrame(*State, Start, End); }))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Server is shutting down"));
+        }
+        if (!Context.Sink.SendFrame(*State->Frame))
+        {
+            return nullptr;
+        }
+    }
+
+    TSharedPtr<FJsonObject> Streamed = MakeShared<FJsonObject>();
+    Streamed->SetNumberField(TEXT("rows"), State->NumSent);
+    State->Summary->SetObjectField(TEXT("streamed"), Streamed);
+    return State->Summary;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleSaveDirtyPackages(const FMCPSaveDirtyPackagesParams& Params)
+{
+    TArray<UPackage*> DirtyPackages;
+    if (Params.bIncludeContent)
+    {
+        FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+    }
+    if (Params.bIncludeMaps)
+    {
+        FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+    }
+
+    TArray<FPackageSaveEntry> Entries;
+    for (UPackage* Package : DirtyPackages)
+    {
+        if (!Package || Package == GetTransientPackage() || Package->HasAnyFlags(RF_Transient) ||
+            FPackageName::IsScriptPackage(Package->GetName()) || FPackageName::IsTempPackage(Package->GetName()))
+        {
+            continue;
+        }
+        if (!Params.PathPrefix.IsEmpty() && !Package->GetName().StartsWith(Params.PathPrefix))
+        {
+            continue;
+        }
+        if (Params.bCreatedThisSession && FPackageName::DoesPackageExist(Package->GetName()))
+        {
+            continue;
+        }
+        Entries.Add(MakeSaveEntry(Package));
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (!Params.bDryRun)
+    {
+        // Asset packages can be serialized in parallel; world packages always go one by one
+        TArray<FPackageSaveInfo> ConcurrentInfos;
+        TArray<int32> ConcurrentEntries;
+
+        const FSavePackageArgs SaveArgs = MakeSaveArgs(false);
+        for (int32 Index = 0; Index < Entries.Num(); ++Index)
+        {
+            FPackageSaveEntry& Entry = Entries[Index];
+            if (!Entry.Asset)
+            {
+                Entry.Error = TEXT("Package has no asset to save");
+                continue;
+            }
+            if (IFileManager::Get().IsReadOnly(*Entry.Filename))
+            {
+                Entry.Error = TEXT("File is read-only (check it out from source control first)");
+                continue;
+            }
+
+            if (Params.bConcurrent && !Entry.Asset->IsA<UWorld>())
+            {
+                ConcurrentInfos.Add({ Entry.Package, Entry.Asset, Entry.Filename });
+                ConcurrentEntries.Add(Index);
+                continue;
+            }
+
+            const double PackageStart = FPlatformTime::Seconds();
+            const FSavePackageResultStruct Result = UPackage::Save(Entry.Package, Entry.Asset, *Entry.Filename, SaveArgs);
+            Entry.Milliseconds = (FPlatformTime::Seconds() - PackageStart) * 1000.0;
+            Entry.bSaved = Result.IsSuccessful();
+            if (!Entry.bSaved)
+            {
+                Entry.Error = TEXT("Save failed (see the editor log)");
+            }
+        }
+
+        if (ConcurrentInfos.Num() > 0)
+        {
+            TArray<FSavePackageResultStruct> Results;
+            UPackage::SaveConcurrent(ConcurrentInfos, MakeSaveArgs(true), Results);
+            for (int32 Index = 0; Index < ConcurrentEntries.Num(); ++Index)
+            {
+                FPackageSaveEntry& Entry = Entries[ConcurrentEntries[Index]];
+                Entry.bSaved = Results.IsValidIndex(Index) && Results[Index].IsSuccessful();
+                if (!Entry.bSaved)
+                {
+                    Entry.Error = TEXT("Save failed (see the editor log)");
+                }
+            }
+        }
+
+        UPackage::WaitForAsyncFileWrites();
+    }
+
+    const double TotalMilliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    int32 NumSaved = 0;
+    int32 NumFailed = 0;
+    int64 TotalBytes = 0;
+    TArray<TSharedPtr<FJsonValue>> PackageArray;
+    for (const FPackageSaveEntry& Entry : Entries)
+    {
+        TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+        PackageObj->SetStringField(TEXT("package"), Entry.Package->GetName());
+        PackageObj->SetStringField(TEXT("filename"), Entry.Filename);
+
+        if (!Params.bDryRun)
+        {
+            PackageObj->SetBoolField(TEXT("saved"), Entry.bSaved);
+            if (Entry.bSaved)
+            {
+                const int64 Bytes = IFileManager::Get().FileSize(*Entry.Filename);
+                PackageObj->SetNumberField(TEXT("bytes"), Bytes);
+                TotalBytes += FMath::Max<int64>(Bytes, 0);
+                ++NumSaved;
+            }
+            else
+            {
+                PackageObj->SetStringField(TEXT("error"), Entry.Error);
+                ++NumFailed;
+            }
+            // Packages saved concurrently only have the batch time
+            if (Entry.Milliseconds >= 0.0)
+            {
+                PackageObj->SetNumberField(TEXT("ms"), Entry.Milliseconds);
+            }
+        }
+        PackageArray.Add(MakeShared<FJsonValueObject>(PackageObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("packages"), PackageArray);
+    ResultObj->SetBoolField(TEXT("dry_run"), Params.bDryRun);
+    ResultObj->SetNumberField(TEXT("saved"), NumSaved);
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    ResultObj->SetNumberField(TEXT("total_bytes"), static_cast<double>(TotalBytes));
+    ResultObj->SetNumberField(TEXT("total_ms"), TotalMilliseconds);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleSearchAssets(const FMCPSearchAssetsParams& Params)
+{
+    if (Params.Query.TrimStartAndEnd().IsEmpty() && Params.Classes.Num() == 0 && Params.PathPrefix.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide a 'query', 'classes' or 'path_prefix'"));
+    }
+    if (Params.Limit <= 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'limit' must be positive"));
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    TArray<FMCPAssetSearchHit> Hits;
+    int32 TotalMatches = 0;
+    SearchIndex->Search(Params.Query, Params.Classes, Params.PathPrefix, Params.Limit, Hits, TotalMatches);
+    const double ElapsedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+    TArray<TSharedPtr<FJsonValue>> AssetsArray;
+    AssetsArray.Reserve(Hits.Num());
+    for (const FMCPAssetSearchHit& Hit : Hits)
+    {
+        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+        AssetObj->SetStringField(TEXT("path"), Hit.ObjectPath.ToString());
+        AssetObj->SetStringField(TEXT("name"), Hit.ObjectPath.GetAssetName().ToString());
+        AssetObj->SetStringField(TEXT("class"), Hit.ClassPath.GetAssetName().ToString());
+        AssetObj->SetNumberField(TEXT("score"), Hit.Score);
+        AssetsArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("assets"), AssetsArray);
+    ResultObj->SetNumberField(TEXT("total_matches"), TotalMatches);
+    ResultObj->SetNumberField(TEXT("indexed_assets"), SearchIndex->NumAssets());
+    ResultObj->SetNumberField(TEXT("search_ms"), ElapsedMs);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleGenerateMesh(const FMCPGenerateMeshParams& Params)
+{
+    if (Params.Shapes.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'shapes' must be a non-empty array"));
+    }
+    const FString& AssetPath = Params.AssetPath;
+    if (AssetPath.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'asset_path' parameter"));
+    }
+
+    const FString& CollisionName = Params.Collision;
+    FMCPProceduralMesh::ECollision Collision;
+    if (CollisionName.Equals(TEXT("complex"), ESearchCase::IgnoreCase))
+    {
+        Collision = FMCPProceduralMesh::ECollision::Complex;
+    }
+    else if (CollisionName.Equals(TEXT("box"), ESearchCase::IgnoreCase))
+    {
+        Collision = FMCPProceduralMesh::ECollision::Box;
+    }
+    else if (CollisionName.Equals(TEXT("none"), ESearchCase::IgnoreCase))
+    {
+        Collision = FMCPProceduralMesh::ECollision::None;
+    }
+    else
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown collision %s (expected complex, box or none)"), *CollisionName));
+    }
+
+    UMaterialInterface* Material = nullptr;
+    if (!Params.Material.IsEmpty())
+    {
+        Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(Params.Material));
+        if (!Material)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Material not found: %s"), *Params.Material));
+        }
+    }
+
+    // Resolve the level side before any work so a bad parent doesn't leave a half-finished asset
+    const FString& ActorName = Params.ActorName;
+    const FString& ParentName = Params.Parent;
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    AActor* Parent = nullptr;
+    if (!ActorName.IsEmpty())
+    {
+        if (!World)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world to place the mesh in"));
+        }
+        Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, ParentName);
+        if (!ParentName.IsEmpty() && !Parent)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *ParentName));
+        }
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    UE::Geometry::FDynamicMesh3 Mesh;
+    FString Error;
+    if (!FMCPProceduralMesh::BuildFromJson(Params.Shapes, Mesh, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    const double BuildMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+    bool bCreated = false;
+    UStaticMesh* StaticMesh = FMCPProceduralMesh::BakeToStaticMesh(Mesh, AssetPath, Material, Collision, Params.bOverwrite, bCreated, Error);
+    if (!StaticMesh)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    const double BakeMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) - BuildMs;
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("asset_path"), StaticMesh->GetPathName());
+    ResultObj->SetBoolField(TEXT("created"), bCreated);
+    ResultObj->SetNumberField(TEXT("shapes"), Params.Shapes.Num());
+    ResultObj->SetNumberField(TEXT("vertices"), Mesh.VertexCount());
+    ResultObj->SetNumberField(TEXT("triangles"), Mesh.TriangleCount());
+    ResultObj->SetNumberField(TEXT("build_ms"), BuildMs);
+    ResultObj->SetNumberField(TEXT("bake_ms"), BakeMs);
+
+    if (!ActorName.IsEmpty())
+    {
+        const FVector& Location = Params.Location;
+        const FRotator& Rotation = Params.Rotation;
+
+        // Regenerating under the same name swaps the mesh on the placed actor
+        AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(FEpicUnrealMCPCommonUtils::FindActorByName(World, ActorName));
+        const bool bReused = MeshActor != nullptr;
+        if (MeshActor)
+        {
+            MeshActor->Modify();
+            MeshActor->SetActorLocationAndRotation(Location, Rotation);
+            FMCPActorSnapshot::NotifyActorChanged(MeshActor);
+        }
+        else
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.Name = FName(*ActorName);
+            SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+            MeshActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Location, Rotation, SpawnParams);
+            if (!MeshActor)
+            {
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Baked %s but failed to spawn %s"), *AssetPath, *ActorName));
+            }
+            MeshActor->SetActorLabel(MeshActor->GetName());
+        }
+        MeshActor->GetStaticMeshComponent()->SetStaticMesh(StaticMesh);
+        // The asset stays baked; a new actor that can't join its group is removed again
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(MeshActor, Parent, Params.Folder))
+        {
+            if (!bReused)
+            {
+                MeshActor->Destroy();
+            }
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Baked %s but could not attach %s to %s"), *AssetPath, *ActorName, *ParentName));
+        }
+
+        TSharedPtr<FJsonObject> ActorObj = FEpicUnrealMCPCommonUtils::ActorToJsonObject(MeshActor);
+        ActorObj->SetBoolField(TEXT("reused"), bReused);
+        ResultObj->SetObjectField(TEXT("actor"), ActorObj);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("HandleGenerateMesh: %d shapes -> %d triangles in %s (%.1f ms build, %.1f ms bake)"),
+        Params.Shapes.Num(), Mesh.TriangleCount(), *AssetPath, BuildMs, BakeMs);
+    return ResultObj;
+}
+
+namespace
+{
+    // A static switch value and the parent's switch expression, which a new override refers to
+    struct FStaticSwitchSpec
+    {
+        bool bValue = false;
+        FGuid ExpressionGuid;
+    };
+
+    // One create_material_instances entry, resolved and checked against its parent before anything is created
+    struct FMaterialInstanceSpec
+    {
+        FString Path;
+        UMaterialInterface* Parent = nullptr;
+        TArray<TPair<FName, float>> Scalars;
+        TArray<TPair<FName, FLinearColor>> Vectors;
+        TArray<TPair<FName, UTexture*>> Textures;
+        TArray<TPair<FName, FStaticSwitchSpec>> Switches;
+    };
+
+    // Assets repeat across a batch (parents, textures); load each once
+    UObject* LoadCachedAsset(const FString& Path, TMap<FString, UObject*>& Cache)
+    {
+        if (UObject** Cached = Cache.Find(Path))
+        {
+            return *Cached;
+        }
+        UObject* Asset = UEditorAssetLibrary::LoadAsset(Path);
+        Cache.Add(Path, Asset);
+        return Asset;
+    }
+
+    // {"Name": value} for one kind of parameter; names must exist on the parent, whose
+    // metadata for the parameter is passed to Read along with the JSON value
+    template <typename ValueType, typename ReadFunc>
+    bool ReadMaterialParameters(const TSharedPtr<FJsonObject>& Entry, const TCHAR* Field, EMaterialParameterType Type,
+        const UMaterialInterface* Parent, TArray<TPair<FName, ValueType>>& OutValues, FString& OutError, ReadFunc Read)
+    {
+        const TSharedPtr<FJsonObject>* Values = nullptr;
+        if (!Entry->TryGetObjectField(Field, Values))
+        {
+            return true;
+        }
+
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Values)->Values)
+        {
+            const FName Name(*Pair.Key);
+            FMaterialParameterMetadata Default;
+            if (!Parent->GetParameterDefaultValue(Type, FMemoryImageMaterialParameterInfo(Name), Default))
+            {
+                OutError = FString::Printf(TEXT("%s.%s is not a parameter of %s"), Field, *Pair.Key, *Parent->GetPathName());
+                return false;
+            }
+            ValueType Value;
+            if (!Read(Pair.Value, Default, Value))
+            {
+                OutError = FString::Printf(TEXT("Invalid value for %s.%s"), Field, *Pair.Key);
+                return false;
+            }
+            OutValues.Emplace(Name, Value);
+        }
+        return true;
+    }
+
+    bool ParseMaterialInstanceSpec(const TSharedPtr<FJsonObject>& Entry, const FString& Folder, UMaterialInterface* DefaultParent,
+        TMap<FString, UObject*>& AssetCache, FMaterialInstanceSpec& OutSpec, FString& OutError)
+    {
+        FString Name;
+        if (!Entry->TryGetStringField(TEXT("name"), Name) || Name.IsEmpty())
+        {
+            OutError = TEXT("Missing 'name'");
+            return false;
+        }
+        OutSpec.Path = Name.StartsWith(TEXT("/")) ? Name : Folder / Name;
+        FText Reason;
+        if (!FPackageName::IsValidLongPackageName(OutSpec.Path, false, &Reason))
+        {
+            OutError = FString::Printf(TEXT("Invalid asset path %s: %s"), *OutSpec.Path, *Reason.ToString());
+            return false;
+        }
+
+        OutSpec.Parent = DefaultParent;
+        FString ParentPath;
+        if (Entry->TryGetStringField(TEXT("parent"), ParentPath) && !ParentPath.IsEmpty())
+        {
+            OutSpec.Parent = Cast<UMaterialInterface>(LoadCachedAsset(ParentPath, AssetCache));
+            if (!OutSpec.Parent)
+            {
+                OutError = FString::Printf(TEXT("Parent material not found: %s"), *ParentPath);
+                return false;
+            }
+        }
+        if (!OutSpec.Parent)
+        {
+            OutError = TEXT("No parent material (set 'parent' on the instance or the batch)");
+            return false;
+        }
+        if (OutSpec.Parent->GetOutermost()->GetName() == OutSpec.Path)
+        {
+            OutError = TEXT("An instance cannot be its own parent");
+            return false;
+        }
+
+        return ReadMaterialParameters(Entry, TEXT("scalars"), EMaterialParameterType::Scalar, OutSpec.Parent, OutSpec.Scalars, OutError,
+                [](const TSharedPtr<FJsonValue>& Value, const FMaterialParameterMetadata&, float& Out)
+                {
+                    double Number = 0.0;
+                    if (!Value->TryGetNumber(Number))
+                    {
+                        return false;
+                    }
+                    Out = static_cast<float>(Number);
+                    return true;
+                })
+            && ReadMaterialParameters(Entry, TEXT("vectors"), EMaterialParameterType::Vector, OutSpec.Parent, OutSpec.Vectors, OutError,
+                [](const TSharedPtr<FJsonValue>& Value, const FMaterialParameterMetadata&, FLinearColor& Out)
+                {
+                    // [R, G, B] or [R, G, B, A]
+                    const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+                    if (!Value->TryGetArray(Array) || Array->Num() < 3 || Array->Num() > 4)
+                    {
+                        return false;
+                    }
+                    double Channels[4] = { 0.0, 0.0, 0.0, 1.0 };
+                    for (int32 Index = 0; Index < Array->Num(); ++Index)
+                    {
+                        if (!(*Array)[Index].IsValid() || !(*Array)[Index]->TryGetNumber(Channels[Index]))
+                        {
+                            return false;
+                        }
+                    }
+                    Out = FLinearColor(Channels[0], Channels[1], Channels[2], Channels[3]);
+                    return true;
+                })
+            && ReadMaterialParameters(Entry, TEXT("textures"), EMaterialParameterType::Texture, OutSpec.Parent, OutSpec.Textures, OutError,
+                [&AssetCache](const TSharedPtr<FJsonValue>& Value, const FMaterialParameterMetadata&, UTexture*& Out)
+                {
+                    FString TexturePath;
+                    Out = Value->TryGetString(TexturePath) ? Cast<UTexture>(LoadCachedAsset(TexturePath, AssetCache)) : nullptr;
+                    return Out != nullptr;
+                })
+            && ReadMaterialParameters(Entry, TEXT("switches"), EMaterialParameterType::StaticSwitch, OutSpec.Parent, OutSpec.Switches, OutError,
+                [](const TSharedPtr<FJsonValue>& Value, const FMaterialParameterMetadata& Default, FStaticSwitchSpec& Out)
+                {
+                    Out.ExpressionGuid = Default.ExpressionGuid;
+                    return Value->TryGetBool(Out.bValue);
+                });
+    }
+
+    TSharedPtr<FJsonObject> MakeShaderCompileStatus()
+    {
+        TSharedPtr<FJsonObject> StatusObj = MakeShared<FJsonObject>();
+        StatusObj->SetBoolField(TEXT("compiling"), GShaderCompilingManager->IsCompiling());
+        StatusObj->SetNumberField(TEXT("remaining_jobs"), GShaderCompilingManager->GetNumRemainingJobs());
+        StatusObj->SetNumberField(TEXT("outstanding_jobs"), GShaderCompilingManager->GetNumOutstandingJobs());
+        StatusObj->SetBoolField(TEXT("asynchronous"), GShaderCompilingManager->AllowAsynchronousShaderCompiling());
+        StatusObj->SetNumberField(TEXT("assets_compiling"), FAssetCompilingManager::Get().GetNumRemainingAssets());
+        return StatusObj;
+    }
+
+    /**
+     * Wait on the game thread for outstanding shader compiles, applying finished
+     * results as they come in. Streamed requests get progress in jobs done.
+     * @return True if compilation finished within Timeout
+     */
+    bool WaitForShaderCompiles(double Timeout, double& OutSeconds)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        const int32 InitialJobs = GShaderCompilingManager->GetNumRemainingJobs();
+        bool bFinished = true;
+        while (GShaderCompilingManager->IsCompiling())
+        {
+            const int32 Remaining = GShaderCompilingManager->GetNumRemainingJobs();
+            if (FPlatformTime::Seconds() - StartTime > Timeout ||
+                !FMCPProgressChannel::Report(FMath::Max(0, InitialJobs - Remaining), InitialJobs, FString::Printf(TEXT("%d shader jobs remaining"), Remaining)))
+            {
+                bFinished = false;
+                break;
+            }
+
+            // Finished jobs only reach their materials when results are processed
+            GShaderCompilingManager->ProcessAsyncResults(true, false);
+            FPlatformProcess::Sleep(MCP_SHADER_WAIT_POLL_SECONDS);
+        }
+        GShaderCompilingManager->ProcessAsyncResults(false, false);
+        OutSeconds = FPlatformTime::Seconds() - StartTime;
+        return bFinished;
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleCreateMaterialInstances(const FMCPCreateMaterialInstancesParams& Params)
+{
+    const TArray<FJsonObjectWrapper>& Instances = Params.Instances;
+    if (Instances.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'instances' must be a non-empty array"));
+    }
+
+    TMap<FString, UObject*> AssetCache;
+    UMaterialInterface* DefaultParent = nullptr;
+    if (!Params.Parent.IsEmpty())
+    {
+        DefaultParent = Cast<UMaterialInterface>(LoadCachedAsset(Params.Parent, AssetCache));
+        if (!DefaultParent)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent material not found: %s"), *Params.Parent));
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const int32 JobsBefore = GShaderCompilingManager->GetNumRemainingJobs();
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    auto FailInstance = [&Errors](int32 Index, const FString& Error)
+    {
+        if (Errors.Num() < MCP_MAX_REPORTED_ROW_ERRORS)
+        {
+            TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+            ErrorObj->SetNumberField(TEXT("index"), Index);
+            ErrorObj->SetStringField(TEXT("error"), Error);
+            Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+        }
+    };
+
+    // Pass 1: create every instance and set its parameters with the editor-only setters, which compile nothing
+    TArray<TPair<UMaterialInstanceConstant*, const FMaterialInstanceSpec*>> Configured;
+    TArray<FMaterialInstanceSpec> Specs;
+    Specs.SetNum(Instances.Num());
+    TArray<TSharedPtr<FJsonValue>> InstanceArray;
+    int32 NumCreated = 0;
+    for (int32 Index = 0; Index < Instances.Num(); ++Index)
+    {
+        FString Error;
+        FMaterialInstanceSpec& Spec = Specs[Index];
+        if (!ParseMaterialInstanceSpec(Instances[Index].JsonObject, Params.Path, DefaultParent, AssetCache, Spec, Error))
+        {
+            FailInstance(Index, Error);
+            continue;
+        }
+
+        UMaterialInstanceConstant* Instance = nullptr;
+        const bool bExists = UEditorAssetLibrary::DoesAssetExist(Spec.Path);
+        if (bExists)
+        {
+            Instance = Cast<UMaterialInstanceConstant>(UEditorAssetLibrary::LoadAsset(Spec.Path));
+            if (!Instance)
+            {
+                FailInstance(Index, FString::Printf(TEXT("%s exists and is not a material instance"), *Spec.Path));
+                continue;
+            }
+            Instance->Modify();
+        }
+        else
+        {
+            UPackage* Package = CreatePackage(*Spec.Path);
+            if (!Package)
+            {
+                FailInstance(Index, FString::Printf(TEXT("Failed to create package %s"), *Spec.Path));
+                continue;
+            }
+            Instance = NewObject<UMaterialInstanceConstant>(Package, FName(*FPackageName::GetLongPackageAssetName(Spec.Path)),
+                RF_Public | RF_Standalone | RF_Transactional);
+            ++NumCreated;
+        }
+
+        Instance->SetParentEditorOnly(Spec.Parent, false);
+        for (const TPair<FName, float>& Scalar : Spec.Scalars)
+        {
+            Instance->SetScalarParameterValueEditorOnly(FMaterialParameterInfo(Scalar.Key), Scalar.Value);
+        }
+        for (const TPair<FName, FLinearColor>& Vector : Spec.Vectors)
+        {
+            Instance->SetVectorParameterValueEditorOnly(FMaterialParameterInfo(Vector.Key), Vector.Value);
+        }
+        for (const TPair<FName, UTexture*>& Texture : Spec.Textures)
+        {
+            Instance->SetTextureParameterValueEditorOnly(FMaterialParameterInfo(Texture.Key), Texture.Value);
+        }
+        if (!bExists)
+        {
+            FAssetRegistryModule::AssetCreated(Instance);
+        }
+        Instance->MarkPackageDirty();
+        Configured.Emplace(Instance, &Spec);
+
+        TSharedPtr<FJsonObject> InstanceObj = MakeShared<FJsonObject>();
+        InstanceObj->SetStringField(TEXT("path"), Instance->GetPathName());
+        InstanceObj->SetStringField(TEXT("parent"), Spec.Parent->GetPathName());
+        InstanceObj->SetBoolField(TEXT("created"), !bExists);
+        InstanceArray.Add(MakeShared<FJsonValueObject>(InstanceObj));
+    }
+    const double ConfigureSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // Pass 2: one update per instance. Static switches are the only edits that need new shaders;
+    // each distinct parent and switch set is one permutation, queued once and compiled in the background
+    TSet<FString> Permutations;
+    for (const TPair<UMaterialInstanceConstant*, const FMaterialInstanceSpec*>& Pair : Configured)
+    {
+        UMaterialInstanceConstant* Instance = Pair.Key;
+        const FMaterialInstanceSpec& Spec = *Pair.Value;
+        if (Spec.Switches.Num() > 0)
+        {
+            FStaticParameterSet StaticParameters;
+            Instance->GetStaticParameterValues(StaticParameters);
+            TArray<FString> Key;
+            for (const TPair<FName, FStaticSwitchSpec>& Switch : Spec.Switches)
+            {
+                const bool bValue = Switch.Value.bValue;
+                FStaticSwitchParameter* Existing = StaticParameters.StaticSwitchParameters.FindByPredicate(
+                    [&Switch](const FStaticSwitchParameter& Parameter) { return Parameter.ParameterInfo.Name == Switch.Key; });
+                if (Existing)
+                {
+                    Existing->Value = bValue;
+                    Existing->bOverride = true;
+                }
+                else
+                {
+                    StaticParameters.StaticSwitchParameters.Emplace(FMaterialParameterInfo(Switch.Key), bValue, true, Switch.Value.ExpressionGuid);
+                }
+                Key.Add(FString::Printf(TEXT("%s=%d"), *Switch.Key.ToString(), bValue ? 1 : 0));
+            }
+            Key.Sort();
+            Permutations.Add(Spec.Parent->GetPathName() + TEXT(":") + FString::Join(Key, TEXT(",")));
+            Instance->UpdateStaticPermutation(StaticParameters);
+        }
+        Instance->PostEditChange();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("instances"), InstanceArray);
+    ResultObj->SetNumberField(TEXT("created"), NumCreated);
+    ResultObj->SetNumberField(TEXT("updated"), Configured.Num() - NumCreated);
+    ResultObj->SetNumberField(TEXT("failed"), Instances.Num() - Configured.Num());
+    ResultObj->SetNumberField(TEXT("static_permutations"), Permutations.Num());
+    ResultObj->SetNumberField(TEXT("shader_jobs_queued"), FMath::Max(0, GShaderCompilingManager->GetNumRemainingJobs() - JobsBefore));
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+
+    TSharedPtr<FJsonObject> TimingObj = MakeShared<FJsonObject>();
+    TimingObj->SetNumberField(TEXT("configure_seconds"), ConfigureSeconds);
+    TimingObj->SetNumberField(TEXT("update_seconds"), FPlatformTime::Seconds() - StartTime - ConfigureSeconds);
+    if (Params.bWait)
+    {
+        double WaitSeconds = 0.0;
+        ResultObj->SetBoolField(TEXT("compiles_finished"), WaitForShaderCompiles(Params.Timeout, WaitSeconds));
+        TimingObj->SetNumberField(TEXT("compile_wait_seconds"), WaitSeconds);
+    }
+    ResultObj->SetObjectField(TEXT("timing"), TimingObj);
+    ResultObj->SetObjectField(TEXT("shader_compile"), MakeShaderCompileStatus());
+
+    UE_LOG(LogTemp, Log, TEXT("HandleCreateMaterialInstances: %d created, %d updated, %d static permutations in %.2f s"),
+        NumCreated, Configured.Num() - NumCreated, Permutations.Num(), FPlatformTime::Seconds() - StartTime);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleGetShaderCompileStatus(const FMCPGetShaderCompileStatusParams& Params)
+{
+    return MakeShaderCompileStatus();
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPAssetCommands::HandleWaitForShaderCompiles(const FMCPWaitForShaderCompilesParams& Params)
+{
+    double WaitSeconds = 0.0;
+    const bool bFinished = WaitForShaderCompiles(Params.Timeout, WaitSeconds);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShaderCompileStatus();
+    ResultObj->SetBoolField(TEXT("finished"), bFinished);
+    ResultObj->SetNumberField(TEXT("waited_seconds"), WaitSeconds);
+
+    UE_LOG(LogTemp, Log, TEXT("HandleWaitForShaderCompiles: %s after %.2f s"), bFinished ? TEXT("finished") : TEXT("still compiling"), WaitSeconds);
+    return ResultObj;
+}
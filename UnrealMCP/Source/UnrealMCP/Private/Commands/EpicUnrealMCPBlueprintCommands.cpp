@@ -1,5 +1,8 @@
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPCommandRegistry.h"
+#include "MCPPropertyPath.h"
+#include "MCPActorSnapshot.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -19,8 +22,10 @@
 #include "Engine/Engine.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "ScopedTransaction.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
+#include "Engine/InheritableComponentHandler.h"
 #include "UObject/Field.h"
 #include "UObject/FieldPath.h"
 #include "EditorAssetLibrary.h"
@@ -33,6 +38,9 @@
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
 
+// Per-instance spawn errors reported back before the rest are only counted
+#define MCP_MAX_REPORTED_SPAWN_ERRORS 20
+
 FEpicUnrealMCPBlueprintCommands::FEpicUnrealMCPBlueprintCommands()
 {
 }
@@ -47,6 +55,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FSt
     {
         return HandleAddComponentToBlueprint(Params);
     }
+    else if (CommandType == TEXT("define_components"))
+    {
+        return HandleDefineComponents(Params);
+    }
     else if (CommandType == TEXT("set_physics_properties"))
     {
         return HandleSetPhysicsProperties(Params);
@@ -63,6 +75,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FSt
     {
         return HandleSpawnBlueprintActor(Params);
     }
+    else if (CommandType == TEXT("spawn_blueprint_actors"))
+    {
+        return HandleSpawnBlueprintActors(Params);
+    }
     else if (CommandType == TEXT("set_mesh_material_color"))
     {
         return HandleSetMeshMaterialColor(Params);
@@ -114,6 +130,120 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FSt
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
 }
 
+void FEpicUnrealMCPBlueprintCommands::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+    const FMCPCommandHandler Handler = [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+    {
+        return HandleCommand(CommandType, Params);
+    };
+
+    Registry.Register(TEXT("create_blueprint"), TEXT("Create a new Blueprint class"), {
+        { TEXT("name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("parent_class"), EMCPParamType::String, true, TEXT("Parent class, e.g. Actor or Pawn") }
+    }, Handler);
+    Registry.Register(TEXT("add_component_to_blueprint"), TEXT("Add a component to a Blueprint"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_type"), EMCPParamType::String, true, TEXT("Component class, e.g. StaticMeshComponent") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") },
+        { TEXT("location"), EMCPParamType::Vector, false, TEXT("Relative location [X, Y, Z]") },
+        { TEXT("rotation"), EMCPParamType::Vector, false, TEXT("Relative rotation [Pitch, Yaw, Roll]") },
+        { TEXT("scale"), EMCPParamType::Vector, false, TEXT("Relative scale [X, Y, Z]") },
+        { TEXT("component_properties"), EMCPParamType::Object, false, TEXT("Additional properties to set on the component") }
+    }, Handler);
+    Registry.Register(TEXT("define_components"), TEXT("Build or update a Blueprint's component tree in one edit and one compile"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("components"), EMCPParamType::Array, true, TEXT("Components in parent-first order: {name, type, parent, location, rotation, scale, static_mesh, material, materials, physics: {simulate_physics, gravity_enabled, mass, linear_damping, angular_damping, collision_profile}, properties}") },
+        { TEXT("replace"), EMCPParamType::Boolean, false, TEXT("Remove the Blueprint's existing components first") },
+        { TEXT("compile"), EMCPParamType::Boolean, false, TEXT("Compile once at the end (default true)") }
+    }, Handler);
+    Registry.Register(TEXT("set_physics_properties"), TEXT("Set physics properties on a Blueprint component"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") },
+        { TEXT("simulate_physics"), EMCPParamType::Boolean, false, TEXT("Enable physics simulation") },
+        { TEXT("gravity_enabled"), EMCPParamType::Boolean, false, TEXT("Enable gravity") },
+        { TEXT("mass"), EMCPParamType::Number, false, TEXT("Mass in kg") },
+        { TEXT("linear_damping"), EMCPParamType::Number, false, TEXT("Linear damping") },
+        { TEXT("angular_damping"), EMCPParamType::Number, false, TEXT("Angular damping") }
+    }, Handler);
+    Registry.Register(TEXT("compile_blueprint"), TEXT("Compile a Blueprint"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") }
+    }, Handler);
+    Registry.Register(TEXT("set_static_mesh_properties"), TEXT("Set the mesh of a Blueprint's StaticMeshComponent"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") },
+        { TEXT("static_mesh"), EMCPParamType::String, false, TEXT("Static mesh asset path") }
+    }, Handler);
+    Registry.Register(TEXT("set_mesh_material_color"), TEXT("Set a color parameter on a mesh component's material"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") },
+        { TEXT("color"), EMCPParamType::Array, true, TEXT("Color [R, G, B, A] in 0..1") },
+        { TEXT("material_path"), EMCPParamType::String, false, TEXT("Material to instance") },
+        { TEXT("parameter_name"), EMCPParamType::String, false, TEXT("Vector parameter name") },
+        { TEXT("material_slot"), EMCPParamType::Integer, false, TEXT("Material slot index") }
+    }, Handler);
+    Registry.Register(TEXT("spawn_blueprint_actors"), TEXT("Spawn many instances of a Blueprint in one call, with per-instance property overrides applied before construction"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name or path") },
+        { TEXT("transforms"), EMCPParamType::NumberArray, true, TEXT("Rows of [X, Y, Z], [X, Y, Z, Pitch, Yaw, Roll] or [X, Y, Z, Pitch, Yaw, Roll, SX, SY, SZ]") },
+        { TEXT("names"), EMCPParamType::Array, false, TEXT("Actor name per instance; taken names get a numeric suffix") },
+        { TEXT("name_prefix"), EMCPParamType::String, false, TEXT("Name instances <prefix>_<index> when names is not given") },
+        { TEXT("properties"), EMCPParamType::Object, false, TEXT("Property paths set on every instance before its construction script runs") },
+        { TEXT("overrides"), EMCPParamType::Array, false, TEXT("Per-instance property path objects (or null), applied after properties") },
+        { TEXT("parent"), EMCPParamType::String, false, TEXT("Group (or any actor) to attach every instance to, keeping world transforms") },
+        { TEXT("folder"), EMCPParamType::String, false, TEXT("Outliner folder for the instances") }
+    }, Handler);
+    Registry.RegisterTyped<FMCPCreateBlueprintVariantParams>(TEXT("create_blueprint_variant"), TEXT("Duplicate a template Blueprint and apply component, default and color overrides in one call"),
+        [this](const FMCPCreateBlueprintVariantParams& Params) { return HandleCreateBlueprintVariant(Params); });
+    Registry.Register(TEXT("get_available_materials"), TEXT("List materials in the project"), {
+        { TEXT("search_path"), EMCPParamType::String, false, TEXT("Content path to search") },
+        { TEXT("include_engine_materials"), EMCPParamType::Boolean, false, TEXT("Include /Engine materials") }
+    }, Handler);
+    Registry.Register(TEXT("apply_material_to_actor"), TEXT("Apply a material to an actor in the level"), {
+        { TEXT("actor_name"), EMCPParamType::String, true, TEXT("Actor name") },
+        { TEXT("material_path"), EMCPParamType::String, true, TEXT("Material asset path") },
+        { TEXT("material_slot"), EMCPParamType::Integer, false, TEXT("Material slot index") }
+    }, Handler);
+    Registry.Register(TEXT("apply_material_to_blueprint"), TEXT("Apply a material to a Blueprint component"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") },
+        { TEXT("material_path"), EMCPParamType::String, true, TEXT("Material asset path") },
+        { TEXT("material_slot"), EMCPParamType::Integer, false, TEXT("Material slot index") }
+    }, Handler);
+    Registry.Register(TEXT("get_actor_material_info"), TEXT("Get the materials applied to an actor"), {
+        { TEXT("actor_name"), EMCPParamType::String, true, TEXT("Actor name") }
+    }, Handler);
+    Registry.Register(TEXT("get_blueprint_material_info"), TEXT("Get the materials of a Blueprint component"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("component_name"), EMCPParamType::String, true, TEXT("Component name") }
+    }, Handler);
+    Registry.Register(TEXT("read_blueprint_content"), TEXT("Read a Blueprint's graphs, functions, variables, components and interfaces"), {
+        { TEXT("blueprint_path"), EMCPParamType::String, true, TEXT("Blueprint asset path") },
+        { TEXT("include_event_graph"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("include_functions"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("include_variables"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("include_components"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("include_interfaces"), EMCPParamType::Boolean, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("analyze_blueprint_graph"), TEXT("Analyze the nodes, connections and execution flow of one Blueprint graph"), {
+        { TEXT("blueprint_path"), EMCPParamType::String, true, TEXT("Blueprint asset path") },
+        { TEXT("graph_name"), EMCPParamType::String, false, TEXT("Graph to analyze (default EventGraph)") },
+        { TEXT("include_node_details"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("include_pin_connections"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("trace_execution_flow"), EMCPParamType::Boolean, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("get_blueprint_variable_details"), TEXT("Get type, default value and flags of Blueprint variables"), {
+        { TEXT("blueprint_path"), EMCPParamType::String, true, TEXT("Blueprint asset path") },
+        { TEXT("variable_name"), EMCPParamType::String, false, TEXT("Single variable to describe (all when omitted)") }
+    }, Handler);
+    Registry.Register(TEXT("get_blueprint_function_details"), TEXT("Get parameters and graphs of Blueprint functions"), {
+        { TEXT("blueprint_path"), EMCPParamType::String, true, TEXT("Blueprint asset path") },
+        { TEXT("function_name"), EMCPParamType::String, false, TEXT("Single function to describe (all when omitted)") },
+        { TEXT("include_graph"), EMCPParamType::Boolean, false, TEXT("Include the function graph's nodes") }
+    }, Handler);
+    Registry.Register(TEXT("open_asset_in_editor"), TEXT("Open an asset in its editor"), {
+        { TEXT("asset_path"), EMCPParamType::String, true, TEXT("Asset path") }
+    }, Handler);
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -209,6 +339,40 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateBlueprint(c
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create blueprint"));
 }
 
+namespace
+{
+    // Component class from a type name such as "StaticMeshComponent", "StaticMesh" or "UStaticMeshComponent"
+    UClass* FindComponentClass(const FString& ComponentType)
+    {
+        // Try to find the class with exact name first
+        UClass* ComponentClass = FindObject<UClass>(nullptr, *ComponentType);
+        
+        // If not found, try with "Component" suffix
+        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+        {
+            FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
+            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithSuffix);
+        }
+        
+        // If still not found, try with "U" prefix
+        if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
+        {
+            FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
+            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithPrefix);
+            
+            // Try with both prefix and suffix
+            if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
+            {
+                FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
+                ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithBoth);
+            }
+        }
+        
+        // Verify that the class is a valid component type
+        return ComponentClass && ComponentClass->IsChildOf(UActorComponent::StaticClass()) ? ComponentClass : nullptr;
+    }
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -238,34 +402,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlu
     }
 
     // Create the component - dynamically find the component class by name
-    UClass* ComponentClass = nullptr;
-
-    // Try to find the class with exact name first
-    ComponentClass = FindObject<UClass>(nullptr, *ComponentType);
-    
-    // If not found, try with "Component" suffix
-    if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-    {
-        FString ComponentTypeWithSuffix = ComponentType + TEXT("Component");
-        ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithSuffix);
-    }
-    
-    // If still not found, try with "U" prefix
-    if (!ComponentClass && !ComponentType.StartsWith(TEXT("U")))
-    {
-        FString ComponentTypeWithPrefix = TEXT("U") + ComponentType;
-        ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithPrefix);
-        
-        // Try with both prefix and suffix
-        if (!ComponentClass && !ComponentType.EndsWith(TEXT("Component")))
-        {
-            FString ComponentTypeWithBoth = TEXT("U") + ComponentType + TEXT("Component");
-            ComponentClass = FindObject<UClass>(nullptr, *ComponentTypeWithBoth);
-        }
-    }
-    
-    // Verify that the class is a valid component type
-    if (!ComponentClass || !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+    UClass* ComponentClass = FindComponentClass(ComponentType);
+    if (!ComponentClass)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
     }
@@ -307,6 +445,339 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleAddComponentToBlu
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to add component to blueprint"));
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleDefineComponents(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Components = nullptr;
+    if (!Params->TryGetArrayField(TEXT("components"), Components) || Components->Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'components' must be a non-empty array of component definitions"));
+    }
+
+    UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint || !Blueprint->SimpleConstructionScript)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+    USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript;
+
+    bool bReplace = false;
+    Params->TryGetBoolField(TEXT("replace"), bReplace);
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    TArray<TSharedPtr<FJsonValue>> Created;
+    TArray<TSharedPtr<FJsonValue>> Updated;
+    TSharedPtr<FJsonObject> Errors = MakeShared<FJsonObject>();
+
+    // Check every definition against the tree as it will be after 'replace' before touching the
+    // Blueprint, so a batch that fails as a whole leaves the existing components alone
+    USCS_Node* const DefaultRootNode = SCS->GetDefaultSceneRootNode();
+    TMap<FName, UClass*> PlannedClasses;
+    for (USCS_Node* ExistingNode : SCS->GetAllNodes())
+    {
+        if (ExistingNode && (!bReplace || ExistingNode == DefaultRootNode))
+        {
+            PlannedClasses.Add(ExistingNode->GetVariableName(), ExistingNode->ComponentClass);
+        }
+    }
+
+    struct FComponentDefinition
+    {
+        FString Name;
+        TSharedPtr<FJsonObject> Fields;
+        // Class of a component to create; null to update the existing node of that name
+        UClass* NewClass;
+        FName Parent;
+    };
+    TArray<FComponentDefinition> Definitions;
+
+    for (int32 Index = 0; Index < Components->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* DefinitionPtr = nullptr;
+        FString ComponentName;
+        if (!(*Components)[Index]->TryGetObject(DefinitionPtr) || !(*DefinitionPtr)->TryGetStringField(TEXT("name"), ComponentName))
+        {
+            Errors->SetStringField(FString::Printf(TEXT("[%d]"), Index), TEXT("Component definitions need a 'name'"));
+            continue;
+        }
+        const TSharedPtr<FJsonObject>& Definition = *DefinitionPtr;
+
+        FString ComponentType;
+        Definition->TryGetStringField(TEXT("type"), ComponentType);
+        UClass* ComponentClass = ComponentType.IsEmpty() ? nullptr : FindComponentClass(ComponentType);
+        if (!ComponentType.IsEmpty() && !ComponentClass)
+        {
+            Errors->SetStringField(ComponentName, FString::Printf(TEXT("Unknown component type: %s"), *ComponentType));
+            continue;
+        }
+
+        // Existing nodes of the same name are updated in place
+        const FName NodeName(*ComponentName);
+        if (UClass* const* ExistingClass = PlannedClasses.Find(NodeName))
+        {
+            if (ComponentClass && *ExistingClass != ComponentClass)
+            {
+                Errors->SetStringField(ComponentName, FString::Printf(TEXT("Existing component is a %s, not %s"),
+                    *GetNameSafe(*ExistingClass), *ComponentType));
+                continue;
+            }
+            Definitions.Add({ ComponentName, Definition, nullptr, NAME_None });
+            continue;
+        }
+
+        if (!ComponentClass)
+        {
+            Errors->SetStringField(ComponentName, TEXT("New components need a 'type'"));
+            continue;
+        }
+
+        FName ParentNodeName;
+        FString ParentName;
+        if (Definition->TryGetStringField(TEXT("parent"), ParentName))
+        {
+            UClass* const* ParentClass = PlannedClasses.Find(FName(*ParentName));
+            if (!ParentClass || !*ParentClass || !(*ParentClass)->IsChildOf(USceneComponent::StaticClass()))
+            {
+                Errors->SetStringField(ComponentName, FString::Printf(TEXT("Parent scene component not found: %s (parents must come first)"), *ParentName));
+                continue;
+            }
+            ParentNodeName = FName(*ParentName);
+        }
+
+        PlannedClasses.Add(NodeName, ComponentClass);
+        Definitions.Add({ ComponentName, Definition, ComponentClass, ParentNodeName });
+    }
+
+    if (Definitions.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No components defined on %s: %s"),
+            *BlueprintName, *Errors->Values.CreateConstIterator().Value()->AsString()));
+    }
+
+    // The whole tree is one undoable SCS edit: nodes are added and their templates filled in without
+    // per-node notifications, then the Blueprint is marked structurally modified once
+    const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "DefineComponents", "MCP Define Components"));
+    Blueprint->Modify();
+    SCS->Modify();
+    if (bReplace)
+    {
+        const TArray<USCS_Node*> ExistingNodes = SCS->GetAllNodes();
+        for (int32 Index = ExistingNodes.Num() - 1; Index >= 0; --Index)
+        {
+            if (ExistingNodes[Index] && ExistingNodes[Index] != DefaultRootNode)
+            {
+                SCS->RemoveNode(ExistingNodes[Index], false);
+            }
+        }
+    }
+
+    for (const FComponentDefinition& Component : Definitions)
+    {
+        const FString& ComponentName = Component.Name;
+        const TSharedPtr<FJsonObject>& Definition = Component.Fields;
+
+        USCS_Node* Node = nullptr;
+        if (Component.NewClass)
+        {
+            USCS_Node* ParentNode = Component.Parent.IsNone() ? nullptr : SCS->FindSCSNode(Component.Parent);
+            if (!Component.Parent.IsNone() && !ParentNode)
+            {
+                Errors->SetStringField(ComponentName, FString::Printf(TEXT("Parent %s could not be created"), *Component.Parent.ToString()));
+                continue;
+            }
+
+            Node = SCS->CreateNode(Component.NewClass, FName(*ComponentName));
+            if (!Node)
+            {
+                Errors->SetStringField(ComponentName, TEXT("Failed to create component node"));
+                continue;
+            }
+            if (ParentNode)
+            {
+                ParentNode->AddChildNode(Node);
+            }
+            else
+            {
+                SCS->AddNode(Node);
+            }
+            Created.Add(MakeShared<FJsonValueString>(ComponentName));
+        }
+        else
+        {
+            Node = SCS->FindSCSNode(FName(*ComponentName));
+            if (!Node)
+            {
+                Errors->SetStringField(ComponentName, TEXT("Component could not be created"));
+                continue;
+            }
+            Updated.Add(MakeShared<FJsonValueString>(ComponentName));
+        }
+
+        UActorComponent* Template = Node->ComponentTemplate;
+        Template->Modify();
+        TArray<FString> ComponentErrors;
+
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Template))
+        {
+            if (Definition->HasField(TEXT("location")))
+            {
+                SceneComponent->SetRelativeLocation(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Definition, TEXT("location")));
+            }
+            if (Definition->HasField(TEXT("rotation")))
+            {
+                SceneComponent->SetRelativeRotation(FEpicUnrealMCPCommonUtils::GetRotatorFromJson(Definition, TEXT("rotation")));
+            }
+            if (Definition->HasField(TEXT("scale")))
+            {
+                SceneComponent->SetRelativeScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Definition, TEXT("scale")));
+            }
+        }
+
+        FString MeshPath;
+        if (Definition->TryGetStringField(TEXT("static_mesh"), MeshPath))
+        {
+            UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Template);
+            UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+            if (MeshComponent && Mesh)
+            {
+                MeshComponent->SetStaticMesh(Mesh);
+            }
+            else
+            {
+                ComponentErrors.Add(MeshComponent ? FString::Printf(TEXT("Static mesh not found: %s"), *MeshPath) : TEXT("static_mesh needs a StaticMeshComponent"));
+            }
+        }
+
+        // "material" fills slot 0; "materials" lists paths by slot, null to skip a slot
+        TArray<TSharedPtr<FJsonValue>> MaterialPaths;
+        const TArray<TSharedPtr<FJsonValue>>* MaterialArray = nullptr;
+        if (Definition->TryGetArrayField(TEXT("materials"), MaterialArray))
+        {
+            MaterialPaths = *MaterialArray;
+        }
+        else if (Definition->HasField(TEXT("material")))
+        {
+            MaterialPaths.Add(Definition->TryGetField(TEXT("material")));
+        }
+
+        UPrimitiveComponent* PrimComponent = Cast<UPrimitiveComponent>(Template);
+        for (int32 Slot = 0; Slot < MaterialPaths.Num(); ++Slot)
+        {
+            FString MaterialPath;
+            if (!MaterialPaths[Slot].IsValid() || !MaterialPaths[Slot]->TryGetString(MaterialPath))
+            {
+                continue;
+            }
+            UMaterialInterface* Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(MaterialPath));
+            if (PrimComponent && Material)
+            {
+                PrimComponent->SetMaterial(Slot, Material);
+            }
+            else
+            {
+                ComponentErrors.Add(PrimComponent ? FString::Printf(TEXT("Material not found: %s"), *MaterialPath) : TEXT("Materials need a primitive component"));
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* Physics = nullptr;
+        if (Definition->TryGetObjectField(TEXT("physics"), Physics))
+        {
+            if (PrimComponent)
+            {
+                bool bValue = false;
+                double Number = 0.0;
+                FString CollisionProfile;
+                if ((*Physics)->TryGetBoolField(TEXT("simulate_physics"), bValue))
+                {
+                    PrimComponent->SetSimulatePhysics(bValue);
+                }
+                if ((*Physics)->TryGetBoolField(TEXT("gravity_enabled"), bValue))
+                {
+                    PrimComponent->SetEnableGravity(bValue);
+                }
+                if ((*Physics)->TryGetNumberField(TEXT("mass"), Number))
+                {
+                    PrimComponent->SetMassOverrideInKg(NAME_None, Number);
+                }
+                if ((*Physics)->TryGetNumberField(TEXT("linear_damping"), Number))
+                {
+                    PrimComponent->SetLinearDamping(Number);
+                }
+                if ((*Physics)->TryGetNumberField(TEXT("angular_damping"), Number))
+                {
+                    PrimComponent->SetAngularDamping(Number);
+                }
+                if ((*Physics)->TryGetStringField(TEXT("collision_profile"), CollisionProfile))
+                {
+                    PrimComponent->SetCollisionProfileName(FName(*CollisionProfile));
+                }
+            }
+            else
+            {
+                ComponentErrors.Add(TEXT("physics needs a primitive component"));
+            }
+        }
+
+        // Anything else by property path, without per-property edit notifications
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (Definition->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+            {
+                FString Error;
+                if (!FMCPPropertyPath::SetValue(Template, Property.Key, Property.Value, Error, false))
+                {
+                    ComponentErrors.Add(FString::Printf(TEXT("%s: %s"), *Property.Key, *Error));
+                }
+            }
+        }
+
+        if (ComponentErrors.Num() > 0)
+        {
+            Errors->SetStringField(ComponentName, FString::Join(ComponentErrors, TEXT("; ")));
+        }
+    }
+
+    const bool bChanged = bReplace || Created.Num() > 0 || Updated.Num() > 0;
+    if (bChanged)
+    {
+        SCS->ValidateSceneRootNodes();
+
+        // A full compile regenerates the skeleton too, so only one of the two is needed
+        if (bCompile)
+        {
+            FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        }
+        else
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        }
+    }
+
+    if (Created.Num() == 0 && Updated.Num() == 0 && Errors->Values.Num() > 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("No components defined on %s: %s"),
+            *BlueprintName, *Errors->Values.CreateConstIterator().Value()->AsString()));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), BlueprintName);
+    ResultObj->SetArrayField(TEXT("created"), Created);
+    ResultObj->SetArrayField(TEXT("updated"), Updated);
+    ResultObj->SetBoolField(TEXT("compiled"), bChanged && bCompile);
+    if (Errors->Values.Num() > 0)
+    {
+        ResultObj->SetObjectField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -464,6 +935,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
     }
 
+    FString ParentName;
+    FString Folder;
+    Params->TryGetStringField(TEXT("parent"), ParentName);
+    Params->TryGetStringField(TEXT("folder"), Folder);
+
+    AActor* Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, ParentName);
+    if (!ParentName.IsEmpty() && !Parent)
+    {
+        UE_LOG(LogTemp, Error, TEXT("HandleSpawnBlueprintActor: Parent actor not found: %s"), *ParentName);
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *ParentName));
+    }
+
     UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Creating spawn transform"));
 
     FTransform SpawnTransform;
@@ -485,6 +968,11 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
     {
         UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Setting actor label to '%s'"), *ActorName);
         NewActor->SetActorLabel(*ActorName);
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(NewActor, Parent, Folder))
+        {
+            NewActor->Destroy();
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Could not attach to %s"), *ParentName));
+        }
         
         UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: About to convert actor to JSON"));
         TSharedPtr<FJsonObject> Result = FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
@@ -497,6 +985,173 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintAct
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn blueprint actor"));
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintActors(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    TArray<FTransform> Transforms;
+    if (!FEpicUnrealMCPCommonUtils::GetTransformArrayFromJson(Params, TEXT("transforms"), Transforms))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'transforms' must be rows of 3, 6 or 9 numbers"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Names = nullptr;
+    if (Params->TryGetArrayField(TEXT("names"), Names) && Names->Num() != Transforms.Num())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("'names' has %d entries for %d transforms"), Names->Num(), Transforms.Num()));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Overrides = nullptr;
+    if (Params->TryGetArrayField(TEXT("overrides"), Overrides) && Overrides->Num() != Transforms.Num())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("'overrides' has %d entries for %d transforms"), Overrides->Num(), Transforms.Num()));
+    }
+
+    FString NamePrefix;
+    Params->TryGetStringField(TEXT("name_prefix"), NamePrefix);
+
+    const TSharedPtr<FJsonObject>* SharedProperties = nullptr;
+    Params->TryGetObjectField(TEXT("properties"), SharedProperties);
+
+    // Resolved once for the whole batch
+    UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint || !Blueprint->GeneratedClass || !Blueprint->GeneratedClass->IsChildOf(AActor::StaticClass()))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor blueprint not found: %s"), *BlueprintName));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    FString ParentName;
+    FString Folder;
+    Params->TryGetStringField(TEXT("parent"), ParentName);
+    Params->TryGetStringField(TEXT("folder"), Folder);
+
+    AActor* Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, ParentName);
+    if (!ParentName.IsEmpty() && !Parent)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *ParentName));
+    }
+
+    // One entry per transform, null where the instance failed, so actors[i] belongs to transforms[i]
+    TArray<TSharedPtr<FJsonValue>> Handles;
+    Handles.Reserve(Transforms.Num());
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    int32 NumSpawned = 0;
+    int32 NumFailed = 0;
+
+    auto FailInstance = [&Errors, &NumFailed](int32 Index, const FString& Error)
+    {
+        if (Errors.Num() < MCP_MAX_REPORTED_SPAWN_ERRORS)
+        {
+            TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+            ErrorObj->SetNumberField(TEXT("index"), Index);
+            ErrorObj->SetStringField(TEXT("error"), Error);
+            Errors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+        }
+        ++NumFailed;
+    };
+
+    for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+    {
+        FString ActorName;
+        if (Names)
+        {
+            ActorName = (*Names)[Index]->AsString();
+        }
+        else if (!NamePrefix.IsEmpty())
+        {
+            ActorName = FString::Printf(TEXT("%s_%d"), *NamePrefix, Index);
+        }
+
+        // Construction is deferred so overrides, e.g. of expose-on-spawn variables, are in place
+        // before the construction script runs; taken names get a suffix instead of failing
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = ActorName.IsEmpty() ? NAME_None : FName(*ActorName);
+        SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+        SpawnParams.bDeferConstruction = true;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        AActor* NewActor = World->SpawnActor<AActor>(Blueprint->GeneratedClass, Transforms[Index], SpawnParams);
+        if (!NewActor)
+        {
+            FailInstance(Index, TEXT("Failed to spawn actor"));
+            Handles.Add(MakeShared<FJsonValueNull>());
+            continue;
+        }
+
+        FString Error;
+        const TSharedPtr<FJsonObject>* InstanceProperties = nullptr;
+        const TSharedPtr<FJsonObject>* PropertySets[] = {
+            SharedProperties,
+            Overrides && (*Overrides)[Index]->TryGetObject(InstanceProperties) ? InstanceProperties : nullptr
+        };
+        for (const TSharedPtr<FJsonObject>* PropertySet : PropertySets)
+        {
+            if (!PropertySet)
+            {
+                continue;
+            }
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*PropertySet)->Values)
+            {
+                // No edit notifications: the actor hasn't been constructed yet
+                FString PropertyError;
+                if (!FMCPPropertyPath::SetValue(NewActor, Property.Key, Property.Value, PropertyError, false) && Error.IsEmpty())
+                {
+                    Error = FString::Printf(TEXT("%s: %s"), *Property.Key, *PropertyError);
+                }
+            }
+        }
+
+        NewActor->FinishSpawning(Transforms[Index]);
+        if (!ActorName.IsEmpty())
+        {
+            // The final name, which differs from ActorName when that was taken
+            NewActor->SetActorLabel(NewActor->GetName());
+        }
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(NewActor, Parent, Folder))
+        {
+            // A part left outside its group would not move or delete with it; fail this instance instead
+            FailInstance(Index, FString::Printf(TEXT("Could not attach to %s"), *ParentName));
+            NewActor->Destroy();
+            Handles.Add(MakeShared<FJsonValueNull>());
+            continue;
+        }
+        // Overrides may have moved the actor or changed its bounds after it was first reported
+        FMCPActorSnapshot::NotifyActorChanged(NewActor);
+
+        // The actor is kept even if an override failed; the error says which one
+        if (!Error.IsEmpty())
+        {
+            FailInstance(Index, Error);
+        }
+        Handles.Add(MakeShared<FJsonValueString>(NewActor->GetName()));
+        ++NumSpawned;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("HandleSpawnBlueprintActors: Spawned %d of %d instances of %s"),
+        NumSpawned, Transforms.Num(), *BlueprintName);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint"), Blueprint->GetPathName());
+    ResultObj->SetArrayField(TEXT("actors"), Handles);
+    ResultObj->SetNumberField(TEXT("spawned"), NumSpawned);
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    if (Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetStaticMeshProperties(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
@@ -705,6 +1360,257 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     return ResultObj;
 }
 
+namespace
+{
+    // Template that instances of the Blueprint build the named component from: a node of its own
+    // construction script, an override of a component inherited from a parent Blueprint (created on
+    // first use, so the parent is left untouched), or a native default subobject of its class defaults.
+    // bOutCreatedOverride is set when a new override record was added to the Blueprint's component handler
+    UActorComponent* FindVariantComponent(UBlueprint* Blueprint, FName ComponentName, bool& bOutCreatedOverride)
+    {
+        if (Blueprint->SimpleConstructionScript)
+        {
+            for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+            {
+                if (Node && Node->GetVariableName() == ComponentName)
+                {
+                    return Node->ComponentTemplate;
+                }
+            }
+        }
+
+        for (UBlueprintGeneratedClass* ParentClass = Cast<UBlueprintGeneratedClass>(Blueprint->ParentClass); ParentClass;
+             ParentClass = Cast<UBlueprintGeneratedClass>(ParentClass->GetSuperClass()))
+        {
+            if (!ParentClass->SimpleConstructionScript)
+            {
+                continue;
+            }
+            for (USCS_Node* Node : ParentClass->SimpleConstructionScript->GetAllNodes())
+            {
+                if (Node && Node->GetVariableName() == ComponentName)
+                {
+                    UInheritableComponentHandler* InheritedHandler = Blueprint->GetInheritableComponentHandler(true);
+                    const FComponentKey Key(Node);
+                    if (UActorComponent* Override = InheritedHandler->GetOverridenComponentTemplate(Key))
+                    {
+                        return Override;
+                    }
+                    UActorComponent* Created = InheritedHandler->CreateOverridenComponentTemplate(Key);
+                    bOutCreatedOverride |= Created != nullptr;
+                    return Created;
+                }
+            }
+        }
+
+        UObject* Defaults = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+        return Defaults ? Cast<UActorComponent>(Defaults->GetDefaultSubobjectByName(ComponentName)) : nullptr;
+    }
+
+    bool GetColorFromJson(const TSharedPtr<FJsonValue>& Value, FLinearColor& OutColor)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+        if (!Value.IsValid() || !Value->TryGetArray(Items) || (Items->Num() != 3 && Items->Num() != 4))
+        {
+            return false;
+        }
+
+        float Channels[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        for (int32 Index = 0; Index < Items->Num(); ++Index)
+        {
+            double Channel = 0.0;
+            if (!(*Items)[Index].IsValid() || !(*Items)[Index]->TryGetNumber(Channel))
+            {
+                return false;
+            }
+            Channels[Index] = FMath::Clamp(static_cast<float>(Channel), 0.0f, 1.0f);
+        }
+        OutColor = FLinearColor(Channels[0], Channels[1], Channels[2], Channels[3]);
+        return true;
+    }
+
+    // Write a color into the component's dynamic material instance for a slot; an instance the
+    // component already owns (e.g. duplicated from the template) is reused rather than wrapped again
+    bool ApplyMaterialColor(UPrimitiveComponent* Component, int32 MaterialSlot, FName ParameterName, const FLinearColor& Color, FString& OutError)
+    {
+        UMaterialInterface* Material = Component->GetMaterial(MaterialSlot);
+        UMaterialInstanceDynamic* DynMaterial = Cast<UMaterialInstanceDynamic>(Material);
+        if (!DynMaterial || DynMaterial->GetOuter() != Component)
+        {
+            if (!Material)
+            {
+                Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(TEXT("/Engine/BasicShapes/BasicShapeMaterial")));
+            }
+            DynMaterial = Material ? UMaterialInstanceDynamic::Create(Material, Component) : nullptr;
+            if (!DynMaterial)
+            {
+                OutError = TEXT("Failed to create dynamic material instance");
+                return false;
+            }
+            Component->SetMaterial(MaterialSlot, DynMaterial);
+        }
+
+        DynMaterial->SetVectorParameterValue(ParameterName, Color);
+        return true;
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCreateBlueprintVariant(const FMCPCreateBlueprintVariantParams& Params)
+{
+    FString PackagePath = Params.Path;
+    PackagePath.RemoveFromEnd(TEXT("/"));
+    const FString AssetPath = PackagePath / Params.Name;
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), Params.Name);
+    ResultObj->SetStringField(TEXT("path"), AssetPath);
+
+    if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
+    {
+        if (!Params.bReuseExisting)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint already exists: %s"), *AssetPath));
+        }
+        if (!Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(AssetPath)))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Asset exists but is not a Blueprint: %s"), *AssetPath));
+        }
+        ResultObj->SetBoolField(TEXT("created"), false);
+
+        // The existing Blueprint is returned as is; say so rather than dropping the overrides silently
+        const int32 NumIgnored = (Params.Defaults.JsonObject ? Params.Defaults.JsonObject->Values.Num() : 0)
+            + (Params.Components.JsonObject ? Params.Components.JsonObject->Values.Num() : 0)
+            + (Params.Colors.JsonObject ? Params.Colors.JsonObject->Values.Num() : 0);
+        if (NumIgnored > 0)
+        {
+            ResultObj->SetNumberField(TEXT("ignored"), NumIgnored);
+            ResultObj->SetStringField(TEXT("warning"), FString::Printf(
+                TEXT("Blueprint already exists; %d override entries were not applied to it"), NumIgnored));
+        }
+        return ResultObj;
+    }
+
+    UBlueprint* Template = FEpicUnrealMCPCommonUtils::FindBlueprint(Params.Template);
+    if (!Template)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Template blueprint not found: %s"), *Params.Template));
+    }
+
+    // Duplication copies the template's generated class, component templates and class defaults
+    UBlueprint* Variant = Cast<UBlueprint>(UEditorAssetLibrary::DuplicateLoadedAsset(Template, AssetPath));
+    if (!Variant || !Variant->GeneratedClass)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Failed to duplicate %s to %s"), *Template->GetPathName(), *AssetPath));
+    }
+
+    int32 NumSet = 0;
+    int32 NumFailed = 0;
+    bool bCreatedOverride = false;
+    TSharedPtr<FJsonObject> Errors = MakeShared<FJsonObject>();
+
+    if (const TSharedPtr<FJsonObject>& Defaults = Params.Defaults.JsonObject)
+    {
+        UObject* DefaultObject = Variant->GeneratedClass->GetDefaultObject();
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Defaults->Values)
+        {
+            FString Error;
+            if (FMCPPropertyPath::SetValue(DefaultObject, Property.Key, Property.Value, Error))
+            {
+                ++NumSet;
+            }
+            else
+            {
+                Errors->SetStringField(Property.Key, Error);
+                ++NumFailed;
+            }
+        }
+    }
+
+    if (const TSharedPtr<FJsonObject>& Components = Params.Components.JsonObject)
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& ComponentEntry : Components->Values)
+        {
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            UActorComponent* Component = FindVariantComponent(Variant, FName(*ComponentEntry.Key), bCreatedOverride);
+            if (!Component || !ComponentEntry.Value->TryGetObject(Properties))
+            {
+                Errors->SetStringField(ComponentEntry.Key, Component
+                    ? TEXT("Component overrides must be an object of property paths")
+                    : FString::Printf(TEXT("Component not found: %s"), *ComponentEntry.Key));
+                ++NumFailed;
+                continue;
+            }
+
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+            {
+                FString Error;
+                if (FMCPPropertyPath::SetValue(Component, Property.Key, Property.Value, Error))
+                {
+                    ++NumSet;
+                }
+                else
+                {
+                    Errors->SetStringField(ComponentEntry.Key + TEXT(".") + Property.Key, Error);
+                    ++NumFailed;
+                }
+            }
+        }
+    }
+
+    if (const TSharedPtr<FJsonObject>& Colors = Params.Colors.JsonObject)
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& ColorEntry : Colors->Values)
+        {
+            FString Error;
+            FLinearColor Color;
+            UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(FindVariantComponent(Variant, FName(*ColorEntry.Key), bCreatedOverride));
+            if (!Component)
+            {
+                Error = FString::Printf(TEXT("Primitive component not found: %s"), *ColorEntry.Key);
+            }
+            else if (!GetColorFromJson(ColorEntry.Value, Color))
+            {
+                Error = TEXT("Color must be an array of 3 or 4 numbers [R, G, B, A]");
+            }
+            else if (ApplyMaterialColor(Component, Params.MaterialSlot, FName(*Params.ColorParameter), Color, Error))
+            {
+                ++NumSet;
+                continue;
+            }
+            Errors->SetStringField(ColorEntry.Key, Error);
+            ++NumFailed;
+        }
+    }
+
+    // Overrides of class defaults and existing component templates are already used by the duplicated
+    // generated class, so a recompile is only done on request. A new override of an inherited component
+    // only reaches the generated class when it is compiled, so that case always compiles
+    const bool bCompile = Params.bCompile || bCreatedOverride;
+    if (bCompile)
+    {
+        FKismetEditorUtilities::CompileBlueprint(Variant);
+    }
+    else if (NumSet > 0)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Variant);
+    }
+    Variant->MarkPackageDirty();
+
+    UE_LOG(LogTemp, Log, TEXT("HandleCreateBlueprintVariant: Created %s from %s with %d overrides (%d failed)"),
+        *AssetPath, *Template->GetName(), NumSet, NumFailed);
+
+    ResultObj->SetStringField(TEXT("template"), Template->GetPathName());
+    ResultObj->SetBoolField(TEXT("created"), true);
+    ResultObj->SetBoolField(TEXT("compiled"), bCompile);
+    ResultObj->SetNumberField(TEXT("set"), NumSet);
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    if (Errors->Values.Num() > 0)
+    {
+        ResultObj->SetObjectField(TEXT("errors"), Errors);
+    }
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params)
 {
     // Get parameters - make search path completely dynamic
@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPBlueprintGraphCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPCommandRegistry.h"
 #include "Commands/BlueprintGraph/NodeManager.h"
 #include "Commands/BlueprintGraph/BPConnector.h"
 #include "Commands/BlueprintGraph/BPVariables.h"
@@ -71,6 +72,93 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleCommand(cons
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint graph command: %s"), *CommandType));
 }
 
+void FEpicUnrealMCPBlueprintGraphCommands::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+    const FMCPCommandHandler Handler = [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+    {
+        return HandleCommand(CommandType, Params);
+    };
+
+    Registry.Register(TEXT("add_blueprint_node"), TEXT("Add a node to a Blueprint graph"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("node_type"), EMCPParamType::String, true, TEXT("Node type, e.g. Print, VariableGet, CallFunction, Branch") },
+        { TEXT("node_params"), EMCPParamType::Object, false, TEXT("Node settings such as pos_x, pos_y, variable_name, target_function") }
+    }, Handler);
+    Registry.Register(TEXT("connect_nodes"), TEXT("Connect two pins in a Blueprint graph"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("source_node_id"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("source_pin_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("target_node_id"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("target_pin_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("function_name"), EMCPParamType::String, false, TEXT("Function graph (EventGraph when omitted)") }
+    }, Handler);
+    Registry.Register(TEXT("create_variable"), TEXT("Create a Blueprint variable"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("variable_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("variable_type"), EMCPParamType::String, true, TEXT("bool, int, float, string, vector, rotator, ...") },
+        { TEXT("default_value"), EMCPParamType::String, false, TEXT("") },
+        { TEXT("is_public"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("tooltip"), EMCPParamType::String, false, TEXT("") },
+        { TEXT("category"), EMCPParamType::String, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("set_blueprint_variable_properties"), TEXT("Change a Blueprint variable's name, type or metadata"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("variable_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("var_name"), EMCPParamType::String, false, TEXT("New variable name") },
+        { TEXT("var_type"), EMCPParamType::String, false, TEXT("New variable type") },
+        { TEXT("is_public"), EMCPParamType::Boolean, false, TEXT("") },
+        { TEXT("tooltip"), EMCPParamType::String, false, TEXT("") },
+        { TEXT("category"), EMCPParamType::String, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("add_event_node"), TEXT("Add an event node (ReceiveBeginPlay, ReceiveTick, ...) to a Blueprint"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("event_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("pos_x"), EMCPParamType::Number, false, TEXT("") },
+        { TEXT("pos_y"), EMCPParamType::Number, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("delete_node"), TEXT("Delete a node from a Blueprint graph"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("node_id"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("function_name"), EMCPParamType::String, false, TEXT("Function graph (EventGraph when omitted)") }
+    }, Handler);
+    Registry.Register(TEXT("set_node_property"), TEXT("Set a node property or run a semantic node action (add_pin, set_enum_type, ...)"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("node_id"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("property_name"), EMCPParamType::String, false, TEXT("") },
+        { TEXT("property_value"), EMCPParamType::String, false, TEXT("") },
+        { TEXT("action"), EMCPParamType::String, false, TEXT("Semantic action; its arguments are passed as extra parameters") },
+        { TEXT("function_name"), EMCPParamType::String, false, TEXT("Function graph (EventGraph when omitted)") }
+    }, Handler);
+    Registry.Register(TEXT("create_function"), TEXT("Create a Blueprint function"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("function_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("return_type"), EMCPParamType::String, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("add_function_input"), TEXT("Add an input parameter to a Blueprint function"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("function_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("param_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("param_type"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("is_array"), EMCPParamType::Boolean, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("add_function_output"), TEXT("Add an output parameter to a Blueprint function"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("function_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("param_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("param_type"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("is_array"), EMCPParamType::Boolean, false, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("delete_function"), TEXT("Delete a Blueprint function"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("function_name"), EMCPParamType::String, true, TEXT("") }
+    }, Handler);
+    Registry.Register(TEXT("rename_function"), TEXT("Rename a Blueprint function"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name") },
+        { TEXT("old_function_name"), EMCPParamType::String, true, TEXT("") },
+        { TEXT("new_function_name"), EMCPParamType::String, true, TEXT("") }
+    }, Handler);
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleAddBlueprintNode(const TSharedPtr<FJsonObject>& Params)
 {
     // Get required parameters
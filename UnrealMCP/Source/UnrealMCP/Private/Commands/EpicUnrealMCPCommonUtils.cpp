@@ -18,6 +18,7 @@
 #include "Components/SceneComponent.h"
 #include "UObject/UObjectIterator.h"
 #include "Engine/Selection.h"
+#include "EngineUtils.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -25,6 +26,8 @@
 #include "BlueprintActionDatabase.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "MCPRequestParser.h"
+#include "MCPPropertyPath.h"
 
 // JSON Utilities
 TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::CreateErrorResponse(const FString& Message)
@@ -52,6 +55,17 @@ void FEpicUnrealMCPCommonUtils::GetIntArrayFromJson(const TSharedPtr<FJsonObject
 {
     OutArray.Reset();
     
+    // Bulk fields packed by the request parser never reach the DOM
+    if (const FMCPPackedArray* Packed = FMCPBulkParams::FindCurrent(JsonObject, FieldName))
+    {
+        OutArray.Reserve(Packed->Values.Num());
+        for (double Value : Packed->Values)
+        {
+            OutArray.Add((int32)Value);
+        }
+        return;
+    }
+    
     if (!JsonObject->HasField(FieldName))
     {
         return;
@@ -71,6 +85,16 @@ void FEpicUnrealMCPCommonUtils::GetFloatArrayFromJson(const TSharedPtr<FJsonObje
 {
     OutArray.Reset();
     
+    if (const FMCPPackedArray* Packed = FMCPBulkParams::FindCurrent(JsonObject, FieldName))
+    {
+        OutArray.SetNumUninitialized(Packed->Values.Num());
+        for (int32 Index = 0; Index < Packed->Values.Num(); ++Index)
+        {
+            OutArray[Index] = (float)Packed->Values[Index];
+        }
+        return;
+    }
+    
     if (!JsonObject->HasField(FieldName))
     {
         return;
@@ -145,6 +169,88 @@ FRotator FEpicUnrealMCPCommonUtils::GetRotatorFromJson(const TSharedPtr<FJsonObj
     return Result;
 }
 
+namespace
+{
+    // Location, then optional rotation (pitch, yaw, roll) and scale
+    bool MakeTransformFromRow(const double* Row, int32 Stride, FTransform& OutTransform)
+    {
+        if (Stride != 3 && Stride != 6 && Stride != 9)
+        {
+            return false;
+        }
+        
+        const FRotator Rotation = Stride >= 6 ? FRotator(Row[3], Row[4], Row[5]) : FRotator::ZeroRotator;
+        const FVector Scale = Stride == 9 ? FVector(Row[6], Row[7], Row[8]) : FVector::OneVector;
+        OutTransform = FTransform(Rotation, FVector(Row[0], Row[1], Row[2]), Scale);
+        return true;
+    }
+}
+
+bool FEpicUnrealMCPCommonUtils::GetTransformArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<FTransform>& OutTransforms)
+{
+    OutTransforms.Reset();
+    
+    if (const FMCPPackedArray* Packed = FMCPBulkParams::FindCurrent(JsonObject, FieldName))
+    {
+        const int32 NumRows = Packed->NumRows();
+        OutTransforms.SetNum(NumRows);
+        for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+        {
+            if (!MakeTransformFromRow(Packed->Values.GetData() + RowIndex * Packed->Stride, Packed->Stride, OutTransforms[RowIndex]))
+            {
+                OutTransforms.Reset();
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+    if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
+    {
+        return false;
+    }
+    
+    OutTransforms.Reserve(JsonArray->Num());
+    for (const TSharedPtr<FJsonValue>& Item : *JsonArray)
+    {
+        FTransform& Transform = OutTransforms.AddDefaulted_GetRef();
+        
+        // {"location": [...], "rotation": [...], "scale": [...]}
+        const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+        if (Item->TryGetObject(ItemObject))
+        {
+            Transform.SetLocation(GetVectorFromJson(*ItemObject, TEXT("location")));
+            Transform.SetRotation(GetRotatorFromJson(*ItemObject, TEXT("rotation")).Quaternion());
+            if ((*ItemObject)->HasField(TEXT("scale")))
+            {
+                Transform.SetScale3D(GetVectorFromJson(*ItemObject, TEXT("scale")));
+            }
+            continue;
+        }
+        
+        // [x, y, z, pitch, yaw, roll, sx, sy, sz]
+        const TArray<TSharedPtr<FJsonValue>>* Row = nullptr;
+        double RowValues[9];
+        if (!Item->TryGetArray(Row) || Row->Num() > 9)
+        {
+            OutTransforms.Reset();
+            return false;
+        }
+        for (int32 Index = 0; Index < Row->Num(); ++Index)
+        {
+            RowValues[Index] = (*Row)[Index]->AsNumber();
+        }
+        if (!MakeTransformFromRow(RowValues, Row->Num(), Transform))
+        {
+            OutTransforms.Reset();
+            return false;
+        }
+    }
+    
+    return true;
+}
+
 // Blueprint Utilities
 UBlueprint* FEpicUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 {
@@ -471,32 +577,7 @@ TSharedPtr<FJsonValue> FEpicUnrealMCPCommonUtils::ActorToJson(AActor* Actor)
         return MakeShared<FJsonValueNull>();
     }
     
-    TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
-    ActorObject->SetStringField(TEXT("name"), Actor->GetName());
-    ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-    
-    FVector Location = Actor->GetActorLocation();
-    TArray<TSharedPtr<FJsonValue>> LocationArray;
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.X));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Y));
-    LocationArray.Add(MakeShared<FJsonValueNumber>(Location.Z));
-    ActorObject->SetArrayField(TEXT("location"), LocationArray);
-    
-    FRotator Rotation = Actor->GetActorRotation();
-    TArray<TSharedPtr<FJsonValue>> RotationArray;
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Pitch));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Yaw));
-    RotationArray.Add(MakeShared<FJsonValueNumber>(Rotation.Roll));
-    ActorObject->SetArrayField(TEXT("rotation"), RotationArray);
-    
-    FVector Scale = Actor->GetActorScale3D();
-    TArray<TSharedPtr<FJsonValue>> ScaleArray;
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.X));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
-    ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
-    ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
-    
-    return MakeShared<FJsonValueObject>(ActorObject);
+    return MakeShared<FJsonValueObject>(ActorToJsonObject(Actor));
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToJsonObject(AActor* Actor, bool bDetailed)
@@ -530,226 +611,99 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPCommonUtils::ActorToJsonObject(AActor* Act
     ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Y));
     ScaleArray.Add(MakeShared<FJsonValueNumber>(Scale.Z));
     ActorObject->SetArrayField(TEXT("scale"), ScaleArray);
+
+    if (AActor* Parent = Actor->GetAttachParentActor())
+    {
+        ActorObject->SetStringField(TEXT("parent"), Parent->GetName());
+    }
+
+    if (!Actor->GetFolderPath().IsNone())
+    {
+        ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+    }
+
+    if (Actor->Tags.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> TagArray;
+        for (const FName& Tag : Actor->Tags)
+        {
+            TagArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+        }
+        ActorObject->SetArrayField(TEXT("tags"), TagArray);
+    }
     
     return ActorObject;
 }
 
-UK2Node_Event* FEpicUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
+AActor* FEpicUnrealMCPCommonUtils::FindActorByName(UWorld* World, const FString& ActorName)
 {
-    if (!Graph)
+    if (!World || ActorName.IsEmpty())
     {
         return nullptr;
     }
 
-    // Look for existing event nodes
-    for (UEdGraphNode* Node : Graph->Nodes)
+    for (TActorIterator<AActor> It(World); It; ++It)
     {
-        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
+        if (It->GetName() == ActorName)
         {
-            UE_LOG(LogTemp, Display, TEXT("Found existing event node with name: %s"), *EventName);
-            return EventNode;
+            return *It;
         }
     }
-
     return nullptr;
 }
 
-bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
-                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+bool FEpicUnrealMCPCommonUtils::AddActorToGroup(AActor* Actor, AActor* Parent, const FString& Folder)
 {
-    if (!Object)
+    if (!Actor)
     {
-        OutErrorMessage = TEXT("Invalid object");
         return false;
     }
 
-    FProperty* Property = Object->GetClass()->FindPropertyByName(*PropertyName);
-    if (!Property)
+    if (!Folder.IsEmpty())
     {
-        OutErrorMessage = FString::Printf(TEXT("Property not found: %s"), *PropertyName);
-        return false;
+        Actor->SetFolderPath(FName(*Folder));
     }
 
-    void* PropertyAddr = Property->ContainerPtrToValuePtr<void>(Object);
-    
-    // Handle different property types
-    if (Property->IsA<FBoolProperty>())
+    if (!Parent)
     {
-        ((FBoolProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsBool());
         return true;
     }
-    else if (Property->IsA<FIntProperty>())
-    {
-        int32 IntValue = static_cast<int32>(Value->AsNumber());
-        FIntProperty* IntProperty = CastField<FIntProperty>(Property);
-        if (IntProperty)
-        {
-            IntProperty->SetPropertyValue_InContainer(Object, IntValue);
-            return true;
-        }
-    }
-    else if (Property->IsA<FFloatProperty>())
-    {
-        ((FFloatProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsNumber());
-        return true;
-    }
-    else if (Property->IsA<FStrProperty>())
+
+    // A component can't attach under a more mobile parent, e.g. a static mesh part under a movable group root
+    USceneComponent* Root = Actor->GetRootComponent();
+    USceneComponent* ParentRoot = Parent->GetRootComponent();
+    if (Root && ParentRoot && Root->Mobility < ParentRoot->Mobility)
     {
-        ((FStrProperty*)Property)->SetPropertyValue(PropertyAddr, Value->AsString());
-        return true;
+        Root->SetMobility(ParentRoot->Mobility);
     }
-    else if (Property->IsA<FByteProperty>())
+
+    return Actor->AttachToActor(Parent, FAttachmentTransformRules::KeepWorldTransform) && Actor->GetAttachParentActor() == Parent;
+}
+
+UK2Node_Event* FEpicUnrealMCPCommonUtils::FindExistingEventNode(UEdGraph* Graph, const FString& EventName)
+{
+    if (!Graph)
     {
-        FByteProperty* ByteProp = CastField<FByteProperty>(Property);
-        UEnum* EnumDef = ByteProp ? ByteProp->GetIntPropertyEnum() : nullptr;
-        
-        // If this is a TEnumAsByte property (has associated enum)
-        if (EnumDef)
-        {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-                ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %d"), 
-                      *PropertyName, ByteValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    uint8 ByteValue = FCString::Atoi(*EnumValueName);
-                    ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %d"), 
-                          *PropertyName, *EnumValueName, ByteValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names (e.g., "Player0" or "EAutoReceiveInput::Player0")
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    ByteProp->SetPropertyValue(PropertyAddr, static_cast<uint8>(EnumValue));
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
-        }
-        else
-        {
-            // Regular byte property
-            uint8 ByteValue = static_cast<uint8>(Value->AsNumber());
-            ByteProp->SetPropertyValue(PropertyAddr, ByteValue);
-            return true;
-        }
+        return nullptr;
     }
-    else if (Property->IsA<FEnumProperty>())
+
+    // Look for existing event nodes
+    for (UEdGraphNode* Node : Graph->Nodes)
     {
-        FEnumProperty* EnumProp = CastField<FEnumProperty>(Property);
-        UEnum* EnumDef = EnumProp ? EnumProp->GetEnum() : nullptr;
-        FNumericProperty* UnderlyingNumericProp = EnumProp ? EnumProp->GetUnderlyingProperty() : nullptr;
-        
-        if (EnumDef && UnderlyingNumericProp)
+        UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+        if (EventNode && EventNode->EventReference.GetMemberName() == FName(*EventName))
         {
-            // Handle numeric value
-            if (Value->Type == EJson::Number)
-            {
-                int64 EnumValue = static_cast<int64>(Value->AsNumber());
-                UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                
-                UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric value: %lld"), 
-                      *PropertyName, EnumValue);
-                return true;
-            }
-            // Handle string enum value
-            else if (Value->Type == EJson::String)
-            {
-                FString EnumValueName = Value->AsString();
-                
-                // Try to convert numeric string to number first
-                if (EnumValueName.IsNumeric())
-                {
-                    int64 EnumValue = FCString::Atoi64(*EnumValueName);
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to numeric string value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                
-                // Handle qualified enum names
-                if (EnumValueName.Contains(TEXT("::")))
-                {
-                    EnumValueName.Split(TEXT("::"), nullptr, &EnumValueName);
-                }
-                
-                int64 EnumValue = EnumDef->GetValueByNameString(EnumValueName);
-                if (EnumValue == INDEX_NONE)
-                {
-                    // Try with full name as fallback
-                    EnumValue = EnumDef->GetValueByNameString(Value->AsString());
-                }
-                
-                if (EnumValue != INDEX_NONE)
-                {
-                    UnderlyingNumericProp->SetIntPropertyValue(PropertyAddr, EnumValue);
-                    
-                    UE_LOG(LogTemp, Display, TEXT("Setting enum property %s to name value: %s -> %lld"), 
-                          *PropertyName, *EnumValueName, EnumValue);
-                    return true;
-                }
-                else
-                {
-                    // Log all possible enum values for debugging
-                    UE_LOG(LogTemp, Warning, TEXT("Could not find enum value for '%s'. Available options:"), *EnumValueName);
-                    for (int32 i = 0; i < EnumDef->NumEnums(); i++)
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("  - %s (value: %d)"), 
-                               *EnumDef->GetNameStringByIndex(i), EnumDef->GetValueByIndex(i));
-                    }
-                    
-                    OutErrorMessage = FString::Printf(TEXT("Could not find enum value for '%s'"), *EnumValueName);
-                    return false;
-                }
-            }
+            UE_LOG(LogTemp, Display, TEXT("Found existing event node with name: %s"), *EventName);
+            return EventNode;
         }
     }
-    
-    OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"), 
-                                    *Property->GetClass()->GetName(), *PropertyName);
-    return false;
-} 
\ No newline at end of file
+
+    return nullptr;
+}
+
+bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString& PropertyName, 
+                                     const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage)
+{
+    // Dotted paths are resolved through the cached property chains
+    return FMCPPropertyPath::SetValue(Object, PropertyName, Value, OutErrorMessage, false);
+}
@@ -1,5 +1,7 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPCommandRegistry.h"
+#include "MCPGeneratorLibrary.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -7,6 +9,8 @@
 #include "HighResScreenshot.h"
 #include "Engine/GameViewportClient.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
@@ -16,12 +20,42 @@
 #include "Engine/SpotLight.h"
 #include "Camera/CameraActor.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/SplineMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EditorAssetLibrary.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
+#include "MCPPropertyPath.h"
+#include "MCPActorSnapshot.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/EngineVersion.h"
+#include "Interfaces/IPluginManager.h"
+#include "UObject/UObjectArray.h"
+#include "PCGComponent.h"
+#include "PCGGraph.h"
+#include "PCGSubsystem.h"
+#include "PCGVolume.h"
+#include "Data/PCGPointData.h"
+#include "Helpers/PCGGraphParametersHelpers.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "ActorFactories/ActorFactory.h"
+#include "Builders/CubeBuilder.h"
+
+// Spline mesh components one spawn_spline_mesh actor may hold
+#define MCP_MAX_SPLINE_MESH_SEGMENTS 2000
+
+
+// Editor config section holding GeneratorScriptRoot, the folder run_generator imports builders from
+#define MCP_CONFIG_SECTION TEXT("UnrealMCP")
 
 FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 {
@@ -29,45 +63,142 @@ FEpicUnrealMCPEditorCommands::FEpicUnrealMCPEditorCommands()
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    // Actor manipulation commands
-    if (CommandType == TEXT("get_actors_in_level"))
+    // Actor commands take typed params and are dispatched by the registry directly
+    if (CommandType == TEXT("spawn_blueprint_actor"))
     {
-        return HandleGetActorsInLevel(Params);
+        return HandleSpawnBlueprintActor(Params);
     }
-    else if (CommandType == TEXT("find_actors_by_name"))
+    
+    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
+}
+
+void FEpicUnrealMCPEditorCommands::RegisterCommands(FMCPCommandRegistry& Registry)
+{
+    const FMCPCommandHandler Handler = [this](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+    {
+        return HandleCommand(CommandType, Params);
+    };
+
+    Registry.RegisterTyped<FMCPGetActorsInLevelParams>(TEXT("get_actors_in_level"), TEXT("List the actors in the current level, optionally filtered by group, class, folder and tags"),
+        [this](const FMCPGetActorsInLevelParams& Params) { return HandleGetActorsInLevel(Params); });
+    Registry.RegisterTyped<FMCPFindActorsByNameParams>(TEXT("find_actors_by_name"), TEXT("Find actors whose name contains a pattern (case-insensitive)"),
+        [this](const FMCPFindActorsByNameParams& Params) { return HandleFindActorsByName(Params); });
+    Registry.RegisterTyped<FMCPSpawnActorParams>(TEXT("spawn_actor"), TEXT("Spawn a basic actor (StaticMeshActor, PointLight, SpotLight, DirectionalLight, CameraActor)"),
+        [this](const FMCPSpawnActorParams& Params) { return HandleSpawnActor(Params); });
+    Registry.RegisterTyped<FMCPDeleteActorParams>(TEXT("delete_actor"), TEXT("Delete an actor by name"),
+        [this](const FMCPDeleteActorParams& Params) { return HandleDeleteActor(Params); });
+    Registry.RegisterTyped<FMCPSetActorTransformParams>(TEXT("set_actor_transform"), TEXT("Set an actor's location, rotation and/or scale"),
+        [this](const FMCPSetActorTransformParams& Params) { return HandleSetActorTransform(Params); });
+    Registry.RegisterTyped<FMCPCreateGroupParams>(TEXT("create_group"), TEXT("Create an empty group actor that spawned parts can be attached under, so the structure moves, hides and deletes as one"),
+        [this](const FMCPCreateGroupParams& Params) { return HandleCreateGroup(Params); });
+    Registry.RegisterTyped<FMCPSetActorHiddenParams>(TEXT("set_actor_hidden"), TEXT("Hide or show an actor, or a whole group, in the editor viewport"),
+        [this](const FMCPSetActorHiddenParams& Params) { return HandleSetActorHidden(Params); });
+    Registry.RegisterTyped<FMCPGetPropertiesParams>(TEXT("get_properties"), TEXT("Read dotted property paths from many actors and/or Blueprint class defaults"),
+        [this](const FMCPGetPropertiesParams& Params) { return HandleGetProperties(Params); });
+    Registry.RegisterTyped<FMCPSetPropertiesParams>(TEXT("set_properties"), TEXT("Set dotted property paths on many actors and/or Blueprint class defaults in one undoable step"),
+        [this](const FMCPSetPropertiesParams& Params) { return HandleSetProperties(Params); });
+    Registry.RegisterTyped<FMCPGetEditorStatsParams>(TEXT("get_editor_stats"), TEXT("Report editor memory use, actor and object counts, and engine and plugin versions"),
+        [this](const FMCPGetEditorStatsParams& Params) { return HandleGetEditorStats(Params); });
+    Registry.Register(TEXT("spawn_blueprint_actor"), TEXT("Spawn an instance of a Blueprint class in the level"), {
+        { TEXT("blueprint_name"), EMCPParamType::String, true, TEXT("Blueprint name or path") },
+        { TEXT("actor_name"), EMCPParamType::String, true, TEXT("Unique actor name") },
+        { TEXT("location"), EMCPParamType::Vector, false, TEXT("World location [X, Y, Z]") },
+        { TEXT("rotation"), EMCPParamType::Vector, false, TEXT("Rotation [Pitch, Yaw, Roll] in degrees") },
+        { TEXT("parent"), EMCPParamType::String, false, TEXT("Group (or any actor) to attach the new actor to, keeping its world transform") },
+        { TEXT("folder"), EMCPParamType::String, false, TEXT("Outliner folder for the new actor") }
+    }, Handler);
+    Registry.RegisterTyped<FMCPSpawnSplineMeshParams>(TEXT("spawn_spline_mesh"), TEXT("Spawn one actor with a spline through the given points and a static mesh deformed along it, for walls, roads, pipes and cables"),
+        [this](const FMCPSpawnSplineMeshParams& Params) { return HandleSpawnSplineMesh(Params); });
+    Registry.RegisterTyped<FMCPRunGeneratorParams>(TEXT("run_generator"), TEXT("Run a generator script inside the editor's Python, spawning its parts in-process; send with stream=true for progress frames"),
+        [this](const FMCPRunGeneratorParams& Params) { return HandleRunGenerator(Params); });
+    Registry.RegisterTyped<FMCPExecutePCGGraphParams>(TEXT("execute_pcg_graph"), TEXT("Create or update a PCG volume, set its graph and parameters and start generating; returns right away, poll get_pcg_generation_status for the result"),
+        [this](const FMCPExecutePCGGraphParams& Params) { return HandleExecutePCGGraph(Params); });
+    Registry.RegisterTyped<FMCPGetPCGGenerationStatusParams>(TEXT("get_pcg_generation_status"), TEXT("Report whether a PCG volume is still generating and, once done, its instance counts; can cancel the generation"),
+        [this](const FMCPGetPCGGenerationStatusParams& Params) { return HandleGetPCGGenerationStatus(Params); });
+}
+
+namespace
+{
+    // Resolve an optional group filter; false (with an error response) if the group doesn't exist
+    bool ResolveGroupFilter(const FString& GroupName, AActor*& OutGroup, TSharedPtr<FJsonObject>& OutError)
     {
-        return HandleFindActorsByName(Params);
+        OutGroup = nullptr;
+        if (GroupName.IsEmpty())
+        {
+            return true;
+        }
+
+        OutGroup = FEpicUnrealMCPCommonUtils::FindActorByName(GEditor->GetEditorWorldContext().World(), GroupName);
+        if (!OutGroup)
+        {
+            OutError = FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Group not found: %s"), *GroupName));
+            return false;
+        }
+        return true;
     }
-    else if (CommandType == TEXT("spawn_actor"))
+
+    // The class (or parent class), folder (or subfolder) and tag filters the actor snapshot answers from its indexes
+    bool MatchesActorFilters(const AActor* Actor, const FString& ClassName, const FString& Folder, const TArray<FString>& Tags)
     {
-        return HandleSpawnActor(Params);
+        if (!ClassName.IsEmpty())
+        {
+            const FString BlueprintClassName = ClassName + TEXT("_C");
+            const UClass* Class = Actor->GetClass();
+            while (Class && Class->GetName() != ClassName && Class->GetName() != BlueprintClassName)
+            {
+                Class = Class->GetSuperClass();
+            }
+            if (!Class)
+            {
+                return false;
+            }
+        }
+
+        if (!Folder.IsEmpty())
+        {
+            FString Wanted = Folder;
+            Wanted.TrimCharInline(TEXT('/'), nullptr);
+            const FString Path = Actor->GetFolderPath().ToString();
+            if (!Wanted.IsEmpty() && Path != Wanted && !Path.StartsWith(Wanted + TEXT("/")))
+            {
+                return false;
+            }
+        }
+
+        for (const FString& Tag : Tags)
+        {
+            if (!Actor->ActorHasTag(FName(*Tag)))
+            {
+                return false;
+            }
+        }
+        return true;
     }
-    else if (CommandType == TEXT("delete_actor"))
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const FMCPGetActorsInLevelParams& Params)
+{
+    AActor* Group = nullptr;
+    TSharedPtr<FJsonObject> Error;
+    if (!ResolveGroupFilter(Params.Group, Group, Error))
     {
-        return HandleDeleteActor(Params);
+        return Error;
     }
-    else if (CommandType == TEXT("set_actor_transform"))
+
+    TArray<AActor*> AllActors;
+    if (Group)
     {
-        return HandleSetActorTransform(Params);
+        Group->GetAttachedActors(AllActors, true, true);
     }
-    // Blueprint actor spawning
-    else if (CommandType == TEXT("spawn_blueprint_actor"))
+    else
     {
-        return HandleSpawnBlueprintActor(Params);
+        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
     }
     
-    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
-}
-
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
-{
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
-    
     TArray<TSharedPtr<FJsonValue>> ActorArray;
     for (AActor* Actor : AllActors)
     {
-        if (Actor)
+        if (Actor && MatchesActorFilters(Actor, Params.ClassName, Params.Folder, Params.Tags))
         {
             ActorArray.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
         }
@@ -79,21 +210,29 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorsInLevel(con
     return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(const FMCPFindActorsByNameParams& Params)
 {
-    FString Pattern;
-    if (!Params->TryGetStringField(TEXT("pattern"), Pattern))
+    AActor* Group = nullptr;
+    TSharedPtr<FJsonObject> Error;
+    if (!ResolveGroupFilter(Params.Group, Group, Error))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'pattern' parameter"));
+        return Error;
     }
-    
+
     TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    if (Group)
+    {
+        Group->GetAttachedActors(AllActors, true, true);
+    }
+    else
+    {
+        UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
+    }
     
     TArray<TSharedPtr<FJsonValue>> MatchingActors;
     for (AActor* Actor : AllActors)
     {
-        if (Actor && Actor->GetName().Contains(Pattern))
+        if (Actor && Actor->GetName().Contains(Params.Pattern) && MatchesActorFilters(Actor, Params.ClassName, Params.Folder, Params.Tags))
         {
             MatchingActors.Add(FEpicUnrealMCPCommonUtils::ActorToJson(Actor));
         }
@@ -105,39 +244,12 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleFindActorsByName(con
     return ResultObj;
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const FMCPSpawnActorParams& Params)
 {
-    // Get required parameters
-    FString ActorType;
-    if (!Params->TryGetStringField(TEXT("type"), ActorType))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'type' parameter"));
-    }
-
-    // Get actor name (required parameter)
-    FString ActorName;
-    if (!Params->TryGetStringField(TEXT("name"), ActorName))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
-    }
-
-    // Get optional transform parameters
-    FVector Location(0.0f, 0.0f, 0.0f);
-    FRotator Rotation(0.0f, 0.0f, 0.0f);
-    FVector Scale(1.0f, 1.0f, 1.0f);
-
-    if (Params->HasField(TEXT("location")))
-    {
-        Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("location"));
-    }
-    if (Params->HasField(TEXT("rotation")))
-    {
-        Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotation"));
-    }
-    if (Params->HasField(TEXT("scale")))
-    {
-        Scale = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale"));
-    }
+    const FString& ActorType = Params.Type;
+    const FString& ActorName = Params.Name;
+    const FVector& Location = Params.Location;
+    const FRotator& Rotation = Params.Rotation;
 
     // Create the actor based on type
     AActor* NewActor = nullptr;
@@ -159,6 +271,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
         }
     }
 
+    AActor* Parent = nullptr;
+    if (!Params.Parent.IsEmpty())
+    {
+        Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, Params.Parent);
+        if (!Parent)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *Params.Parent));
+        }
+    }
+
     FActorSpawnParameters SpawnParams;
     SpawnParams.Name = *ActorName;
 
@@ -168,8 +290,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
         if (NewMeshActor)
         {
             // Check for an optional static_mesh parameter to assign a mesh
-            FString MeshPath;
-            if (Params->TryGetStringField(TEXT("static_mesh"), MeshPath))
+            const FString& MeshPath = Params.StaticMesh;
+            if (!MeshPath.IsEmpty())
             {
                 UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
                 if (Mesh)
@@ -209,9 +331,16 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
     {
         // Set scale (since SpawnActor only takes location and rotation)
         FTransform Transform = NewActor->GetTransform();
-        Transform.SetScale3D(Scale);
+        Transform.SetScale3D(Params.Scale);
         NewActor->SetActorTransform(Transform);
 
+        // Attach after the final transform so the actor stays where it was asked for
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(NewActor, Parent, Params.Folder))
+        {
+            NewActor->Destroy();
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Could not attach to %s"), *Params.Parent));
+        }
+
         // Return the created actor's details
         return FEpicUnrealMCPCommonUtils::ActorToJsonObject(NewActor, true);
     }
@@ -219,13 +348,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnActor(const TSh
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create actor"));
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const FMCPDeleteActorParams& Params)
 {
-    FString ActorName;
-    if (!Params->TryGetStringField(TEXT("name"), ActorName))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
-    }
+    const FString& ActorName = Params.Name;
 
     TArray<AActor*> AllActors;
     UGameplayStatics::GetAllActorsOfClass(GWorld, AActor::StaticClass(), AllActors);
@@ -236,12 +361,28 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
         {
             // Store actor info before deletion for the response
             TSharedPtr<FJsonObject> ActorInfo = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor);
+
+            // Children are detached, not destroyed, with their parent, so collect them first
+            TArray<AActor*> AttachedActors;
+            if (Params.bIncludeAttached)
+            {
+                Actor->GetAttachedActors(AttachedActors, true, true);
+            }
             
             // Delete the actor
             Actor->Destroy();
+
+            for (AActor* AttachedActor : AttachedActors)
+            {
+                AttachedActor->Destroy();
+            }
             
             TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
             ResultObj->SetObjectField(TEXT("deleted_actor"), ActorInfo);
+            if (Params.bIncludeAttached)
+            {
+                ResultObj->SetNumberField(TEXT("deleted_attached"), AttachedActors.Num());
+            }
             return ResultObj;
         }
     }
@@ -249,14 +390,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleDeleteActor(const TS
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *ActorName));
 }
 
-TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(const FMCPSetActorTransformParams& Params)
 {
-    // Get actor name
-    FString ActorName;
-    if (!Params->TryGetStringField(TEXT("name"), ActorName))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
-    }
+    const FString& ActorName = Params.Name;
 
     // Find the actor
     AActor* TargetActor = nullptr;
@@ -280,26 +416,963 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorTransform(co
     // Get transform parameters
     FTransform NewTransform = TargetActor->GetTransform();
 
-    if (Params->HasField(TEXT("location")))
+    if (Params.bHasLocation)
     {
-        NewTransform.SetLocation(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("location")));
+        NewTransform.SetLocation(Params.Location);
     }
-    if (Params->HasField(TEXT("rotation")))
+    if (Params.bHasRotation)
     {
-        NewTransform.SetRotation(FQuat(FEpicUnrealMCPCommonUtils::GetRotatorFromJson(Params, TEXT("rotation"))));
+        NewTransform.SetRotation(FQuat(Params.Rotation));
     }
-    if (Params->HasField(TEXT("scale")))
+    if (Params.bHasScale)
     {
-        NewTransform.SetScale3D(FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("scale")));
+        NewTransform.SetScale3D(Params.Scale);
     }
 
-    // Set the new transform
+    // Set the new transform; attached actors move with it
     TargetActor->SetActorTransform(NewTransform);
+    FMCPActorSnapshot::NotifyActorChanged(TargetActor);
 
     // Return updated actor info
     return FEpicUnrealMCPCommonUtils::ActorToJsonObject(TargetActor, true);
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCreateGroup(const FMCPCreateGroupParams& Params)
+{
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    if (FEpicUnrealMCPCommonUtils::FindActorByName(World, Params.Name))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *Params.Name));
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = *Params.Name;
+
+    AActor* Group = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+    if (!Group)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create group actor"));
+    }
+
+    // A bare actor has no transform of its own; give it a movable scene root to carry the parts
+    USceneComponent* Root = NewObject<USceneComponent>(Group, USceneComponent::GetDefaultSceneRootVariableName(), RF_Transactional);
+    Root->SetMobility(EComponentMobility::Movable);
+    Group->SetRootComponent(Root);
+    Group->AddInstanceComponent(Root);
+    Root->RegisterComponent();
+
+    Group->SetActorLocationAndRotation(Params.Location, Params.Rotation);
+    Group->SetActorLabel(Params.Name);
+    FEpicUnrealMCPCommonUtils::AddActorToGroup(Group, nullptr, Params.Folder);
+
+    return FEpicUnrealMCPCommonUtils::ActorToJsonObject(Group, true);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetActorHidden(const FMCPSetActorHiddenParams& Params)
+{
+    AActor* TargetActor = FEpicUnrealMCPCommonUtils::FindActorByName(GEditor->GetEditorWorldContext().World(), Params.Name);
+    if (!TargetActor)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor not found: %s"), *Params.Name));
+    }
+
+    TArray<AActor*> Targets;
+    if (Params.bIncludeAttached)
+    {
+        TargetActor->GetAttachedActors(Targets, true, true);
+    }
+    Targets.Add(TargetActor);
+
+    for (AActor* Actor : Targets)
+    {
+        Actor->SetIsTemporarilyHiddenInEditor(Params.bHidden);
+        if (Params.bInGame)
+        {
+            Actor->Modify();
+            Actor->SetActorHiddenInGame(Params.bHidden);
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), TargetActor->GetName());
+    ResultObj->SetBoolField(TEXT("hidden"), Params.bHidden);
+    ResultObj->SetNumberField(TEXT("affected"), Targets.Num());
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnSplineMesh(const FMCPSpawnSplineMeshParams& Params)
+{
+    const FString& ActorName = Params.Name;
+    if (ActorName.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    const TArray<FVector>& Points = Params.Points;
+    if (Points.Num() < 2)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'points' must hold at least 2 rows of [X, Y, Z]"));
+    }
+
+    const FString& MeshPath = Params.StaticMesh;
+    UStaticMesh* Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(MeshPath));
+    if (!Mesh)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Static mesh not found: %s"), *MeshPath));
+    }
+
+    UMaterialInterface* Material = nullptr;
+    if (!Params.Material.IsEmpty())
+    {
+        Material = Cast<UMaterialInterface>(UEditorAssetLibrary::LoadAsset(Params.Material));
+        if (!Material)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Material not found: %s"), *Params.Material));
+        }
+    }
+
+    const FString& CurveType = Params.CurveType;
+    const bool bLinear = CurveType.Equals(TEXT("linear"), ESearchCase::IgnoreCase);
+    if (!bLinear && !CurveType.Equals(TEXT("curve"), ESearchCase::IgnoreCase))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown curve_type %s (expected curve or linear)"), *CurveType));
+    }
+
+    // The mesh axes that become the cross-section's width and height, in the order spline meshes use
+    const FString& ForwardAxisName = Params.ForwardAxis;
+    ESplineMeshAxis::Type ForwardAxis;
+    int32 WidthAxis;
+    int32 HeightAxis;
+    if (ForwardAxisName.Equals(TEXT("x"), ESearchCase::IgnoreCase))
+    {
+        ForwardAxis = ESplineMeshAxis::X;
+        WidthAxis = 1;
+        HeightAxis = 2;
+    }
+    else if (ForwardAxisName.Equals(TEXT("y"), ESearchCase::IgnoreCase))
+    {
+        ForwardAxis = ESplineMeshAxis::Y;
+        WidthAxis = 2;
+        HeightAxis = 0;
+    }
+    else if (ForwardAxisName.Equals(TEXT("z"), ESearchCase::IgnoreCase))
+    {
+        ForwardAxis = ESplineMeshAxis::Z;
+        WidthAxis = 0;
+        HeightAxis = 1;
+    }
+    else
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown forward_axis %s (expected x, y or z)"), *ForwardAxisName));
+    }
+
+    const FString& Align = Params.Align;
+    const bool bAlignBottom = Align.Equals(TEXT("bottom"), ESearchCase::IgnoreCase);
+    if (!bAlignBottom && !Align.Equals(TEXT("center"), ESearchCase::IgnoreCase))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown align %s (expected center or bottom)"), *Align));
+    }
+
+    const bool bClosed = Params.bClosed;
+    const bool bCollision = Params.bCollision;
+    const double Width = Params.Width;
+    const double Height = Params.Height;
+    const double SegmentLength = Params.SegmentLength;
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+    if (FEpicUnrealMCPCommonUtils::FindActorByName(World, ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Actor with name '%s' already exists"), *ActorName));
+    }
+
+    const FString& ParentName = Params.Parent;
+    const FString& Folder = Params.Folder;
+    AActor* Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, ParentName);
+    if (!ParentName.IsEmpty() && !Parent)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *ParentName));
+    }
+
+    // The actor sits on the first point and the spline is built in its frame
+    const FVector Origin = Points[0];
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = *ActorName;
+    AActor* SplineActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Origin), SpawnParams);
+    if (!SplineActor)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn spline actor"));
+    }
+
+    // Static unless it joins a group: a component can't attach under a more mobile parent
+    const USceneComponent* ParentRoot = Parent ? Parent->GetRootComponent() : nullptr;
+    const EComponentMobility::Type Mobility = ParentRoot ? ParentRoot->Mobility.GetValue() : EComponentMobility::Static;
+
+    USplineComponent* Spline = NewObject<USplineComponent>(SplineActor, TEXT("Spline"), RF_Transactional);
+    Spline->SetMobility(Mobility);
+    SplineActor->SetRootComponent(Spline);
+    SplineActor->AddInstanceComponent(Spline);
+    Spline->RegisterComponent();
+    SplineActor->SetActorLocation(Origin);
+
+    Spline->ClearSplinePoints(false);
+    for (int32 Index = 0; Index < Points.Num(); ++Index)
+    {
+        Spline->AddSplinePoint(Points[Index] - Origin, ESplineCoordinateSpace::Local, false);
+        Spline->SetSplinePointType(Index, bLinear ? ESplinePointType::Linear : ESplinePointType::Curve, false);
+    }
+    Spline->SetClosedLoop(bClosed, false);
+    Spline->UpdateSpline();
+
+    // Piece boundaries as distances along the spline: at the control points, or evenly spaced
+    const double SplineLength = Spline->GetSplineLength();
+    TArray<double> Breaks;
+    if (SegmentLength > 0.0)
+    {
+        const int32 NumPieces = FMath::Max(1, FMath::RoundToInt32(SplineLength / SegmentLength));
+        if (NumPieces > MCP_MAX_SPLINE_MESH_SEGMENTS)
+        {
+            SplineActor->Destroy();
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("segment_length %.1f would make %d pieces (max %d)"),
+                SegmentLength, NumPieces, MCP_MAX_SPLINE_MESH_SEGMENTS));
+        }
+        for (int32 Index = 0; Index <= NumPieces; ++Index)
+        {
+            Breaks.Add(SplineLength * Index / NumPieces);
+        }
+    }
+    else
+    {
+        const int32 NumSegments = Spline->GetNumberOfSplineSegments();
+        if (NumSegments > MCP_MAX_SPLINE_MESH_SEGMENTS)
+        {
+            SplineActor->Destroy();
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%d segments (max %d); pass a segment_length"),
+                NumSegments, MCP_MAX_SPLINE_MESH_SEGMENTS));
+        }
+        for (int32 Index = 0; Index < NumSegments; ++Index)
+        {
+            Breaks.Add(Spline->GetDistanceAlongSplineAtSplinePoint(Index));
+        }
+        Breaks.Add(SplineLength);
+    }
+
+    // Scale the mesh's cross-section to the requested size; bottom alignment lifts it onto the spline
+    const FBox MeshBounds = Mesh->GetBoundingBox();
+    const FVector MeshSize = MeshBounds.GetSize();
+    const FVector2D SectionScale(
+        Width > 0.0 && MeshSize[WidthAxis] > 0.0 ? Width / MeshSize[WidthAxis] : 1.0,
+        Height > 0.0 && MeshSize[HeightAxis] > 0.0 ? Height / MeshSize[HeightAxis] : 1.0);
+    const FVector2D SectionOffset(0.0, bAlignBottom ? -MeshBounds.Min[HeightAxis] * SectionScale.Y : 0.0);
+
+    int32 NumPieces = 0;
+    for (int32 Index = 0; Index + 1 < Breaks.Num(); ++Index)
+    {
+        const double StartDistance = Breaks[Index];
+        const double EndDistance = Breaks[Index + 1];
+        const double PieceLength = EndDistance - StartDistance;
+        if (PieceLength <= KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        // Hermite tangents scaled to the piece length follow the spline's curvature
+        const FVector StartPos = Spline->GetLocationAtDistanceAlongSpline(StartDistance, ESplineCoordinateSpace::Local);
+        const FVector EndPos = Spline->GetLocationAtDistanceAlongSpline(EndDistance, ESplineCoordinateSpace::Local);
+        const FVector StartTangent = bLinear ? EndPos - StartPos
+            : Spline->GetDirectionAtDistanceAlongSpline(StartDistance, ESplineCoordinateSpace::Local) * PieceLength;
+        const FVector EndTangent = bLinear ? EndPos - StartPos
+            : Spline->GetDirectionAtDistanceAlongSpline(EndDistance, ESplineCoordinateSpace::Local) * PieceLength;
+
+        USplineMeshComponent* Piece = NewObject<USplineMeshComponent>(SplineActor, *FString::Printf(TEXT("SplineMesh_%d"), NumPieces), RF_Transactional);
+        Piece->SetMobility(Mobility);
+        Piece->SetStaticMesh(Mesh);
+        Piece->SetForwardAxis(ForwardAxis, false);
+        if (Material)
+        {
+            Piece->SetMaterial(0, Material);
+        }
+        Piece->SetStartAndEnd(StartPos, StartTangent, EndPos, EndTangent, false);
+        Piece->SetStartScale(SectionScale, false);
+        Piece->SetEndScale(SectionScale, false);
+        Piece->SetStartOffset(SectionOffset, false);
+        Piece->SetEndOffset(SectionOffset, false);
+        Piece->SetCollisionEnabled(bCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+        Piece->SetupAttachment(Spline);
+        SplineActor->AddInstanceComponent(Piece);
+        Piece->RegisterComponent();
+        Piece->UpdateMesh();
+        ++NumPieces;
+    }
+
+    SplineActor->SetActorLabel(ActorName);
+    if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(SplineActor, Parent, Folder))
+    {
+        SplineActor->Destroy();
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Could not attach to %s"), *ParentName));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = FEpicUnrealMCPCommonUtils::ActorToJsonObject(SplineActor, true);
+    ResultObj->SetNumberField(TEXT("points"), Points.Num());
+    ResultObj->SetNumberField(TEXT("mesh_components"), NumPieces);
+    ResultObj->SetNumberField(TEXT("length"), SplineLength);
+
+    UE_LOG(LogTemp, Log, TEXT("HandleSpawnSplineMesh: %s with %d points, %d mesh pieces over %.0f cm"),
+        *ActorName, Points.Num(), NumPieces, SplineLength);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleRunGenerator(const FMCPRunGeneratorParams& Params)
+{
+    const FString& Generator = Params.Generator;
+    if (Generator.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'generator' parameter"));
+    }
+
+    // The folder added to the editor's Python path comes from the editor config, never from the client;
+    // relative paths are taken from the project directory
+    FString ScriptRoot;
+    GConfig->GetString(MCP_CONFIG_SECTION, TEXT("GeneratorScriptRoot"), ScriptRoot, GEditorIni);
+    if (!ScriptRoot.IsEmpty())
+    {
+        ScriptRoot = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), ScriptRoot);
+        if (!FPaths::DirectoryExists(ScriptRoot))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+                TEXT("GeneratorScriptRoot %s is not an existing directory"), *ScriptRoot));
+        }
+    }
+
+    TSharedPtr<FJsonObject> Request = MakeShared<FJsonObject>();
+    Request->SetStringField(TEXT("generator"), Generator);
+    Request->SetObjectField(TEXT("arguments"), Params.Arguments.JsonObject.IsValid() ? Params.Arguments.JsonObject : MakeShared<FJsonObject>());
+    Request->SetStringField(TEXT("script_root"), ScriptRoot);
+    Request->SetBoolField(TEXT("reload"), Params.bReload);
+
+    const double StartTime = FPlatformTime::Seconds();
+    FString Error;
+    TSharedPtr<FJsonObject> ResultObj = UMCPGeneratorLibrary::RunGenerator(Request, Error);
+    if (!ResultObj.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Generator %s failed: %s"), *Generator, *Error));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("HandleRunGenerator: %s finished in %.2f s"), *Generator, FPlatformTime::Seconds() - StartTime);
+    return ResultObj;
+}
+
+namespace
+{
+    bool JsonArrayToVector(const TSharedPtr<FJsonValue>& Value, FVector& OutVector)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+        if (!Value->TryGetArray(Array) || Array->Num() != 3)
+        {
+            return false;
+        }
+        OutVector = FVector((*Array)[0]->AsNumber(), (*Array)[1]->AsNumber(), (*Array)[2]->AsNumber());
+        return true;
+    }
+
+    // Override one graph user parameter from JSON, converting by the parameter's declared type
+    bool SetPCGGraphParameter(UPCGGraphInterface* Graph, const FName Name, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+    {
+        const FInstancedPropertyBag* Parameters = Graph->GetUserParametersStruct();
+        const FPropertyBagPropertyDesc* Desc = Parameters ? Parameters->FindPropertyDescByName(Name) : nullptr;
+        if (!Desc)
+        {
+            TArray<FString> Available;
+            if (const UPropertyBag* BagStruct = Parameters ? Parameters->GetPropertyBagStruct() : nullptr)
+            {
+                for (const FPropertyBagPropertyDesc& Existing : BagStruct->GetPropertyDescs())
+                {
+                    Available.Add(Existing.Name.ToString());
+                }
+            }
+            OutError = FString::Printf(TEXT("Graph has no parameter %s (parameters: %s)"), *Name.ToString(),
+                Available.Num() > 0 ? *FString::Join(Available, TEXT(", ")) : TEXT("none"));
+            return false;
+        }
+
+        bool bBool = false;
+        double Number = 0.0;
+        FString String;
+        FVector Vector;
+        switch (Desc->ValueType)
+        {
+        case EPropertyBagPropertyType::Bool:
+            if (Value->TryGetBool(bBool))
+            {
+                UPCGGraphParametersHelpers::SetBoolParameter(Graph, Name, bBool);
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Int32:
+            if (Value->TryGetNumber(Number))
+            {
+                UPCGGraphParametersHelpers::SetInt32Parameter(Graph, Name, static_cast<int32>(Number));
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Int64:
+            if (Value->TryGetNumber(Number))
+            {
+                UPCGGraphParametersHelpers::SetInt64Parameter(Graph, Name, static_cast<int64>(Number));
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Float:
+            if (Value->TryGetNumber(Number))
+            {
+                UPCGGraphParametersHelpers::SetFloatParameter(Graph, Name, static_cast<float>(Number));
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Double:
+            if (Value->TryGetNumber(Number))
+            {
+                UPCGGraphParametersHelpers::SetDoubleParameter(Graph, Name, Number);
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Name:
+            if (Value->TryGetString(String))
+            {
+                UPCGGraphParametersHelpers::SetNameParameter(Graph, Name, FName(*String));
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::String:
+            if (Value->TryGetString(String))
+            {
+                UPCGGraphParametersHelpers::SetStringParameter(Graph, Name, String);
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::SoftObject:
+            if (Value->TryGetString(String))
+            {
+                UPCGGraphParametersHelpers::SetSoftObjectParameter(Graph, Name, TSoftObjectPtr<UObject>(FSoftObjectPath(String)));
+                return true;
+            }
+            break;
+        case EPropertyBagPropertyType::Struct:
+            if (Desc->ValueTypeObject == TBaseStructure<FVector>::Get() && JsonArrayToVector(Value, Vector))
+            {
+                UPCGGraphParametersHelpers::SetVectorParameter(Graph, Name, Vector);
+                return true;
+            }
+            if (Desc->ValueTypeObject == TBaseStructure<FRotator>::Get() && JsonArrayToVector(Value, Vector))
+            {
+                UPCGGraphParametersHelpers::SetRotatorParameter(Graph, Name, FRotator(Vector.X, Vector.Y, Vector.Z));
+                return true;
+            }
+            break;
+        default:
+            OutError = FString::Printf(TEXT("Parameter %s has a type that cannot be set from JSON"), *Name.ToString());
+            return false;
+        }
+
+        OutError = FString::Printf(TEXT("Wrong value type for parameter %s"), *Name.ToString());
+        return false;
+    }
+
+    // What the last generation left on the actor: output points, mesh instances and spawned actors
+    void AddPCGGenerationCounts(const AActor* Actor, const UPCGComponent* Component, const TSharedPtr<FJsonObject>& ResultObj)
+    {
+        int32 NumPoints = 0;
+        for (const FPCGTaggedData& Output : Component->GetGeneratedGraphOutput().TaggedData)
+        {
+            if (const UPCGPointData* PointData = Cast<UPCGPointData>(Output.Data))
+            {
+                NumPoints += PointData->GetPoints().Num();
+            }
+        }
+
+        // Instanced meshes are generated as (H)ISM components on the actor itself
+        TInlineComponentArray<UInstancedStaticMeshComponent*> InstancedComponents(Actor);
+        TMap<FString, int32> InstancesByMesh;
+        int32 NumInstances = 0;
+        for (const UInstancedStaticMeshComponent* Instanced : InstancedComponents)
+        {
+            const int32 Count = Instanced->GetInstanceCount();
+            NumInstances += Count;
+            InstancesByMesh.FindOrAdd(Instanced->GetStaticMesh() ? Instanced->GetStaticMesh()->GetPathName() : TEXT("None")) += Count;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> MeshArray;
+        for (const TPair<FString, int32>& Pair : InstancesByMesh)
+        {
+            TSharedPtr<FJsonObject> MeshObj = MakeShared<FJsonObject>();
+            MeshObj->SetStringField(TEXT("mesh"), Pair.Key);
+            MeshObj->SetNumberField(TEXT("instances"), Pair.Value);
+            MeshArray.Add(MakeShared<FJsonValueObject>(MeshObj));
+        }
+
+        TArray<AActor*> AttachedActors;
+        Actor->GetAttachedActors(AttachedActors);
+
+        ResultObj->SetNumberField(TEXT("points"), NumPoints);
+        ResultObj->SetNumberField(TEXT("instances"), NumInstances);
+        ResultObj->SetNumberField(TEXT("instanced_components"), InstancedComponents.Num());
+        ResultObj->SetArrayField(TEXT("instanced_meshes"), MeshArray);
+        ResultObj->SetNumberField(TEXT("attached_actors"), AttachedActors.Num());
+    }
+
+    // When each component's current generation was started by execute_pcg_graph (game thread)
+    TMap<TWeakObjectPtr<UPCGComponent>, double> PCGGenerationStarts;
+
+    // Generation state of a PCG component; counts are added once the generation has finished
+    void AddPCGGenerationStatus(const AActor* Actor, UPCGComponent* Component, const TSharedPtr<FJsonObject>& ResultObj)
+    {
+        const bool bGenerating = Component->IsGenerating();
+        ResultObj->SetStringField(TEXT("graph"), Component->GetGraph() ? Component->GetGraph()->GetPathName() : TEXT(""));
+        ResultObj->SetNumberField(TEXT("seed"), Component->Seed);
+        ResultObj->SetBoolField(TEXT("generating"), bGenerating);
+        if (const double* StartTime = PCGGenerationStarts.Find(Component))
+        {
+            ResultObj->SetNumberField(TEXT("seconds_since_generate"), FPlatformTime::Seconds() - *StartTime);
+        }
+        if (!bGenerating)
+        {
+            AddPCGGenerationCounts(Actor, Component, ResultObj);
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleExecutePCGGraph(const FMCPExecutePCGGraphParams& Params)
+{
+    const FString& ActorName = Params.Name;
+    if (ActorName.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+    if (!World->GetSubsystem<UPCGSubsystem>())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("PCG is not available in the editor world"));
+    }
+
+    UPCGGraphInterface* Graph = nullptr;
+    if (!Params.Graph.IsEmpty())
+    {
+        Graph = Cast<UPCGGraphInterface>(UEditorAssetLibrary::LoadAsset(Params.Graph));
+        if (!Graph)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("PCG graph not found: %s"), *Params.Graph));
+        }
+    }
+
+    const FVector& Size = Params.Size;
+    if (Size.GetMin() <= 0.0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'size' must be positive on every axis"));
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Reuse the named actor and its PCG component, or create a PCG volume
+    AActor* Actor = FEpicUnrealMCPCommonUtils::FindActorByName(World, ActorName);
+    const bool bCreated = Actor == nullptr;
+    if (bCreated)
+    {
+        if (!Graph)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'graph' is required to create a PCG volume"));
+        }
+
+        const FString& ParentName = Params.Parent;
+        AActor* Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, ParentName);
+        if (!ParentName.IsEmpty() && !Parent)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent actor not found: %s"), *ParentName));
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = *ActorName;
+        APCGVolume* Volume = World->SpawnActor<APCGVolume>(APCGVolume::StaticClass(),
+            FTransform(Params.Location), SpawnParams);
+        if (!Volume)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to spawn PCG volume"));
+        }
+        Volume->SetActorLabel(ActorName);
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(Volume, Parent, Params.Folder))
+        {
+            Volume->Destroy();
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Could not attach %s to %s"), *ActorName, *ParentName));
+        }
+        Actor = Volume;
+    }
+    else if (Params.bHasLocation)
+    {
+        Actor->SetActorLocation(Params.Location);
+        FMCPActorSnapshot::NotifyActorChanged(Actor);
+    }
+
+    // The volume's brush is the generation bounds
+    APCGVolume* PCGVolume = Cast<APCGVolume>(Actor);
+    if (PCGVolume && (bCreated || Params.bHasSize))
+    {
+        UCubeBuilder* Builder = NewObject<UCubeBuilder>();
+        Builder->X = Size.X;
+        Builder->Y = Size.Y;
+        Builder->Z = Size.Z;
+        UActorFactory::CreateBrushForVolumeActor(PCGVolume, Builder);
+    }
+
+    UPCGComponent* Component = Actor->FindComponentByClass<UPCGComponent>();
+    if (!Component)
+    {
+        Component = NewObject<UPCGComponent>(Actor, TEXT("PCG"), RF_Transactional);
+        Actor->AddInstanceComponent(Component);
+        Component->RegisterComponent();
+    }
+    if (!Graph && !Component->GetGraph())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("%s has no PCG graph; pass 'graph'"), *ActorName));
+    }
+
+    // Graph and seed changes are undoable and mark the level dirty
+    if (Graph || Params.bHasSeed)
+    {
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "ExecutePCGGraph", "MCP Set PCG Graph"));
+        Component->Modify();
+        if (Graph)
+        {
+            Component->SetGraph(Graph);
+        }
+        if (Params.bHasSeed)
+        {
+            Component->Seed = Params.Seed;
+        }
+    }
+
+    // Overrides go on the component's graph instance, leaving the graph asset untouched
+    int32 NumParameters = 0;
+    if (const TSharedPtr<FJsonObject>& Parameters = Params.Parameters.JsonObject)
+    {
+        UPCGGraphInstance* Instance = Component->GetGraphInstance();
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Parameters->Values)
+        {
+            FString Error;
+            if (!SetPCGGraphParameter(Instance, FName(*Pair.Key), Pair.Value, Error))
+            {
+                // A volume this call created is not left behind half set up
+                if (bCreated)
+                {
+                    Actor->Destroy();
+                }
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+            }
+            ++NumParameters;
+        }
+    }
+    const double SetupSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // Generation is scheduled over the editor's frames, so it cannot progress while this handler holds
+    // the game thread; start it and return, and get_pcg_generation_status reports when it is done
+    if (Params.bGenerate)
+    {
+        Component->GenerateLocal(/*bForce=*/true);
+        PCGGenerationStarts.Add(Component, FPlatformTime::Seconds());
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = FEpicUnrealMCPCommonUtils::ActorToJsonObject(Actor, true);
+    ResultObj->SetBoolField(TEXT("created"), bCreated);
+    ResultObj->SetNumberField(TEXT("parameters_set"), NumParameters);
+    AddPCGGenerationStatus(Actor, Component, ResultObj);
+    ResultObj->SetNumberField(TEXT("setup_seconds"), SetupSeconds);
+
+    UE_LOG(LogTemp, Log, TEXT("HandleExecutePCGGraph: %s %s after %.2f s of setup"),
+        *ActorName, Component->IsGenerating() ? TEXT("started generating") : TEXT("is not generating"), SetupSeconds);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetPCGGenerationStatus(const FMCPGetPCGGenerationStatusParams& Params)
+{
+    UWorld* World = GEditor->GetEditorWorldContext().World();
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to get editor world"));
+    }
+
+    AActor* Actor = FEpicUnrealMCPCommonUtils::FindActorByName(World, Params.Name);
+    UPCGComponent* Component = Actor ? Actor->FindComponentByClass<UPCGComponent>() : nullptr;
+    if (!Component)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Actor
+            ? FString::Printf(TEXT("%s has no PCG component"), *Params.Name)
+            : FString::Printf(TEXT("Actor not found: %s"), *Params.Name));
+    }
+
+    const bool bCancelled = Params.bCancel && Component->IsGenerating();
+    if (bCancelled)
+    {
+        Component->CancelGeneration();
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("name"), Actor->GetActorLabel());
+    ResultObj->SetBoolField(TEXT("cancelled"), bCancelled);
+    AddPCGGenerationStatus(Actor, Component, ResultObj);
+    if (!Component->IsGenerating())
+    {
+        PCGGenerationStarts.Remove(Component);
+    }
+    return ResultObj;
+}
+
+namespace
+{
+    struct FPropertyTarget
+    {
+        // "actor" or "blueprint"
+        const TCHAR* Kind;
+        FString Name;
+        UObject* Object;
+        UBlueprint* Blueprint;
+    };
+
+    // Resolve actor names with a single pass over the level; missing targets have a null Object
+    TArray<FPropertyTarget> CollectPropertyTargets(const TArray<FString>& ActorNames, const TArray<FString>& BlueprintNames)
+    {
+        TArray<FPropertyTarget> Targets;
+
+        if (ActorNames.Num() > 0)
+        {
+            TMap<FString, AActor*> ActorsByName;
+            if (UWorld* World = GEditor->GetEditorWorldContext().World())
+            {
+                for (TActorIterator<AActor> It(World); It; ++It)
+                {
+                    ActorsByName.Add(It->GetName(), *It);
+                }
+            }
+
+            for (const FString& ActorName : ActorNames)
+            {
+                AActor* const* Actor = ActorsByName.Find(ActorName);
+                Targets.Add({ TEXT("actor"), ActorName, Actor ? *Actor : nullptr, nullptr });
+            }
+        }
+
+        for (const FString& BlueprintName : BlueprintNames)
+        {
+            UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+            UObject* Defaults = Blueprint && Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+            Targets.Add({ TEXT("blueprint"), BlueprintName, Defaults, Blueprint });
+        }
+
+        return Targets;
+    }
+
+    TSharedPtr<FJsonObject> MakeTargetResult(const FPropertyTarget& Target)
+    {
+        TSharedPtr<FJsonObject> TargetObj = MakeShared<FJsonObject>();
+        TargetObj->SetStringField(Target.Kind, Target.Name);
+        if (!Target.Object)
+        {
+            TargetObj->SetStringField(TEXT("error"), FString::Printf(TEXT("%s not found"),
+                FCString::Strcmp(Target.Kind, TEXT("actor")) == 0 ? TEXT("Actor") : TEXT("Blueprint")));
+        }
+        return TargetObj;
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetProperties(const FMCPGetPropertiesParams& Params)
+{
+    const TArray<FPropertyTarget> Targets = CollectPropertyTargets(Params.Actors, Params.Blueprints);
+    if (Targets.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Specify at least one of 'actors' or 'blueprints'"));
+    }
+
+    int32 NumRead = 0;
+    int32 NumFailed = 0;
+    FString FirstError;
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    for (const FPropertyTarget& Target : Targets)
+    {
+        TSharedPtr<FJsonObject> TargetObj = MakeTargetResult(Target);
+        if (Target.Object)
+        {
+            TSharedPtr<FJsonObject> Values = MakeShared<FJsonObject>();
+            TSharedPtr<FJsonObject> Errors = MakeShared<FJsonObject>();
+            for (const FString& Path : Params.Paths)
+            {
+                TSharedPtr<FJsonValue> Value;
+                FString Error;
+                if (FMCPPropertyPath::GetValue(Target.Object, Path, Value, Error))
+                {
+                    Values->SetField(Path, Value);
+                    ++NumRead;
+                }
+                else
+                {
+                    Errors->SetStringField(Path, Error);
+                    FirstError = FirstError.IsEmpty() ? Error : FirstError;
+                    ++NumFailed;
+                }
+            }
+
+            TargetObj->SetObjectField(TEXT("values"), Values);
+            if (Errors->Values.Num() > 0)
+            {
+                TargetObj->SetObjectField(TEXT("errors"), Errors);
+            }
+        }
+        else
+        {
+            FirstError = FirstError.IsEmpty() ? TargetObj->GetStringField(TEXT("error")) : FirstError;
+            ++NumFailed;
+        }
+        Results.Add(MakeShared<FJsonValueObject>(TargetObj));
+    }
+
+    if (NumRead == 0 && NumFailed > 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FirstError);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("read"), NumRead);
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSetProperties(const FMCPSetPropertiesParams& Params)
+{
+    const TSharedPtr<FJsonObject>& Properties = Params.Properties.JsonObject;
+    if (!Properties.IsValid() || Properties->Values.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("'properties' must map at least one property path to a value"));
+    }
+
+    const TArray<FPropertyTarget> Targets = CollectPropertyTargets(Params.Actors, Params.Blueprints);
+    if (Targets.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Specify at least one of 'actors' or 'blueprints'"));
+    }
+
+    int32 NumSet = 0;
+    int32 NumFailed = 0;
+    FString FirstError;
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    {
+        // One undo step for the whole batch
+        const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "SetProperties", "MCP Set Properties"));
+
+        for (const FPropertyTarget& Target : Targets)
+        {
+            TSharedPtr<FJsonObject> TargetObj = MakeTargetResult(Target);
+            if (Target.Object)
+            {
+                TArray<TSharedPtr<FJsonValue>> SetPaths;
+                TSharedPtr<FJsonObject> Errors = MakeShared<FJsonObject>();
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Properties->Values)
+                {
+                    FString Error;
+                    if (FMCPPropertyPath::SetValue(Target.Object, Property.Key, Property.Value, Error))
+                    {
+                        SetPaths.Add(MakeShared<FJsonValueString>(Property.Key));
+                        ++NumSet;
+                    }
+                    else
+                    {
+                        Errors->SetStringField(Property.Key, Error);
+                        FirstError = FirstError.IsEmpty() ? Error : FirstError;
+                        ++NumFailed;
+                    }
+                }
+
+                if (Target.Blueprint && SetPaths.Num() > 0)
+                {
+                    FBlueprintEditorUtils::MarkBlueprintAsModified(Target.Blueprint);
+                }
+                else if (!Target.Blueprint && SetPaths.Num() > 0)
+                {
+                    // Transform and mesh edits change the actor's listed transform and bounds
+                    FMCPActorSnapshot::NotifyActorChanged(Cast<AActor>(Target.Object));
+                }
+
+                TargetObj->SetArrayField(TEXT("set"), SetPaths);
+                if (Errors->Values.Num() > 0)
+                {
+                    TargetObj->SetObjectField(TEXT("errors"), Errors);
+                }
+            }
+            else
+            {
+                FirstError = FirstError.IsEmpty() ? TargetObj->GetStringField(TEXT("error")) : FirstError;
+                ++NumFailed;
+            }
+            Results.Add(MakeShared<FJsonValueObject>(TargetObj));
+        }
+    }
+
+    if (NumSet == 0 && NumFailed > 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FirstError);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("set"), NumSet);
+    ResultObj->SetNumberField(TEXT("failed"), NumFailed);
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetEditorStats(const FMCPGetEditorStatsParams& Params)
+{
+    if (Params.bCollectGarbage)
+    {
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+    }
+
+    const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+    const double BytesPerMB = 1024.0 * 1024.0;
+
+    int32 ActorCount = 0;
+    if (UWorld* World = GEditor->GetEditorWorldContext().World())
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            ++ActorCount;
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetNumberField(TEXT("used_physical_mb"), MemoryStats.UsedPhysical / BytesPerMB);
+    ResultObj->SetNumberField(TEXT("peak_used_physical_mb"), MemoryStats.PeakUsedPhysical / BytesPerMB);
+    ResultObj->SetNumberField(TEXT("used_virtual_mb"), MemoryStats.UsedVirtual / BytesPerMB);
+    ResultObj->SetNumberField(TEXT("actor_count"), ActorCount);
+    ResultObj->SetNumberField(TEXT("object_count"), GUObjectArray.GetObjectArrayNumMinusAvailable());
+    ResultObj->SetNumberField(TEXT("uptime_seconds"), FPlatformTime::Seconds() - GStartTime);
+    ResultObj->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+
+    const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UnrealMCP"));
+    ResultObj->SetStringField(TEXT("plugin_version"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString());
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     // This function will now correctly call the implementation in BlueprintCommands
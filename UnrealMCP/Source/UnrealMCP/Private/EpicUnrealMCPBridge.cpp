@@ -22,6 +22,7 @@
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
+#include "UObject/StructOnScope.h"
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -50,21 +51,65 @@
 #include "GameFramework/InputSettings.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
+#include "Misc/ConfigCacheIni.h"
 // Include our new command handler classes
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintGraphCommands.h"
+#include "Commands/EpicUnrealMCPAssetCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MCPHttpEndpoint.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
+// MCP JSON-RPC over HTTP next to the TCP bridge; off unless enabled in the editor config
+#define MCP_HTTP_PORT 55558
+#define MCP_CONFIG_SECTION TEXT("UnrealMCP")
+
+namespace
+{
+    // Collects a single JSON response as text
+    class FMCPStringResponseSink : public IMCPResponseSink
+    {
+    public:
+        virtual TUniquePtr<FMCPPayloadWriter> MakeWriter() override
+        {
+            return FMCPPayloadWriter::Create(EMCPEncoding::Json);
+        }
+
+        virtual bool SendFrame(const FMCPPayloadWriter& Writer) override
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Writer.GetBytes().GetData()), Writer.GetBytes().Num());
+            Response = FString(Converted.Length(), Converted.Get());
+            return true;
+        }
+
+        FString Response;
+    };
+}
 
 UEpicUnrealMCPBridge::UEpicUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FEpicUnrealMCPEditorCommands>();
     BlueprintCommands = MakeShared<FEpicUnrealMCPBlueprintCommands>();
     BlueprintGraphCommands = MakeShared<FEpicUnrealMCPBlueprintGraphCommands>();
+    AssetCommands = MakeShared<FEpicUnrealMCPAssetCommands>();
+    ActorSnapshot = MakeShared<FMCPActorSnapshot>();
+
+    CommandRegistry.Register(TEXT("ping"), TEXT("Check that the editor is responding"), {},
+        [](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+            ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+            return ResultJson;
+        });
+    EditorCommands->RegisterCommands(CommandRegistry);
+    BlueprintCommands->RegisterCommands(CommandRegistry);
+    BlueprintGraphCommands->RegisterCommands(CommandRegistry);
+    AssetCommands->RegisterCommands(CommandRegistry);
+
+    HttpEndpoint = MakeShared<FMCPHttpEndpoint>(this);
 }
 
 UEpicUnrealMCPBridge::~UEpicUnrealMCPBridge()
@@ -72,6 +117,9 @@ UEpicUnrealMCPBridge::~UEpicUnrealMCPBridge()
     EditorCommands.Reset();
     BlueprintCommands.Reset();
     BlueprintGraphCommands.Reset();
+    AssetCommands.Reset();
+    ActorSnapshot.Reset();
+    HttpEndpoint.Reset();
 }
 
 // Initialize subsystem
@@ -86,15 +134,30 @@ void UEpicUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    // Publish the actor table for read-only queries before accepting clients
+    ActorSnapshot->Start();
+
     // Start the server automatically
     StartServer();
+
+    // [UnrealMCP] bEnableHttpEndpoint=True in DefaultEditor.ini opts in to the HTTP endpoint
+    bool bEnableHttpEndpoint = false;
+    int32 HttpPort = MCP_HTTP_PORT;
+    GConfig->GetBool(MCP_CONFIG_SECTION, TEXT("bEnableHttpEndpoint"), bEnableHttpEndpoint, GEditorIni);
+    GConfig->GetInt(MCP_CONFIG_SECTION, TEXT("HttpPort"), HttpPort, GEditorIni);
+    if (bEnableHttpEndpoint)
+    {
+        HttpEndpoint->Start(HttpPort);
+    }
 }
 
 // Clean up resources when subsystem is destroyed
 void UEpicUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Shutting down"));
+    HttpEndpoint->Stop();
     StopServer();
+    ActorSnapshot->Stop();
 }
 
 // Start the MCP server
@@ -195,123 +258,322 @@ void UEpicUnrealMCPBridge::StopServer()
 }
 
 // Execute a command received from a client
-FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, IMCPResponseSink& Sink,
+                                         const TSharedPtr<FMCPBulkParams>& Bulk)
 {
     UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing command: %s"), *CommandType);
     
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
+    TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+    
+    // Typed commands reject bad params here, before any game-thread work
+    FString ErrorMessage;
+    TSharedPtr<FStructOnScope> TypedParams;
+    if (!CommandRegistry.DecodeParams(CommandType, Params, Bulk.Get(), TypedParams, ErrorMessage))
+    {
+        WriteError(*Writer, ErrorMessage);
+        Sink.SendFrame(*Writer);
+        return;
+    }
+    
+    // Read-only queries are answered from the published snapshot without waiting for the game thread
+    if (FMCPActorSnapshot::IsReadOnlyCommand(CommandType) &&
+        ActorSnapshot->ExecuteReadOnlyCommand(CommandType, Params, *Writer))
+    {
+        Sink.SendFrame(*Writer);
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> ResultJson = ExecuteCommandAndWait(CommandType, Params, Bulk, TypedParams, ErrorMessage);
+    if (ResultJson.IsValid())
+    {
+        Writer->WriteJsonObject(MakeResponseObject(ResultJson));
+    }
+    else
+    {
+        WriteError(*Writer, ErrorMessage);
+    }
+    Sink.SendFrame(*Writer);
+}
+
+FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    FMCPStringResponseSink Sink;
+    ExecuteCommand(CommandType, Params, Sink);
+    return MoveTemp(Sink.Response);
+}
+
+// Execute a command and send its result as item frames followed by a final summary frame
+void UEpicUnrealMCPBridge::ExecuteCommandStreaming(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 ChunkSize, IMCPResponseSink& Sink,
+                                                  const TSharedPtr<FMCPBulkParams>& Bulk)
+{
+    UE_LOG(LogTemp, Display, TEXT("EpicUnrealMCPBridge: Executing streamed command: %s"), *CommandType);
+    
+    ChunkSize = FMath::Max(ChunkSize, 1);
     
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    FString ErrorMessage;
+    TSharedPtr<FStructOnScope> TypedParams;
+    TSharedPtr<FJsonObject> ResultJson;
+    if (CommandRegistry.DecodeParams(CommandType, Params, Bulk.Get(), TypedParams, ErrorMessage))
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        // Snapshot-backed queries are encoded chunk by chunk, so server memory stays bounded
+        if (FMCPActorSnapshot::IsReadOnlyCommand(CommandType) &&
+            ActorSnapshot->StreamReadOnlyCommand(CommandType, Params, ChunkSize, Sink))
+        {
+            return;
+        }
         
-        try
+        // Commands with their own streaming handler encode their items a frame at a time instead of building one result
+        const FMCPCommandSpec* Command = CommandRegistry.Find(CommandType);
+        auto RunOnGameThread = [this](TFunction<void()> Task) { return RunOnGameThreadAndWait(MoveTemp(Task)); };
+        const FMCPStreamContext Context{ ChunkSize, Sink, RunOnGameThread };
+        if (Command && Command->StreamingHandler && TypedParams.IsValid() &&
+            Command->StreamingHandler(TypedParams->GetStructMemory(), Context, ResultJson))
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
+            if (!ResultJson.IsValid())
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
-            }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") || 
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("delete_actor") || 
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("spawn_blueprint_actor"))
-            {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") ||
-                     CommandType == TEXT("add_component_to_blueprint") ||
-                     CommandType == TEXT("set_physics_properties") ||
-                     CommandType == TEXT("compile_blueprint") ||
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_mesh_material_color") ||
-                     CommandType == TEXT("get_available_materials") ||
-                     CommandType == TEXT("apply_material_to_actor") ||
-                     CommandType == TEXT("apply_material_to_blueprint") ||
-                     CommandType == TEXT("get_actor_material_info") ||
-                     CommandType == TEXT("get_blueprint_material_info") ||
-                     CommandType == TEXT("read_blueprint_content") ||
-                     CommandType == TEXT("analyze_blueprint_graph") ||
-                     CommandType == TEXT("get_blueprint_variable_details") ||
-                     CommandType == TEXT("get_blueprint_function_details") ||
-                     CommandType == TEXT("open_asset_in_editor"))
-            {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Graph Commands
-            else if (CommandType == TEXT("add_blueprint_node") ||
-                     CommandType == TEXT("connect_nodes") ||
-                     CommandType == TEXT("create_variable") ||
-                     CommandType == TEXT("set_blueprint_variable_properties") ||
-                     CommandType == TEXT("add_event_node") ||
-                     CommandType == TEXT("delete_node") ||
-                     CommandType == TEXT("set_node_property") ||
-                     CommandType == TEXT("create_function") ||
-                     CommandType == TEXT("add_function_input") ||
-                     CommandType == TEXT("add_function_output") ||
-                     CommandType == TEXT("delete_function") ||
-                     CommandType == TEXT("rename_function"))
-            {
-                ResultJson = BlueprintGraphCommands->HandleCommand(CommandType, Params);
-            }
-            else
-            {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise.SetValue(ResultString);
                 return;
             }
             
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
+            TSharedPtr<FJsonObject> ResponseJson = MakeResponseObject(ResultJson);
+            ResponseJson->SetStringField(TEXT("stream"), TEXT("end"));
+            TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+            Writer->WriteJsonObject(ResponseJson);
+            Sink.SendFrame(*Writer);
+            return;
+        }
+        
+        ResultJson = ExecuteCommandAndWait(CommandType, Params, Bulk, TypedParams, ErrorMessage, &Sink);
+    }
+    if (!ResultJson.IsValid())
+    {
+        ResultJson = FEpicUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    }
+    
+    TSharedPtr<FJsonObject> ResponseJson = MakeResponseObject(ResultJson);
+    
+    // Split the result's top-level arrays into item frames
+    const TSharedPtr<FJsonObject>* ResultObject = nullptr;
+    if (ResponseJson->TryGetObjectField(TEXT("result"), ResultObject))
+    {
+        TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+        TSharedPtr<FJsonObject> Streamed = MakeShared<FJsonObject>();
+        
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : (*ResultObject)->Values)
+        {
+            if (!Field.Value.IsValid() || Field.Value->Type != EJson::Array)
+            {
+                Summary->SetField(Field.Key, Field.Value);
+                continue;
+            }
             
-            if (ResultJson->HasField(TEXT("success")))
+            const TArray<TSharedPtr<FJsonValue>>& Items = Field.Value->AsArray();
+            for (int32 Start = 0; Start < Items.Num(); Start += ChunkSize)
             {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
+                const int32 End = FMath::Min(Start + ChunkSize, Items.Num());
+                
+                TUniquePtr<FMCPPayloadWriter> Frame = Sink.MakeWriter();
+                Frame->BeginObject(3);
+                Frame->WriteKey(TEXT("stream"));
+                Frame->WriteString(TEXT("items"));
+                Frame->WriteKey(TEXT("field"));
+                Frame->WriteString(Field.Key);
+                Frame->WriteKey(TEXT("items"));
+                Frame->BeginArray(End - Start);
+                for (int32 Index = Start; Index < End; ++Index)
                 {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+                    Frame->WriteJsonValue(Items[Index]);
+                }
+                Frame->EndArray();
+                Frame->EndObject();
+                
+                if (!Sink.SendFrame(*Frame))
+                {
+                    return;
                 }
             }
             
-            if (bSuccess)
-            {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-            }
-            else
-            {
-                // Set error status and include the error message
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-            }
+            Streamed->SetNumberField(Field.Key, Items.Num());
         }
-        catch (const std::exception& e)
+        
+        Summary->SetObjectField(TEXT("streamed"), Streamed);
+        ResponseJson->SetObjectField(TEXT("result"), Summary);
+    }
+    
+    ResponseJson->SetStringField(TEXT("stream"), TEXT("end"));
+    
+    TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+    Writer->WriteJsonObject(ResponseJson);
+    Sink.SendFrame(*Writer);
+}
+
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteCommandAndWait(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+                                                                   const TSharedPtr<FMCPBulkParams>& Bulk, const TSharedPtr<FStructOnScope>& TypedParams,
+                                                                   FString& OutError, IMCPResponseSink* ProgressSink)
+{
+    // Create a promise to wait for the result
+    TPromise<TSharedPtr<FJsonObject>> Promise;
+    TFuture<TSharedPtr<FJsonObject>> Future = Promise.GetFuture();
+    
+    // Shared with the game thread task, which may still run after a shutdown returns from here
+    TSharedPtr<FMCPProgressChannel, ESPMode::ThreadSafe> Progress;
+    if (ProgressSink)
+    {
+        Progress = MakeShared<FMCPProgressChannel, ESPMode::ThreadSafe>();
+    }
+    
+    // Queue execution on Game Thread. Only the handler runs there; the response
+    // envelope is built and serialized by the caller on its worker thread.
+    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Bulk, TypedParams, Progress, Promise = MoveTemp(Promise)]() mutable
+    {
+        FMCPProgressChannel::FScope ProgressScope(Progress.Get());
+        Promise.SetValue(ExecuteCommandOnGameThread(CommandType, Params, Bulk.Get(), TypedParams.Get()));
+    });
+    
+    // Don't hold up server shutdown while the game thread is busy
+    while (!Future.WaitFor(FTimespan::FromMilliseconds(100)))
+    {
+        if (!bIsRunning)
         {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            OutError = TEXT("Server is shutting down");
+            return nullptr;
         }
         
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
+        if (Progress.IsValid())
+        {
+            if (TSharedPtr<FJsonObject> Report = Progress->TakeReport())
+            {
+                TUniquePtr<FMCPPayloadWriter> Frame = ProgressSink->MakeWriter();
+                Frame->WriteJsonObject(Report);
+                if (!ProgressSink->SendFrame(*Frame))
+                {
+                    Progress->Cancel();
+                }
+            }
+        }
+    }
+    
+    TSharedPtr<FJsonObject> ResultJson = Future.Get();
+    if (!ResultJson.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Command '%s' returned no result"), *CommandType);
+    }
+    
+    return ResultJson;
+}
+
+bool UEpicUnrealMCPBridge::RunOnGameThreadAndWait(TFunction<void()> Task)
+{
+    TPromise<void> Promise;
+    TFuture<void> Future = Promise.GetFuture();
+    
+    AsyncTask(ENamedThreads::GameThread, [Task = MoveTemp(Task), Promise = MoveTemp(Promise)]() mutable
+    {
+        Task();
+        Promise.SetValue();
     });
     
-    return Future.Get();
-}
\ No newline at end of file
+    while (!Future.WaitFor(FTimespan::FromMilliseconds(100)))
+    {
+        if (!bIsRunning)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+                                                                        const FMCPBulkParams* Bulk, const FStructOnScope* TypedParams,
+                                                                        bool bPublishSnapshot)
+{
+    check(IsInGameThread());
+    
+    TSharedPtr<FJsonObject> ResultJson;
+    
+    const FMCPCommandSpec* Command = CommandRegistry.Find(CommandType);
+    if (!Command)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+    }
+    
+    // Callers that didn't decode up front (the HTTP endpoint) get the same validation here
+    TSharedPtr<FStructOnScope> DecodedParams;
+    if (Command->ParamStruct.IsValid() && !TypedParams)
+    {
+        FString DecodeError;
+        if (!CommandRegistry.DecodeParams(CommandType, Params, Bulk, DecodedParams, DecodeError))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(DecodeError);
+        }
+        TypedParams = DecodedParams.Get();
+    }
+    
+    try
+    {
+        FMCPBulkParams::FScope BulkScope(Bulk);
+        if (Command->ParamStruct.IsValid())
+        {
+            ResultJson = Command->TypedHandler(TypedParams->GetStructMemory());
+        }
+        else
+        {
+            ResultJson = Command->Handler(CommandType, Params);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        ResultJson = FEpicUnrealMCPCommonUtils::CreateErrorResponse(UTF8_TO_TCHAR(e.what()));
+    }
+    
+    // Make the command's effects visible to the next read-only query
+    if (bPublishSnapshot)
+    {
+        ActorSnapshot->PublishIfDirty();
+    }
+    
+    return ResultJson;
+}
+
+TSharedPtr<FJsonObject> UEpicUnrealMCPBridge::MakeResponseObject(const TSharedPtr<FJsonObject>& ResultJson)
+{
+    // Check if the result contains an error
+    bool bSuccess = true;
+    FString ErrorMessage;
+    
+    if (ResultJson->HasField(TEXT("success")))
+    {
+        bSuccess = ResultJson->GetBoolField(TEXT("success"));
+        if (!bSuccess && ResultJson->HasField(TEXT("error")))
+        {
+            ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+        }
+    }
+    
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+    if (bSuccess)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+        ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+    }
+    else
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+    }
+    return ResponseJson;
+}
+
+void UEpicUnrealMCPBridge::WriteError(FMCPPayloadWriter& Writer, const FString& ErrorMessage, bool bStreamEnd)
+{
+    Writer.BeginObject(bStreamEnd ? 3 : 2);
+    Writer.WriteKey(TEXT("status"));
+    Writer.WriteString(TEXT("error"));
+    Writer.WriteKey(TEXT("error"));
+    Writer.WriteString(ErrorMessage);
+    if (bStreamEnd)
+    {
+        Writer.WriteKey(TEXT("stream"));
+        Writer.WriteString(TEXT("end"));
+    }
+    Writer.EndObject();
+}
@@ -0,0 +1,134 @@
+#include "MCPActorRecord.h"
+#include "MCPPayloadWriter.h"
+#include "GameFramework/Actor.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    // Records per parallel encoding chunk
+    constexpr int32 ActorRecordChunkSize = 1024;
+    // Rough encoded size of one record, used to presize chunk buffers
+    constexpr int32 ActorRecordEstimatedSize = 192;
+}
+
+FMCPActorRecord FMCPActorRecord::Capture(const AActor* Actor)
+{
+    FMCPActorRecord Record;
+    if (!Actor)
+    {
+        return Record;
+    }
+
+    Record.Name = Actor->GetFName();
+    Record.ClassName = Actor->GetClass()->GetFName();
+    Record.Transform = Actor->GetActorTransform();
+    if (const AActor* Parent = Actor->GetAttachParentActor())
+    {
+        Record.Parent = Parent->GetFName();
+    }
+    Record.FolderPath = Actor->GetFolderPath();
+    Record.Tags = Actor->Tags;
+
+    FVector Origin;
+    FVector Extent;
+    Actor->GetActorBounds(false, Origin, Extent);
+    Record.Bounds = FBox::BuildAABB(Origin, Extent);
+
+    return Record;
+}
+
+void FMCPActorRecord::Write(FMCPPayloadWriter& Writer, bool bIncludeBounds) const
+{
+    const FVector Location = Transform.GetLocation();
+    const FRotator Rotation = Transform.Rotator();
+    const FVector Scale = Transform.GetScale3D();
+    const bool bWriteBounds = bIncludeBounds && Bounds.IsValid;
+    const bool bWriteParent = !Parent.IsNone();
+    const bool bWriteFolder = !FolderPath.IsNone();
+    const bool bWriteTags = Tags.Num() > 0;
+
+    Writer.BeginObject(5 + (bWriteParent ? 1 : 0) + (bWriteFolder ? 1 : 0) + (bWriteTags ? 1 : 0) + (bWriteBounds ? 1 : 0));
+    Writer.WriteKey(TEXT("name"));
+    Writer.WriteName(Name);
+    Writer.WriteKey(TEXT("class"));
+    Writer.WriteName(ClassName);
+    Writer.WriteKey(TEXT("location"));
+    Writer.WriteVector(Location.X, Location.Y, Location.Z);
+    Writer.WriteKey(TEXT("rotation"));
+    Writer.WriteVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+    Writer.WriteKey(TEXT("scale"));
+    Writer.WriteVector(Scale.X, Scale.Y, Scale.Z);
+
+    if (bWriteParent)
+    {
+        Writer.WriteKey(TEXT("parent"));
+        Writer.WriteName(Parent);
+    }
+
+    if (bWriteFolder)
+    {
+        Writer.WriteKey(TEXT("folder"));
+        Writer.WriteName(FolderPath);
+    }
+
+    if (bWriteTags)
+    {
+        Writer.WriteKey(TEXT("tags"));
+        Writer.BeginArray(Tags.Num());
+        for (const FName& Tag : Tags)
+        {
+            Writer.WriteName(Tag);
+        }
+        Writer.EndArray();
+    }
+
+    if (bWriteBounds)
+    {
+        Writer.WriteKey(TEXT("bounds"));
+        Writer.BeginObject(2);
+        Writer.WriteKey(TEXT("min"));
+        Writer.WriteVector(Bounds.Min.X, Bounds.Min.Y, Bounds.Min.Z);
+        Writer.WriteKey(TEXT("max"));
+        Writer.WriteVector(Bounds.Max.X, Bounds.Max.Y, Bounds.Max.Z);
+        Writer.EndObject();
+    }
+
+    Writer.EndObject();
+}
+
+void FMCPActorRecord::WriteArray(FMCPPayloadWriter& Writer, TConstArrayView<FMCPActorRecord> Records, bool bIncludeBounds)
+{
+    const int32 NumChunks = FMath::DivideAndRoundUp(Records.Num(), ActorRecordChunkSize);
+
+    TArray<TUniquePtr<FMCPPayloadWriter>> Chunks;
+    Chunks.SetNum(NumChunks);
+
+    ParallelFor(NumChunks, [&Chunks, &Writer, Records, bIncludeBounds](int32 ChunkIndex)
+    {
+        const int32 Start = ChunkIndex * ActorRecordChunkSize;
+        const int32 End = FMath::Min(Start + ActorRecordChunkSize, Records.Num());
+
+        TUniquePtr<FMCPPayloadWriter> Chunk = Writer.MakeFragmentWriter();
+        Chunk->GetMutableBytes().Reserve((End - Start) * ActorRecordEstimatedSize);
+
+        for (int32 Index = Start; Index < End; ++Index)
+        {
+            Records[Index].Write(*Chunk, bIncludeBounds);
+        }
+        Chunks[ChunkIndex] = MoveTemp(Chunk);
+    }, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    int64 TotalSize = 0;
+    for (const TUniquePtr<FMCPPayloadWriter>& Chunk : Chunks)
+    {
+        TotalSize += Chunk->GetBytes().Num();
+    }
+    Writer.GetMutableBytes().Reserve(Writer.GetBytes().Num() + TotalSize + 8);
+
+    Writer.BeginArray(Records.Num());
+    for (const TUniquePtr<FMCPPayloadWriter>& Chunk : Chunks)
+    {
+        Writer.AppendFragment(*Chunk);
+    }
+    Writer.EndArray();
+}
@@ -0,0 +1,763 @@
+#include "MCPActorSnapshot.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/Sort.h"
+#include "Algo/BinarySearch.h"
+#include "UObject/UObjectGlobals.h"
+
+// Rebuild at least this often even if no change delegate fired (undo/redo, property edits, ...)
+#define MCP_SNAPSHOT_REFRESH_SECONDS 5.0
+
+namespace
+{
+    // Append a record index to a key's list; indices arrive in ascending order
+    void AddToIndex(TMap<FName, TArray<int32>>& Index, FName Key, int32 RecordIndex)
+    {
+        TArray<int32>& Records = Index.FindOrAdd(Key);
+        if (Records.Num() == 0 || Records.Last() != RecordIndex)
+        {
+            Records.Add(RecordIndex);
+        }
+    }
+
+    // Keep the entries of InOut that are also in Other; both ascending
+    void IntersectSorted(TArray<int32>& InOut, const TArray<int32>& Other)
+    {
+        int32 NumKept = 0;
+        int32 OtherPos = 0;
+        for (int32 Value : InOut)
+        {
+            while (OtherPos < Other.Num() && Other[OtherPos] < Value)
+            {
+                ++OtherPos;
+            }
+            if (OtherPos == Other.Num())
+            {
+                break;
+            }
+            if (Other[OtherPos] == Value)
+            {
+                InOut[NumKept++] = Value;
+            }
+        }
+        InOut.SetNum(NumKept, EAllowShrinking::No);
+    }
+
+    FName NormalizeFolder(const FString& Folder)
+    {
+        FString Path = Folder;
+        Path.TrimCharInline(TEXT('/'), nullptr);
+        return Path.IsEmpty() ? NAME_None : FName(*Path);
+    }
+
+    // Filter and output options shared by the read-only actor commands
+    struct FMCPActorQuery
+    {
+        FString Pattern;
+        bool bFilterByName = false;
+        bool bIncludeBounds = false;
+        // Indexed filters, all of which must match
+        FName ClassName;
+        FName Folder;
+        TArray<FName> Tags;
+        FName Group;
+        // Actors attached, directly or indirectly, under Group in the table being read
+        TSet<FName> GroupMembers;
+
+        bool Parse(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            FString GroupName;
+            if (Params.IsValid())
+            {
+                Params->TryGetBoolField(TEXT("include_bounds"), bIncludeBounds);
+                if (Params->TryGetStringField(TEXT("group"), GroupName) && !GroupName.IsEmpty())
+                {
+                    Group = FName(*GroupName);
+                }
+
+                FString Value;
+                if (Params->TryGetStringField(TEXT("class_name"), Value) && !Value.IsEmpty())
+                {
+                    ClassName = FName(*Value);
+                }
+                if (Params->TryGetStringField(TEXT("folder"), Value))
+                {
+                    Folder = NormalizeFolder(Value);
+                }
+                TArray<FString> TagNames;
+                if (Params->TryGetStringArrayField(TEXT("tags"), TagNames))
+                {
+                    for (const FString& Tag : TagNames)
+                    {
+                        Tags.Add(FName(*Tag));
+                    }
+                }
+            }
+
+            if (CommandType == TEXT("get_actors_in_level"))
+            {
+                return true;
+            }
+            if (CommandType == TEXT("find_actors_by_name"))
+            {
+                // Missing pattern is left to the regular handler's error response
+                bFilterByName = true;
+                return Params.IsValid() && Params->TryGetStringField(TEXT("pattern"), Pattern);
+            }
+            return false;
+        }
+
+        bool IsFiltered() const
+        {
+            return bFilterByName || !Group.IsNone() || !ClassName.IsNone() || !Folder.IsNone() || Tags.Num() > 0;
+        }
+
+        /**
+         * Intersect the index lists of the class, folder and tag filters, smallest first
+         * @return False if none of them is set, in which case every record is a candidate
+         */
+        bool GatherCandidates(const FMCPActorTable& Table, TArray<int32>& OutIndices) const
+        {
+            static const TArray<int32> NoRecords;
+            TArray<const TArray<int32>*, TInlineAllocator<8>> Lists;
+
+            if (!ClassName.IsNone())
+            {
+                // Blueprint classes may be given without their _C suffix
+                const TArray<int32>* Records = Table.ByClass.Find(ClassName);
+                if (!Records)
+                {
+                    Records = Table.ByClass.Find(FName(*(ClassName.ToString() + TEXT("_C"))));
+                }
+                Lists.Add(Records ? Records : &NoRecords);
+            }
+            if (!Folder.IsNone())
+            {
+                const TArray<int32>* Records = Table.ByFolder.Find(Folder);
+                Lists.Add(Records ? Records : &NoRecords);
+            }
+            for (const FName& Tag : Tags)
+            {
+                const TArray<int32>* Records = Table.ByTag.Find(Tag);
+                Lists.Add(Records ? Records : &NoRecords);
+            }
+
+            if (Lists.Num() == 0)
+            {
+                return false;
+            }
+
+            Algo::Sort(Lists, [](const TArray<int32>* A, const TArray<int32>* B) { return A->Num() < B->Num(); });
+            OutIndices = *Lists[0];
+            for (int32 ListIndex = 1; ListIndex < Lists.Num() && OutIndices.Num() > 0; ++ListIndex)
+            {
+                IntersectSorted(OutIndices, *Lists[ListIndex]);
+            }
+            return true;
+        }
+
+        // Call Visit for each matching record in table order until it returns false
+        template <typename FVisitor>
+        void ForEachMatch(const FMCPActorTable& Table, FVisitor&& Visit) const
+        {
+            TArray<int32> Candidates;
+            if (GatherCandidates(Table, Candidates))
+            {
+                for (int32 RecordIndex : Candidates)
+                {
+                    const FMCPActorRecord& Record = Table.Actors[RecordIndex];
+                    if (Matches(Record) && !Visit(Record))
+                    {
+                        return;
+                    }
+                }
+                return;
+            }
+
+            for (const FMCPActorRecord& Record : Table.Actors)
+            {
+                if (Matches(Record) && !Visit(Record))
+                {
+                    return;
+                }
+            }
+        }
+
+        // Collect the group's descendants through the table's parent index; false if the group isn't in the table
+        bool ResolveGroup(const FMCPActorTable& Table)
+        {
+            if (Group.IsNone())
+            {
+                return true;
+            }
+            if (!Table.ByName.Contains(Group))
+            {
+                return false;
+            }
+
+            TArray<FName> Pending = { Group };
+            while (Pending.Num() > 0)
+            {
+                const TArray<int32>* Children = Table.ByParent.Find(Pending.Pop(EAllowShrinking::No));
+                if (!Children)
+                {
+                    continue;
+                }
+                for (int32 RecordIndex : *Children)
+                {
+                    const FName Child = Table.Actors[RecordIndex].Name;
+                    bool bAlreadyMember = false;
+                    GroupMembers.Add(Child, &bAlreadyMember);
+                    if (!bAlreadyMember)
+                    {
+                        Pending.Add(Child);
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Same case-insensitive substring match as FString::Contains, without allocating a string per actor
+        bool Matches(const FMCPActorRecord& Record) const
+        {
+            if (!Group.IsNone() && !GroupMembers.Contains(Record.Name))
+            {
+                return false;
+            }
+            if (!bFilterByName || Pattern.IsEmpty())
+            {
+                return true;
+            }
+
+            TCHAR NameBuffer[NAME_SIZE];
+            Record.Name.ToString(NameBuffer, UE_ARRAY_COUNT(NameBuffer));
+            return FCString::Stristr(NameBuffer, *Pattern) != nullptr;
+        }
+    };
+
+    // Recapture the changed records in place and append the added ones; false if a changed actor has no record
+    bool PatchRecords(FMCPActorTable& Table, const TSet<TWeakObjectPtr<const AActor>>& Changed, const TSet<TWeakObjectPtr<const AActor>>& Added)
+    {
+        for (const TWeakObjectPtr<const AActor>& WeakActor : Changed)
+        {
+            const AActor* Actor = WeakActor.Get();
+            const int32* RecordIndex = Actor ? Table.ByName.Find(Actor->GetFName()) : nullptr;
+            if (!RecordIndex)
+            {
+                return false;
+            }
+            // Class, folder and tags are unchanged, so only the parent index can need updating
+            Table.Update(*RecordIndex, Actor);
+        }
+        for (const TWeakObjectPtr<const AActor>& WeakActor : Added)
+        {
+            // Appended records keep the index lists ascending
+            const AActor* Actor = WeakActor.Get();
+            if (IsValid(Actor) && !Table.ByName.Contains(Actor->GetFName()))
+            {
+                Table.Add(Actor);
+            }
+        }
+        return true;
+    }
+
+    void WritePong(FMCPPayloadWriter& Writer, bool bStreamEnd)
+    {
+        Writer.BeginObject(bStreamEnd ? 3 : 2);
+        Writer.WriteKey(TEXT("status"));
+        Writer.WriteString(TEXT("success"));
+        Writer.WriteKey(TEXT("result"));
+        Writer.BeginObject(1);
+        Writer.WriteKey(TEXT("message"));
+        Writer.WriteString(TEXT("pong"));
+        Writer.EndObject();
+        if (bStreamEnd)
+        {
+            Writer.WriteKey(TEXT("stream"));
+            Writer.WriteString(TEXT("end"));
+        }
+        Writer.EndObject();
+    }
+}
+
+void FMCPActorTable::Reset()
+{
+    Actors.Reset();
+    ByClass.Reset();
+    ByFolder.Reset();
+    ByTag.Reset();
+    ByParent.Reset();
+    ByName.Reset();
+}
+
+void FMCPActorTable::Add(const AActor* Actor)
+{
+    const int32 RecordIndex = Actors.Add(FMCPActorRecord::Capture(Actor));
+    const FMCPActorRecord& Record = Actors[RecordIndex];
+    ByName.Add(Record.Name, RecordIndex);
+
+    for (const UClass* Class = Actor->GetClass(); Class; Class = Class->GetSuperClass())
+    {
+        AddToIndex(ByClass, Class->GetFName(), RecordIndex);
+        if (Class == AActor::StaticClass())
+        {
+            break;
+        }
+    }
+
+    if (!Record.FolderPath.IsNone())
+    {
+        // "A/B/C" is also listed under "A" and "A/B"
+        const FString Path = Record.FolderPath.ToString();
+        for (int32 CharIndex = 0; CharIndex < Path.Len(); ++CharIndex)
+        {
+            if (Path[CharIndex] == TEXT('/') && CharIndex > 0)
+            {
+                AddToIndex(ByFolder, FName(*Path.Left(CharIndex)), RecordIndex);
+            }
+        }
+        AddToIndex(ByFolder, Record.FolderPath, RecordIndex);
+    }
+
+    for (const FName& Tag : Record.Tags)
+    {
+        AddToIndex(ByTag, Tag, RecordIndex);
+    }
+
+    if (!Record.Parent.IsNone())
+    {
+        AddToIndex(ByParent, Record.Parent, RecordIndex);
+    }
+}
+
+void FMCPActorTable::Update(int32 RecordIndex, const AActor* Actor)
+{
+    const FName OldParent = Actors[RecordIndex].Parent;
+    Actors[RecordIndex] = FMCPActorRecord::Capture(Actor);
+    const FName NewParent = Actors[RecordIndex].Parent;
+    if (OldParent == NewParent)
+    {
+        return;
+    }
+
+    // Moved records keep the parent lists ascending
+    if (TArray<int32>* OldSiblings = ByParent.Find(OldParent))
+    {
+        OldSiblings->RemoveSingle(RecordIndex);
+        if (OldSiblings->Num() == 0)
+        {
+            ByParent.Remove(OldParent);
+        }
+    }
+    if (!NewParent.IsNone())
+    {
+        TArray<int32>& NewSiblings = ByParent.FindOrAdd(NewParent);
+        NewSiblings.Insert(RecordIndex, Algo::LowerBound(NewSiblings, RecordIndex));
+    }
+}
+
+FMCPActorSnapshot* FMCPActorSnapshot::Active = nullptr;
+
+FMCPActorSnapshot::FMCPActorSnapshot()
+    : FrontIndex(0)
+    , NextVersion(1)
+    , bDirty(true)
+    , LastPublishTime(0.0)
+    , bBackLagsFront(false)
+{
+    Buffers[0] = MakeShared<FMCPActorTable, ESPMode::ThreadSafe>();
+    Buffers[1] = MakeShared<FMCPActorTable, ESPMode::ThreadSafe>();
+}
+
+FMCPActorSnapshot::~FMCPActorSnapshot()
+{
+    Stop();
+}
+
+void FMCPActorSnapshot::Start()
+{
+    check(IsInGameThread());
+
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    if (GEngine)
+    {
+        ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorSnapshot::OnActorAdded);
+        ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorSnapshot::OnActorDeleted);
+        ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPActorSnapshot::OnActorChanged);
+        ActorAttachedHandle = GEngine->OnLevelActorAttached().AddRaw(this, &FMCPActorSnapshot::OnActorAttachmentChanged);
+        ActorDetachedHandle = GEngine->OnLevelActorDetached().AddRaw(this, &FMCPActorSnapshot::OnActorAttachmentChanged);
+        ActorFolderChangedHandle = GEngine->OnLevelActorFolderChanged().AddRaw(this, &FMCPActorSnapshot::OnActorFolderChanged);
+    }
+    MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FMCPActorSnapshot::OnMapChanged);
+    PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPActorSnapshot::OnObjectPropertyChanged);
+
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPActorSnapshot::Tick), 0.0f);
+    Active = this;
+
+    UE_LOG(LogTemp, Display, TEXT("MCPActorSnapshot: Started"));
+}
+
+void FMCPActorSnapshot::Stop()
+{
+    if (Active == this)
+    {
+        Active = nullptr;
+    }
+
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    if (GEngine)
+    {
+        GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+        GEngine->OnActorMoved().Remove(ActorMovedHandle);
+        GEngine->OnLevelActorAttached().Remove(ActorAttachedHandle);
+        GEngine->OnLevelActorDetached().Remove(ActorDetachedHandle);
+        GEngine->OnLevelActorFolderChanged().Remove(ActorFolderChangedHandle);
+    }
+    FEditorDelegates::MapChange.Remove(MapChangeHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+
+    ActorAddedHandle.Reset();
+    ActorDeletedHandle.Reset();
+    ActorMovedHandle.Reset();
+    ActorAttachedHandle.Reset();
+    ActorDetachedHandle.Reset();
+    ActorFolderChangedHandle.Reset();
+    MapChangeHandle.Reset();
+    PropertyChangedHandle.Reset();
+}
+
+bool FMCPActorSnapshot::Tick(float DeltaTime)
+{
+    if (!bDirty && FPlatformTime::Seconds() - LastPublishTime >= MCP_SNAPSHOT_REFRESH_SECONDS)
+    {
+        bDirty = true;
+    }
+
+    PublishIfDirty();
+    return true;
+}
+
+void FMCPActorSnapshot::PublishIfDirty()
+{
+    check(IsInGameThread());
+
+    if (bDirty || ChangedActors.Num() > 0 || AddedActors.Num() > 0)
+    {
+        Publish();
+    }
+}
+
+void FMCPActorSnapshot::MarkDirty()
+{
+    bDirty = true;
+}
+
+void FMCPActorSnapshot::OnActorAdded(AActor* Actor)
+{
+    AddedActors.Add(Actor);
+}
+
+void FMCPActorSnapshot::OnActorDeleted(AActor* Actor)
+{
+    // Removing a record shifts the indices of every record after it
+    MarkDirty();
+}
+
+void FMCPActorSnapshot::NotifyActorChanged(AActor* Actor)
+{
+    check(IsInGameThread());
+
+    if (Active && Actor)
+    {
+        Active->OnActorChanged(Actor);
+    }
+}
+
+void FMCPActorSnapshot::OnActorChanged(AActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    // Attached actors move with their parent without an event of their own
+    TArray<AActor*> Attached;
+    Actor->GetAttachedActors(Attached, true, true);
+    Attached.Add(Actor);
+
+    for (const AActor* Changed : Attached)
+    {
+        if (!AddedActors.Contains(Changed))
+        {
+            ChangedActors.Add(Changed);
+        }
+    }
+}
+
+void FMCPActorSnapshot::OnActorAttachmentChanged(AActor* Actor, const AActor* Parent)
+{
+    OnActorChanged(Actor);
+}
+
+void FMCPActorSnapshot::OnActorFolderChanged(const AActor* Actor, FName OldPath)
+{
+    // A new actor is captured with its final folder; moving an existing one changes the folder index
+    if (!AddedActors.Contains(Actor))
+    {
+        MarkDirty();
+    }
+}
+
+void FMCPActorSnapshot::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    // Tag edits don't fire an actor event; other property edits are picked up by the periodic refresh
+    if (Object && Object->IsA<AActor>() && Event.GetPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags) &&
+        !AddedActors.Contains(Cast<AActor>(Object)))
+    {
+        MarkDirty();
+    }
+}
+
+void FMCPActorSnapshot::OnMapChanged(uint32 MapChangeFlags)
+{
+    MarkDirty();
+}
+
+bool FMCPActorSnapshot::ApplyChanges(FMCPActorTable& Back, bool bBackLagsFront) const
+{
+    if (bBackLagsFront)
+    {
+        // Catch up with the front by redoing only the records the last publish changed
+        if (!PatchRecords(Back, LastChangedActors, LastAddedActors))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        Back = *Buffers[FrontIndex];
+    }
+    return PatchRecords(Back, ChangedActors, AddedActors);
+}
+
+void FMCPActorSnapshot::Publish()
+{
+    const bool bRebuild = bDirty || Buffers[FrontIndex]->Version == 0;
+    bDirty = false;
+    LastPublishTime = FPlatformTime::Seconds();
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        ChangedActors.Reset();
+        AddedActors.Reset();
+        return;
+    }
+
+    // Reuse the back buffer unless a reader still holds it from before the last swap
+    const int32 BackIndex = 1 - FrontIndex;
+    TSharedPtr<FMCPActorTable, ESPMode::ThreadSafe> Back;
+    bool bReusedBack = false;
+    if (Buffers[BackIndex].IsUnique())
+    {
+        Back = Buffers[BackIndex];
+        bReusedBack = true;
+    }
+    else
+    {
+        Back = MakeShared<FMCPActorTable, ESPMode::ThreadSafe>();
+        Back->Actors.Reserve(Buffers[FrontIndex]->Actors.Num());
+    }
+
+    const bool bIncremental = !bRebuild && ApplyChanges(*Back, bReusedBack && bBackLagsFront);
+    if (!bIncremental)
+    {
+        Back->Reset();
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            AActor* Actor = *It;
+            if (!Actor || !IsValid(Actor))
+            {
+                continue;
+            }
+
+            Back->Add(Actor);
+        }
+    }
+
+    // After the swap the back buffer is the old front, which lacks exactly this publish's changes
+    bBackLagsFront = bIncremental;
+    LastChangedActors = MoveTemp(ChangedActors);
+    LastAddedActors = MoveTemp(AddedActors);
+    ChangedActors.Reset();
+    AddedActors.Reset();
+
+    Back->Version = NextVersion++;
+    Back->PublishTime = LastPublishTime;
+
+    {
+        FScopeLock Lock(&SwapLock);
+        Buffers[BackIndex] = Back;
+        FrontIndex = BackIndex;
+    }
+}
+
+TSharedPtr<const FMCPActorTable, ESPMode::ThreadSafe> FMCPActorSnapshot::GetTable() const
+{
+    FScopeLock Lock(&SwapLock);
+    return Buffers[FrontIndex];
+}
+
+bool FMCPActorSnapshot::IsReadOnlyCommand(const FString& CommandType)
+{
+    return CommandType == TEXT("ping") ||
+           CommandType == TEXT("get_actors_in_level") ||
+           CommandType == TEXT("find_actors_by_name");
+}
+
+bool FMCPActorSnapshot::ExecuteReadOnlyCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPPayloadWriter& Writer) const
+{
+    if (CommandType == TEXT("ping"))
+    {
+        WritePong(Writer, false);
+        return true;
+    }
+
+    TSharedPtr<const FMCPActorTable, ESPMode::ThreadSafe> Table = GetTable();
+    if (!Table.IsValid() || Table->Version == 0)
+    {
+        // Nothing published yet, let the game thread answer
+        return false;
+    }
+
+    // An unknown group is left to the regular handler's error response
+    FMCPActorQuery Query;
+    if (!Query.Parse(CommandType, Params) || !Query.ResolveGroup(*Table))
+    {
+        return false;
+    }
+
+    TArray<FMCPActorRecord> MatchingActors;
+    TConstArrayView<FMCPActorRecord> Actors = Table->Actors;
+    if (Query.IsFiltered())
+    {
+        Query.ForEachMatch(*Table, [&MatchingActors](const FMCPActorRecord& Record)
+        {
+            MatchingActors.Add(Record);
+            return true;
+        });
+        Actors = MatchingActors;
+    }
+
+    Writer.BeginObject(2);
+    Writer.WriteKey(TEXT("status"));
+    Writer.WriteString(TEXT("success"));
+    Writer.WriteKey(TEXT("result"));
+    Writer.BeginObject(2);
+    Writer.WriteKey(TEXT("actors"));
+    FMCPActorRecord::WriteArray(Writer, Actors, Query.bIncludeBounds);
+    Writer.WriteKey(TEXT("snapshot_version"));
+    Writer.WriteInteger(static_cast<int64>(Table->Version));
+    Writer.EndObject();
+    Writer.EndObject();
+    return true;
+}
+
+bool FMCPActorSnapshot::StreamReadOnlyCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 ChunkSize, IMCPResponseSink& Sink) const
+{
+    if (CommandType == TEXT("ping"))
+    {
+        TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+        WritePong(*Writer, true);
+        Sink.SendFrame(*Writer);
+        return true;
+    }
+
+    TSharedPtr<const FMCPActorTable, ESPMode::ThreadSafe> Table = GetTable();
+    if (!Table.IsValid() || Table->Version == 0)
+    {
+        return false;
+    }
+
+    // An unknown group is left to the regular handler's error response
+    FMCPActorQuery Query;
+    if (!Query.Parse(CommandType, Params) || !Query.ResolveGroup(*Table))
+    {
+        return false;
+    }
+
+    // Only one chunk of records and one encoded frame are held at a time
+    TArray<FMCPActorRecord> Chunk;
+    Chunk.Reserve(ChunkSize);
+    int32 NumSent = 0;
+
+    auto FlushChunk = [&]() -> bool
+    {
+        if (Chunk.Num() == 0)
+        {
+            return true;
+        }
+
+        TUniquePtr<FMCPPayloadWriter> Frame = Sink.MakeWriter();
+        Frame->BeginObject(3);
+        Frame->WriteKey(TEXT("stream"));
+        Frame->WriteString(TEXT("items"));
+        Frame->WriteKey(TEXT("field"));
+        Frame->WriteString(TEXT("actors"));
+        Frame->WriteKey(TEXT("items"));
+        FMCPActorRecord::WriteArray(*Frame, Chunk, Query.bIncludeBounds);
+        Frame->EndObject();
+
+        NumSent += Chunk.Num();
+        Chunk.Reset();
+        return Sink.SendFrame(*Frame);
+    };
+
+    bool bClientGone = false;
+    Query.ForEachMatch(*Table, [&](const FMCPActorRecord& Record)
+    {
+        Chunk.Add(Record);
+        bClientGone = Chunk.Num() >= ChunkSize && !FlushChunk();
+        return !bClientGone;
+    });
+
+    if (bClientGone || !FlushChunk())
+    {
+        return true;
+    }
+
+    TUniquePtr<FMCPPayloadWriter> Summary = Sink.MakeWriter();
+    Summary->BeginObject(3);
+    Summary->WriteKey(TEXT("status"));
+    Summary->WriteString(TEXT("success"));
+    Summary->WriteKey(TEXT("result"));
+    Summary->BeginObject(2);
+    Summary->WriteKey(TEXT("streamed"));
+    Summary->BeginObject(1);
+    Summary->WriteKey(TEXT("actors"));
+    Summary->WriteInteger(NumSent);
+    Summary->EndObject();
+    Summary->WriteKey(TEXT("snapshot_version"));
+    Summary->WriteInteger(static_cast<int64>(Table->Version));
+    Summary->EndObject();
+    Summary->WriteKey(TEXT("stream"));
+    Summary->WriteString(TEXT("end"));
+    Summary->EndObject();
+    Sink.SendFrame(*Summary);
+    return true;
+}
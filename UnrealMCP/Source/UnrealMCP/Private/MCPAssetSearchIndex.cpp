@@ -0,0 +1,389 @@
+#include "MCPAssetSearchIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
+#include "Algo/Unique.h"
+
+// Removed entries tolerated before the postings are rebuilt without them
+#define MCP_SEARCH_COMPACT_THRESHOLD 1024
+// Longer queries only use their first trigrams
+#define MCP_SEARCH_MAX_QUERY_TRIGRAMS 64
+
+namespace
+{
+    uint64 MakeTrigram(const TCHAR* Chars)
+    {
+        return (uint64(uint32(Chars[0])) << 42) | (uint64(uint32(Chars[1])) << 21) | uint64(uint32(Chars[2]));
+    }
+
+    // Unique trigrams of a lowercased string, in ascending order
+    void GetTrigrams(const FString& Text, TArray<uint64, TInlineAllocator<64>>& OutTrigrams)
+    {
+        OutTrigrams.Reset();
+        for (int32 Index = 0; Index + 3 <= Text.Len(); ++Index)
+        {
+            OutTrigrams.Add(MakeTrigram(*Text + Index));
+        }
+        OutTrigrams.Sort();
+        OutTrigrams.SetNum(Algo::Unique(OutTrigrams));
+    }
+
+    struct FCandidate
+    {
+        int32 Index;
+        float Score;
+        int32 Length;
+    };
+
+    // True if A ranks below B; the heap keeps the lowest ranked candidate on top
+    bool RanksBelow(const FCandidate& A, const FCandidate& B)
+    {
+        if (A.Score != B.Score)
+        {
+            return A.Score < B.Score;
+        }
+        return A.Length > B.Length;
+    }
+}
+
+FMCPAssetSearchIndex::FMCPAssetSearchIndex()
+    : NumRemoved(0)
+    , bBuilt(false)
+{
+}
+
+FMCPAssetSearchIndex::~FMCPAssetSearchIndex()
+{
+    Stop();
+}
+
+void FMCPAssetSearchIndex::Stop()
+{
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+
+    Entries.Empty();
+    EntryIndices.Empty();
+    Postings.Empty();
+    Classes.Empty();
+    ClassIndices.Empty();
+    Counts.Empty();
+    Touched.Empty();
+    NumRemoved = 0;
+    bBuilt = false;
+}
+
+void FMCPAssetSearchIndex::Build()
+{
+    check(IsInGameThread());
+
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Assets the registry is still discovering arrive through OnAssetAdded
+    AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FMCPAssetSearchIndex::OnAssetAdded);
+    AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FMCPAssetSearchIndex::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FMCPAssetSearchIndex::OnAssetRenamed);
+
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAllAssets(Assets, true);
+
+    Entries.Reserve(Assets.Num());
+    EntryIndices.Reserve(Assets.Num());
+    Counts.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        OnAssetAdded(AssetData);
+    }
+    bBuilt = true;
+
+    UE_LOG(LogTemp, Display, TEXT("MCPAssetSearchIndex: Indexed %d assets (%d trigrams) in %.1f ms"),
+           NumAssets(), Postings.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMCPAssetSearchIndex::Compact()
+{
+    TArray<FEntry> OldEntries = MoveTemp(Entries);
+    const TArray<FTopLevelAssetPath> OldClasses = MoveTemp(Classes);
+
+    Entries.Reset();
+    EntryIndices.Reset();
+    Postings.Reset();
+    Classes.Reset();
+    ClassIndices.Reset();
+    Counts.Reset();
+    NumRemoved = 0;
+
+    for (const FEntry& Entry : OldEntries)
+    {
+        if (!Entry.bRemoved)
+        {
+            AddEntry(Entry.ObjectPath, OldClasses[Entry.ClassIndex]);
+        }
+    }
+}
+
+void FMCPAssetSearchIndex::AddEntry(const FTopLevelAssetPath& ObjectPath, const FTopLevelAssetPath& ClassPath)
+{
+    if (EntryIndices.Contains(ObjectPath))
+    {
+        return;
+    }
+
+    FEntry Entry;
+    Entry.ObjectPath = ObjectPath;
+    Entry.Text = ObjectPath.GetPackageName().ToString().ToLower();
+
+    const FString AssetName = ObjectPath.GetAssetName().ToString().ToLower();
+    if (FPackageName::GetShortName(Entry.Text) != AssetName)
+    {
+        Entry.Text.AppendChar(TEXT('.'));
+        Entry.Text.Append(AssetName);
+    }
+    Entry.NameStart = Entry.Text.Len() - AssetName.Len();
+
+    if (const int32* ClassIndex = ClassIndices.Find(ClassPath))
+    {
+        Entry.ClassIndex = *ClassIndex;
+    }
+    else
+    {
+        Entry.ClassIndex = Classes.Add(ClassPath);
+        ClassIndices.Add(ClassPath, Entry.ClassIndex);
+    }
+
+    // New entries always get the highest index, so posting lists stay sorted
+    const int32 Index = Entries.Num();
+    TArray<uint64, TInlineAllocator<64>> Trigrams;
+    GetTrigrams(Entry.Text, Trigrams);
+    for (uint64 Trigram : Trigrams)
+    {
+        Postings.FindOrAdd(Trigram).Add(Index);
+    }
+
+    Entries.Add(MoveTemp(Entry));
+    EntryIndices.Add(ObjectPath, Index);
+    Counts.Add(0);
+}
+
+void FMCPAssetSearchIndex::RemoveEntry(const FTopLevelAssetPath& ObjectPath)
+{
+    int32 Index = INDEX_NONE;
+    if (!EntryIndices.RemoveAndCopyValue(ObjectPath, Index))
+    {
+        return;
+    }
+
+    Entries[Index].bRemoved = true;
+    ++NumRemoved;
+
+    if (NumRemoved > MCP_SEARCH_COMPACT_THRESHOLD && NumRemoved * 4 > Entries.Num())
+    {
+        Compact();
+    }
+}
+
+void FMCPAssetSearchIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+    if (AssetData.IsRedirector())
+    {
+        return;
+    }
+    AddEntry(FTopLevelAssetPath(AssetData.PackageName, AssetData.AssetName), AssetData.AssetClassPath);
+}
+
+void FMCPAssetSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    RemoveEntry(FTopLevelAssetPath(AssetData.PackageName, AssetData.AssetName));
+}
+
+void FMCPAssetSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    FTopLevelAssetPath OldPath;
+    if (OldPath.TrySetPath(OldObjectPath))
+    {
+        RemoveEntry(OldPath);
+    }
+    OnAssetAdded(AssetData);
+}
+
+float FMCPAssetSearchIndex::ScoreEntry(const FEntry& Entry, const TArray<FString>& Terms, int32 MatchedTrigrams, int32 QueryTrigrams) const
+{
+    // Trigram overlap dominates; name matches order assets that overlap equally
+    float Score = QueryTrigrams > 0 ? 100.0f * MatchedTrigrams / QueryTrigrams : 0.0f;
+
+    const int32 NameLength = Entry.Text.Len() - Entry.NameStart;
+    float TermScore = 0.0f;
+    for (const FString& Term : Terms)
+    {
+        const int32 NamePosition = Entry.Text.Find(Term, ESearchCase::CaseSensitive, ESearchDir::FromStart, Entry.NameStart);
+        if (NamePosition == Entry.NameStart)
+        {
+            TermScore += NameLength == Term.Len() ? 60.0f : 30.0f;
+        }
+        else if (NamePosition != INDEX_NONE)
+        {
+            TermScore += 20.0f;
+        }
+        else if (Entry.Text.Contains(Term, ESearchCase::CaseSensitive))
+        {
+            TermScore += 10.0f;
+        }
+    }
+    if (Terms.Num() > 0)
+    {
+        Score += TermScore / Terms.Num();
+    }
+
+    // Prefer shorter, more specific names
+    return Score - 0.1f * NameLength;
+}
+
+void FMCPAssetSearchIndex::Search(const FString& Query, const TArray<FString>& ClassFilters, const FString& PathPrefix, int32 Limit,
+    TArray<FMCPAssetSearchHit>& OutHits, int32& OutTotalMatches)
+{
+    check(IsInGameThread());
+
+    OutHits.Reset();
+    OutTotalMatches = 0;
+
+    if (!bBuilt)
+    {
+        Build();
+    }
+
+    TArray<FString> Terms;
+    Query.ToLower().ParseIntoArrayWS(Terms);
+
+    // Resolve the class filter to class indices once
+    TBitArray<> AllowedClasses(ClassFilters.Num() == 0, Classes.Num());
+    for (const FString& Filter : ClassFilters)
+    {
+        FTopLevelAssetPath FilterPath;
+        const bool bIsPath = Filter.StartsWith(TEXT("/")) && FilterPath.TrySetPath(Filter);
+        const FName FilterName(*Filter);
+        for (int32 ClassIndex = 0; ClassIndex < Classes.Num(); ++ClassIndex)
+        {
+            if (bIsPath ? Classes[ClassIndex] == FilterPath : Classes[ClassIndex].GetAssetName() == FilterName)
+            {
+                AllowedClasses[ClassIndex] = true;
+            }
+        }
+    }
+
+    const FString LowerPrefix = PathPrefix.ToLower();
+    TArray<FString> ShortTerms;
+    TArray<uint64, TInlineAllocator<64>> QueryTrigrams;
+    {
+        TArray<uint64, TInlineAllocator<64>> TermTrigrams;
+        for (const FString& Term : Terms)
+        {
+            if (Term.Len() < 3)
+            {
+                ShortTerms.Add(Term);
+                continue;
+            }
+            GetTrigrams(Term, TermTrigrams);
+            QueryTrigrams.Append(TermTrigrams);
+        }
+        QueryTrigrams.Sort();
+        QueryTrigrams.SetNum(FMath::Min(Algo::Unique(QueryTrigrams), MCP_SEARCH_MAX_QUERY_TRIGRAMS));
+    }
+
+    auto PassesFilters = [&](const FEntry& Entry)
+    {
+        if (Entry.bRemoved || !AllowedClasses[Entry.ClassIndex])
+        {
+            return false;
+        }
+        if (!LowerPrefix.IsEmpty() && !Entry.Text.StartsWith(LowerPrefix, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+        // Terms too short for a trigram must appear verbatim
+        for (const FString& Term : ShortTerms)
+        {
+            if (!Entry.Text.Contains(Term, ESearchCase::CaseSensitive))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    Limit = FMath::Max(Limit, 1);
+    TArray<FCandidate> Heap;
+    Heap.Reserve(Limit + 1);
+    auto Offer = [&](int32 Index, int32 MatchedTrigrams)
+    {
+        const FEntry& Entry = Entries[Index];
+        ++OutTotalMatches;
+        const FCandidate Candidate = { Index, ScoreEntry(Entry, Terms, MatchedTrigrams, QueryTrigrams.Num()), Entry.Text.Len() };
+        Heap.HeapPush(Candidate, &RanksBelow);
+        if (Heap.Num() > Limit)
+        {
+            Heap.HeapPopDiscard(&RanksBelow);
+        }
+    };
+
+    if (QueryTrigrams.Num() > 0)
+    {
+        // Count shared trigrams per entry from the posting lists
+        Touched.Reset();
+        for (uint64 Trigram : QueryTrigrams)
+        {
+            if (const TArray<int32>* Posting = Postings.Find(Trigram))
+            {
+                for (int32 Index : *Posting)
+                {
+                    if (Counts[Index]++ == 0)
+                    {
+                        Touched.Add(Index);
+                    }
+                }
+            }
+        }
+
+        const int32 MinMatched = (QueryTrigrams.Num() + 1) / 2;
+        for (int32 Index : Touched)
+        {
+            const int32 Matched = Counts[Index];
+            Counts[Index] = 0;
+            if (Matched >= MinMatched && PassesFilters(Entries[Index]))
+            {
+                Offer(Index, Matched);
+            }
+        }
+    }
+    else
+    {
+        // No trigram to look up: filter every entry directly
+        for (int32 Index = 0; Index < Entries.Num(); ++Index)
+        {
+            if (PassesFilters(Entries[Index]))
+            {
+                Offer(Index, 0);
+            }
+        }
+    }
+
+    Heap.Sort([](const FCandidate& A, const FCandidate& B) { return RanksBelow(B, A); });
+    OutHits.Reserve(Heap.Num());
+    for (const FCandidate& Candidate : Heap)
+    {
+        const FEntry& Entry = Entries[Candidate.Index];
+        OutHits.Add({ Entry.ObjectPath, Classes[Entry.ClassIndex], Candidate.Score });
+    }
+}
@@ -0,0 +1,156 @@
+#include "MCPCommandRegistry.h"
+#include "MCPParamStruct.h"
+#include "UObject/StructOnScope.h"
+
+namespace
+{
+    const TCHAR* GetSchemaTypeName(EMCPParamType Type)
+    {
+        switch (Type)
+        {
+        case EMCPParamType::Number:      return TEXT("number");
+        case EMCPParamType::Integer:     return TEXT("integer");
+        case EMCPParamType::Boolean:     return TEXT("boolean");
+        case EMCPParamType::Object:      return TEXT("object");
+        case EMCPParamType::Array:
+        case EMCPParamType::Vector:
+        case EMCPParamType::NumberArray: return TEXT("array");
+        default:                         return TEXT("string");
+        }
+    }
+}
+
+void FMCPCommandRegistry::Register(const FString& Name, const FString& Description, TArray<FMCPParamSpec> Params, FMCPCommandHandler Handler)
+{
+    if (CommandIndices.Contains(Name))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPCommandRegistry: Command '%s' is already registered, ignoring duplicate"), *Name);
+        return;
+    }
+
+    FMCPCommandSpec& Command = Commands.AddDefaulted_GetRef();
+    Command.Name = Name;
+    Command.Description = Description;
+    Command.InputSchema = MakeInputSchema(Params);
+    Command.Params = MoveTemp(Params);
+    Command.Handler = MoveTemp(Handler);
+
+    CommandIndices.Add(Name, Commands.Num() - 1);
+}
+
+void FMCPCommandRegistry::RegisterStruct(const FString& Name, const FString& Description, const UScriptStruct* ParamsStruct, FMCPTypedCommandHandler Handler)
+{
+    if (CommandIndices.Contains(Name))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPCommandRegistry: Command '%s' is already registered, ignoring duplicate"), *Name);
+        return;
+    }
+
+    TSharedPtr<const FMCPParamStructInfo>& Info = ParamStructs.FindOrAdd(ParamsStruct);
+    if (!Info.IsValid())
+    {
+        Info = MakeShared<FMCPParamStructInfo>(ParamsStruct);
+    }
+
+    FMCPCommandSpec& Command = Commands.AddDefaulted_GetRef();
+    Command.Name = Name;
+    Command.Description = Description;
+    Command.Params = Info->GetParamSpecs();
+    Command.InputSchema = MakeInputSchema(Command.Params);
+    Command.InputSchema->SetBoolField(TEXT("additionalProperties"), false);
+    Command.ParamStruct = Info;
+    Command.TypedHandler = MoveTemp(Handler);
+
+    CommandIndices.Add(Name, Commands.Num() - 1);
+}
+
+void FMCPCommandRegistry::SetStructStreamingHandler(const FString& Name, const UScriptStruct* ParamsStruct, FMCPStreamingHandler Handler)
+{
+    const int32* Index = CommandIndices.Find(Name);
+    if (!Index || !Commands[*Index].ParamStruct.IsValid() || Commands[*Index].ParamStruct->GetStruct() != ParamsStruct)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPCommandRegistry: '%s' is not a command registered with %s params, ignoring its streaming handler"),
+            *Name, *GetNameSafe(ParamsStruct));
+        return;
+    }
+
+    Commands[*Index].StreamingHandler = MoveTemp(Handler);
+}
+
+const FMCPCommandSpec* FMCPCommandRegistry::Find(const FString& Name) const
+{
+    const int32* Index = CommandIndices.Find(Name);
+    return Index ? &Commands[*Index] : nullptr;
+}
+
+bool FMCPCommandRegistry::DecodeParams(const FString& Name, const TSharedPtr<FJsonObject>& Params, const FMCPBulkParams* Bulk,
+                                       TSharedPtr<FStructOnScope>& OutTypedParams, FString& OutError) const
+{
+    const FMCPCommandSpec* Command = Find(Name);
+    if (!Command || !Command->ParamStruct.IsValid())
+    {
+        return true;
+    }
+
+    const FJsonObject NoParams;
+    OutTypedParams = Command->ParamStruct->Decode(Params.IsValid() ? *Params : NoParams, Bulk, OutError);
+    return OutTypedParams.IsValid();
+}
+
+TSharedPtr<FJsonObject> FMCPCommandRegistry::MakeInputSchema(const TArray<FMCPParamSpec>& Params)
+{
+    TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> Required;
+
+    for (const FMCPParamSpec& Param : Params)
+    {
+        TSharedPtr<FJsonObject> Property = MakeShared<FJsonObject>();
+        Property->SetStringField(TEXT("type"), GetSchemaTypeName(Param.Type));
+        if (!Param.Description.IsEmpty())
+        {
+            Property->SetStringField(TEXT("description"), Param.Description);
+        }
+
+        if (Param.Type == EMCPParamType::Vector)
+        {
+            TSharedPtr<FJsonObject> Items = MakeShared<FJsonObject>();
+            Items->SetStringField(TEXT("type"), TEXT("number"));
+            Property->SetObjectField(TEXT("items"), Items);
+            Property->SetNumberField(TEXT("minItems"), 3);
+            Property->SetNumberField(TEXT("maxItems"), 3);
+        }
+        else if (Param.Type == EMCPParamType::NumberArray)
+        {
+            TSharedPtr<FJsonObject> Number = MakeShared<FJsonObject>();
+            Number->SetStringField(TEXT("type"), TEXT("number"));
+
+            TSharedPtr<FJsonObject> Row = MakeShared<FJsonObject>();
+            Row->SetStringField(TEXT("type"), TEXT("array"));
+            Row->SetObjectField(TEXT("items"), Number);
+
+            TArray<TSharedPtr<FJsonValue>> ItemTypes;
+            ItemTypes.Add(MakeShared<FJsonValueObject>(Number));
+            ItemTypes.Add(MakeShared<FJsonValueObject>(Row));
+
+            TSharedPtr<FJsonObject> Items = MakeShared<FJsonObject>();
+            Items->SetArrayField(TEXT("anyOf"), ItemTypes);
+            Property->SetObjectField(TEXT("items"), Items);
+        }
+
+        Properties->SetObjectField(Param.Name, Property);
+
+        if (Param.bRequired)
+        {
+            Required.Add(MakeShared<FJsonValueString>(Param.Name));
+        }
+    }
+
+    TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+    Schema->SetStringField(TEXT("type"), TEXT("object"));
+    Schema->SetObjectField(TEXT("properties"), Properties);
+    if (Required.Num() > 0)
+    {
+        Schema->SetArrayField(TEXT("required"), Required);
+    }
+    return Schema;
+}
@@ -0,0 +1,226 @@
+#include "MCPGeneratorLibrary.h"
+#include "EpicUnrealMCPBridge.h"
+#include "MCPPayloadWriter.h"
+#include "MCPProgress.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "EditorAssetLibrary.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "IPythonScriptPlugin.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+
+// Statement the editor's Python runs for run_generator; the module lives in the plugin's Content/Python
+#define MCP_GENERATOR_HOST_STATEMENT TEXT("__import__('unreal_mcp_generators').run()")
+
+namespace
+{
+    // The run_generator call in progress (game thread)
+    FString GeneratorRequest;
+    FString GeneratorResult;
+    bool bGeneratorRunning = false;
+
+    FString JsonObjectToString(const TSharedPtr<FJsonObject>& Object)
+    {
+        TUniquePtr<FMCPPayloadWriter> Writer = FMCPPayloadWriter::Create(EMCPEncoding::Json);
+        Writer->WriteJsonObject(Object);
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Writer->GetBytes().GetData()), Writer->GetBytes().Num());
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    TSharedPtr<FJsonObject> JsonObjectFromString(const FString& Text)
+    {
+        TSharedPtr<FJsonObject> Object;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+        if (!FJsonSerializer::Deserialize(Reader, Object))
+        {
+            return nullptr;
+        }
+        return Object;
+    }
+}
+
+FString UMCPGeneratorLibrary::ExecuteCommand(const FString& CommandType, const FString& ParamsJson)
+{
+    UEpicUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UEpicUnrealMCPBridge>() : nullptr;
+    if (!Bridge)
+    {
+        return JsonObjectToString(UEpicUnrealMCPBridge::MakeResponseObject(FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("MCP bridge is not running"))));
+    }
+
+    TSharedPtr<FJsonObject> Params = ParamsJson.IsEmpty() ? MakeShared<FJsonObject>() : JsonObjectFromString(ParamsJson);
+    if (!Params.IsValid())
+    {
+        return JsonObjectToString(UEpicUnrealMCPBridge::MakeResponseObject(
+            FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Invalid params JSON for %s"), *CommandType))));
+    }
+
+    // The snapshot is published once when the generator finishes, not after every part
+    TSharedPtr<FJsonObject> ResultJson = Bridge->ExecuteCommandOnGameThread(CommandType, Params, nullptr, nullptr, !bGeneratorRunning);
+    if (!ResultJson.IsValid())
+    {
+        ResultJson = FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Command '%s' returned no result"), *CommandType));
+    }
+    return JsonObjectToString(UEpicUnrealMCPBridge::MakeResponseObject(ResultJson));
+}
+
+TArray<FString> UMCPGeneratorLibrary::SpawnStaticMeshActors(const TArray<FMCPGeneratorActor>& Actors)
+{
+    TArray<FString> Names;
+    Names.Reserve(Actors.Num());
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SpawnStaticMeshActors: No editor world"));
+        Names.SetNum(Actors.Num());
+        return Names;
+    }
+
+    // Meshes and parents repeat across a batch; look each up once
+    TMap<FString, UStaticMesh*> Meshes;
+    TMap<FString, AActor*> Parents;
+
+    for (const FMCPGeneratorActor& Spec : Actors)
+    {
+        UStaticMesh* Mesh = nullptr;
+        if (!Spec.StaticMesh.IsEmpty())
+        {
+            if (UStaticMesh** Cached = Meshes.Find(Spec.StaticMesh))
+            {
+                Mesh = *Cached;
+            }
+            else
+            {
+                Mesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(Spec.StaticMesh));
+                Meshes.Add(Spec.StaticMesh, Mesh);
+                if (!Mesh)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("SpawnStaticMeshActors: Could not find static mesh at path: %s"), *Spec.StaticMesh);
+                }
+            }
+        }
+
+        AActor* Parent = nullptr;
+        if (!Spec.Parent.IsEmpty())
+        {
+            if (AActor** Cached = Parents.Find(Spec.Parent))
+            {
+                Parent = *Cached;
+            }
+            else
+            {
+                Parent = FEpicUnrealMCPCommonUtils::FindActorByName(World, Spec.Parent);
+                Parents.Add(Spec.Parent, Parent);
+            }
+            if (!Parent)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("SpawnStaticMeshActors: Parent actor not found: %s"), *Spec.Parent);
+                Names.AddDefaulted();
+                continue;
+            }
+        }
+
+        // Taken names get a suffix instead of failing, as in spawn_blueprint_actors
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = Spec.Name.IsEmpty() ? NAME_None : FName(*Spec.Name);
+        SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+        AStaticMeshActor* NewActor = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(),
+            FTransform(Spec.Rotation, Spec.Location, Spec.Scale), SpawnParams);
+        if (!NewActor)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SpawnStaticMeshActors: Failed to spawn %s"), *Spec.Name);
+            Names.AddDefaulted();
+            continue;
+        }
+
+        if (Mesh)
+        {
+            NewActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+        }
+        if (!FEpicUnrealMCPCommonUtils::AddActorToGroup(NewActor, Parent, Spec.Folder))
+        {
+            // A part left outside its group would not move or delete with it; fail this spawn instead
+            UE_LOG(LogTemp, Warning, TEXT("SpawnStaticMeshActors: Could not attach %s to %s"), *NewActor->GetName(), *Spec.Parent);
+            NewActor->Destroy();
+            Names.AddDefaulted();
+            continue;
+        }
+        Names.Add(NewActor->GetName());
+    }
+
+    return Names;
+}
+
+bool UMCPGeneratorLibrary::ReportProgress(int32 Done, int32 Total, const FString& Message)
+{
+    return FMCPProgressChannel::Report(Done, Total, Message);
+}
+
+FString UMCPGeneratorLibrary::GetGeneratorRequest()
+{
+    return GeneratorRequest;
+}
+
+void UMCPGeneratorLibrary::SetGeneratorResult(const FString& ResultJson)
+{
+    GeneratorResult = ResultJson;
+}
+
+TSharedPtr<FJsonObject> UMCPGeneratorLibrary::RunGenerator(const TSharedPtr<FJsonObject>& Request, FString& OutError)
+{
+    check(IsInGameThread());
+
+    IPythonScriptPlugin* Python = IPythonScriptPlugin::Get();
+    if (!Python || !Python->IsPythonAvailable())
+    {
+        OutError = TEXT("Python scripting is not available; enable the Python Editor Script Plugin");
+        return nullptr;
+    }
+    if (bGeneratorRunning)
+    {
+        OutError = TEXT("A generator is already running");
+        return nullptr;
+    }
+
+    GeneratorRequest = JsonObjectToString(Request);
+    GeneratorResult.Reset();
+    bGeneratorRunning = true;
+
+    FPythonCommandEx Command;
+    Command.Command = MCP_GENERATOR_HOST_STATEMENT;
+    Command.ExecutionMode = EPythonCommandExecutionMode::ExecuteStatement;
+    const bool bSucceeded = Python->ExecPythonCommandEx(Command);
+
+    bGeneratorRunning = false;
+    GeneratorRequest.Reset();
+
+    if (!bSucceeded)
+    {
+        // Python reports the exception and its traceback as error log output
+        for (const FPythonLogOutputEntry& Entry : Command.LogOutput)
+        {
+            if (Entry.Type == EPythonLogOutputType::Error)
+            {
+                OutError += Entry.Output;
+            }
+        }
+        if (OutError.IsEmpty())
+        {
+            OutError = Command.CommandResult.IsEmpty() ? TEXT("Generator script failed") : Command.CommandResult;
+        }
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Result = JsonObjectFromString(GeneratorResult);
+    GeneratorResult.Reset();
+    if (!Result.IsValid())
+    {
+        OutError = TEXT("Generator script returned no result");
+    }
+    return Result;
+}
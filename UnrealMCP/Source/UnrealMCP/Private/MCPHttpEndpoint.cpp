@@ -0,0 +1,396 @@
+#include "MCPHttpEndpoint.h"
+#include "EpicUnrealMCPBridge.h"
+#include "MCPCommandRegistry.h"
+#include "MCPPayloadWriter.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "HttpServerModule.h"
+#include "IHttpRouter.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "Interfaces/IPluginManager.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+
+// Protocol revision answered when the client asks for one we don't know
+#define MCP_PROTOCOL_VERSION TEXT("2025-03-26")
+
+namespace
+{
+    // JSON-RPC 2.0 error codes
+    const int32 JsonRpcParseError = -32700;
+    const int32 JsonRpcInvalidRequest = -32600;
+    const int32 JsonRpcMethodNotFound = -32601;
+    const int32 JsonRpcInvalidParams = -32602;
+
+    bool IsSupportedProtocolVersion(const FString& Version)
+    {
+        return Version == TEXT("2024-11-05") || Version == TEXT("2025-03-26") || Version == TEXT("2025-06-18");
+    }
+
+    // The engine's HTTP listener may be bound to every interface; only this machine may call the editor
+    bool IsLoopbackPeer(const FHttpServerRequest& Request)
+    {
+        if (!Request.PeerAddress.IsValid())
+        {
+            return false;
+        }
+
+        const FString Address = Request.PeerAddress->ToString(false);
+        return Address.StartsWith(TEXT("127.")) || Address == TEXT("::1") || Address.StartsWith(TEXT("::ffff:127."));
+    }
+
+    // Browsers always send Origin on POST, so a request without one comes from a local
+    // process rather than a web page; pages must be served from this machine
+    bool IsAllowedOrigin(const FHttpServerRequest& Request)
+    {
+        const TArray<FString>* Origins = Request.Headers.Find(TEXT("Origin"));
+        if (!Origins || Origins->Num() == 0)
+        {
+            return true;
+        }
+
+        FString Host = (*Origins)[0];
+        if (!Host.RemoveFromStart(TEXT("http://")) && !Host.RemoveFromStart(TEXT("https://")))
+        {
+            return false;
+        }
+
+        // Drop the port; bracketed IPv6 hosts keep their colons
+        int32 PortStart = INDEX_NONE;
+        if (Host.StartsWith(TEXT("[")))
+        {
+            PortStart = Host.Find(TEXT("]:"));
+            PortStart = PortStart == INDEX_NONE ? INDEX_NONE : PortStart + 1;
+        }
+        else
+        {
+            Host.FindChar(TEXT(':'), PortStart);
+        }
+        if (PortStart != INDEX_NONE)
+        {
+            Host.LeftInline(PortStart);
+        }
+
+        return Host.Equals(TEXT("localhost"), ESearchCase::IgnoreCase) || Host == TEXT("127.0.0.1") || Host == TEXT("[::1]");
+    }
+
+    TUniquePtr<FHttpServerResponse> MakeJsonResponse(const TSharedPtr<FJsonValue>& Body)
+    {
+        FMCPJsonPayloadWriter Writer;
+        Writer.WriteJsonValue(Body);
+        return FHttpServerResponse::Create(MoveTemp(Writer.GetMutableBytes()), TEXT("application/json"));
+    }
+}
+
+FMCPHttpEndpoint::FMCPHttpEndpoint(UEpicUnrealMCPBridge* InBridge)
+    : Bridge(InBridge)
+{
+}
+
+FMCPHttpEndpoint::~FMCPHttpEndpoint()
+{
+    Stop();
+}
+
+bool FMCPHttpEndpoint::Start(uint32 Port)
+{
+    if (IsRunning())
+    {
+        return true;
+    }
+
+    FHttpServerModule& HttpServer = FHttpServerModule::Get();
+    Router = HttpServer.GetHttpRouter(Port, /*bFailOnBindFailure=*/ true);
+    if (!Router.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCPHttpEndpoint: Failed to bind HTTP port %u"), Port);
+        return false;
+    }
+
+    RouteHandle = Router->BindRoute(
+        FHttpPath(TEXT("/mcp")),
+        EHttpServerRequestVerbs::VERB_POST | EHttpServerRequestVerbs::VERB_GET | EHttpServerRequestVerbs::VERB_DELETE,
+        FHttpRequestHandler::CreateRaw(this, &FMCPHttpEndpoint::HandleRequest));
+
+    if (!RouteHandle.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCPHttpEndpoint: Failed to bind /mcp on port %u"), Port);
+        Router.Reset();
+        return false;
+    }
+
+    HttpServer.StartAllListeners();
+    UE_LOG(LogTemp, Display, TEXT("MCPHttpEndpoint: Serving MCP at http://127.0.0.1:%u/mcp"), Port);
+    return true;
+}
+
+void FMCPHttpEndpoint::Stop()
+{
+    if (Router.IsValid() && RouteHandle.IsValid())
+    {
+        Router->UnbindRoute(RouteHandle);
+    }
+    RouteHandle.Reset();
+    Router.Reset();
+}
+
+bool FMCPHttpEndpoint::HandleRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+    if (!IsLoopbackPeer(Request))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPHttpEndpoint: Refused request from %s"),
+               Request.PeerAddress.IsValid() ? *Request.PeerAddress->ToString(true) : TEXT("unknown peer"));
+        OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::Denied, TEXT("forbidden_peer"), TEXT("Only local clients may connect")));
+        return true;
+    }
+
+    if (!IsAllowedOrigin(Request))
+    {
+        OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::Denied, TEXT("forbidden_origin"), TEXT("Origin not allowed")));
+        return true;
+    }
+
+    // No server-initiated messages or sessions, so there is no SSE stream to open or session to end
+    if (Request.Verb != EHttpServerRequestVerbs::VERB_POST)
+    {
+        OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::BadMethod, TEXT("method_not_allowed"), TEXT("Use POST")));
+        return true;
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Request.Body.GetData()), Request.Body.Num());
+    const FString Body(Converted.Length(), Converted.Get());
+
+    TSharedPtr<FJsonValue> Parsed;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
+    if (!FJsonSerializer::Deserialize(Reader, Parsed) || !Parsed.IsValid())
+    {
+        OnComplete(MakeJsonResponse(MakeShared<FJsonValueObject>(MakeError(MakeShared<FJsonValueNull>(), JsonRpcParseError, TEXT("Parse error")))));
+        return true;
+    }
+
+    // A batch gets an array of responses; notifications get none
+    if (Parsed->Type == EJson::Array)
+    {
+        TArray<TSharedPtr<FJsonValue>> Responses;
+        for (const TSharedPtr<FJsonValue>& Item : Parsed->AsArray())
+        {
+            const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+            TSharedPtr<FJsonObject> Response;
+            if (Item.IsValid() && Item->TryGetObject(ItemObject))
+            {
+                Response = HandleMessage(*ItemObject);
+            }
+            else
+            {
+                Response = MakeError(MakeShared<FJsonValueNull>(), JsonRpcInvalidRequest, TEXT("Invalid Request"));
+            }
+
+            if (Response.IsValid())
+            {
+                Responses.Add(MakeShared<FJsonValueObject>(Response));
+            }
+        }
+
+        if (Responses.Num() == 0)
+        {
+            TUniquePtr<FHttpServerResponse> Accepted = MakeUnique<FHttpServerResponse>();
+            Accepted->Code = EHttpServerResponseCodes::Accepted;
+            OnComplete(MoveTemp(Accepted));
+            return true;
+        }
+
+        OnComplete(MakeJsonResponse(MakeShared<FJsonValueArray>(Responses)));
+        return true;
+    }
+
+    const TSharedPtr<FJsonObject>* MessageObject = nullptr;
+    if (!Parsed->TryGetObject(MessageObject))
+    {
+        OnComplete(MakeJsonResponse(MakeShared<FJsonValueObject>(MakeError(MakeShared<FJsonValueNull>(), JsonRpcInvalidRequest, TEXT("Invalid Request")))));
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> Response = HandleMessage(*MessageObject);
+    if (!Response.IsValid())
+    {
+        TUniquePtr<FHttpServerResponse> Accepted = MakeUnique<FHttpServerResponse>();
+        Accepted->Code = EHttpServerResponseCodes::Accepted;
+        OnComplete(MoveTemp(Accepted));
+        return true;
+    }
+
+    OnComplete(MakeJsonResponse(MakeShared<FJsonValueObject>(Response)));
+    return true;
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::HandleMessage(const TSharedPtr<FJsonObject>& Message)
+{
+    const TSharedPtr<FJsonValue> Id = Message->TryGetField(TEXT("id"));
+
+    FString Method;
+    if (!Message->TryGetStringField(TEXT("method"), Method))
+    {
+        // Responses to server requests are not expected; anything else without a method is malformed
+        return Id.IsValid() ? MakeError(Id, JsonRpcInvalidRequest, TEXT("Missing 'method'")) : nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+    const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+    if (Message->TryGetObjectField(TEXT("params"), ParamsObject) && ParamsObject)
+    {
+        Params = *ParamsObject;
+    }
+
+    // Notifications (notifications/initialized, notifications/cancelled, ...) need no reply
+    if (!Id.IsValid())
+    {
+        return nullptr;
+    }
+
+    if (Method == TEXT("initialize"))
+    {
+        return MakeResult(Id, HandleInitialize(Params));
+    }
+    if (Method == TEXT("ping"))
+    {
+        return MakeResult(Id, MakeShared<FJsonObject>());
+    }
+    if (Method == TEXT("tools/list"))
+    {
+        return MakeResult(Id, HandleToolsList());
+    }
+    if (Method == TEXT("tools/call"))
+    {
+        FString Error;
+        TSharedPtr<FJsonObject> Result = HandleToolsCall(Params, Error);
+        return Result.IsValid() ? MakeResult(Id, Result) : MakeError(Id, JsonRpcInvalidParams, Error);
+    }
+
+    return MakeError(Id, JsonRpcMethodNotFound, FString::Printf(TEXT("Method not found: %s"), *Method));
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::HandleInitialize(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ProtocolVersion;
+    if (!Params->TryGetStringField(TEXT("protocolVersion"), ProtocolVersion) || !IsSupportedProtocolVersion(ProtocolVersion))
+    {
+        ProtocolVersion = MCP_PROTOCOL_VERSION;
+    }
+
+    TSharedPtr<FJsonObject> Tools = MakeShared<FJsonObject>();
+    Tools->SetBoolField(TEXT("listChanged"), false);
+    TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
+    Capabilities->SetObjectField(TEXT("tools"), Tools);
+
+    FString Version = TEXT("1.0");
+    if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UnrealMCP")))
+    {
+        Version = Plugin->GetDescriptor().VersionName;
+    }
+
+    TSharedPtr<FJsonObject> ServerInfo = MakeShared<FJsonObject>();
+    ServerInfo->SetStringField(TEXT("name"), TEXT("unreal-mcp"));
+    ServerInfo->SetStringField(TEXT("version"), Version);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("protocolVersion"), ProtocolVersion);
+    Result->SetObjectField(TEXT("capabilities"), Capabilities);
+    Result->SetObjectField(TEXT("serverInfo"), ServerInfo);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::HandleToolsList()
+{
+    TArray<TSharedPtr<FJsonValue>> Tools;
+    for (const FMCPCommandSpec& Command : Bridge->GetCommandRegistry().GetCommands())
+    {
+        TSharedPtr<FJsonObject> Tool = MakeShared<FJsonObject>();
+        Tool->SetStringField(TEXT("name"), Command.Name);
+        Tool->SetStringField(TEXT("description"), Command.Description);
+        Tool->SetObjectField(TEXT("inputSchema"), Command.InputSchema);
+        Tools.Add(MakeShared<FJsonValueObject>(Tool));
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetArrayField(TEXT("tools"), Tools);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::HandleToolsCall(const TSharedPtr<FJsonObject>& Params, FString& OutError)
+{
+    FString ToolName;
+    if (!Params->TryGetStringField(TEXT("name"), ToolName))
+    {
+        OutError = TEXT("Missing 'name' parameter");
+        return nullptr;
+    }
+
+    if (!Bridge->GetCommandRegistry().Find(ToolName))
+    {
+        OutError = FString::Printf(TEXT("Unknown tool: %s"), *ToolName);
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Arguments = MakeShared<FJsonObject>();
+    const TSharedPtr<FJsonObject>* ArgumentsObject = nullptr;
+    if (Params->TryGetObjectField(TEXT("arguments"), ArgumentsObject) && ArgumentsObject)
+    {
+        Arguments = *ArgumentsObject;
+    }
+
+    TSharedPtr<FJsonObject> ResultJson = Bridge->ExecuteCommandOnGameThread(ToolName, Arguments);
+    if (!ResultJson.IsValid())
+    {
+        ResultJson = FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Command '%s' returned no result"), *ToolName));
+    }
+
+    // Handler failures are tool errors the model should see, not protocol errors
+    bool bSuccess = true;
+    ResultJson->TryGetBoolField(TEXT("success"), bSuccess);
+
+    FString Text;
+    if (bSuccess)
+    {
+        FMCPJsonPayloadWriter Writer;
+        Writer.WriteJsonObject(ResultJson);
+        Text = Writer.ToString();
+    }
+    else
+    {
+        ResultJson->TryGetStringField(TEXT("error"), Text);
+    }
+
+    TSharedPtr<FJsonObject> Content = MakeShared<FJsonObject>();
+    Content->SetStringField(TEXT("type"), TEXT("text"));
+    Content->SetStringField(TEXT("text"), Text);
+
+    TArray<TSharedPtr<FJsonValue>> ContentArray;
+    ContentArray.Add(MakeShared<FJsonValueObject>(Content));
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetArrayField(TEXT("content"), ContentArray);
+    Result->SetBoolField(TEXT("isError"), !bSuccess);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::MakeResult(const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Result)
+{
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+    Response->SetField(TEXT("id"), Id);
+    Response->SetObjectField(TEXT("result"), Result);
+    return Response;
+}
+
+TSharedPtr<FJsonObject> FMCPHttpEndpoint::MakeError(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message)
+{
+    TSharedPtr<FJsonObject> Error = MakeShared<FJsonObject>();
+    Error->SetNumberField(TEXT("code"), Code);
+    Error->SetStringField(TEXT("message"), Message);
+
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+    Response->SetField(TEXT("id"), Id);
+    Response->SetObjectField(TEXT("error"), Error);
+    return Response;
+}
@@ -0,0 +1,625 @@
+#include "MCPParamStruct.h"
+#include "MCPRequestParser.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UnrealType.h"
+#include "UObject/FieldPathProperty.h"
+#include "JsonObjectConverter.h"
+#include "JsonObjectWrapper.h"
+#include "Algo/LevenshteinDistance.h"
+
+namespace
+{
+    bool IsVectorStruct(const UScriptStruct* Struct)
+    {
+        return Struct == TBaseStructure<FVector>::Get() || Struct == TBaseStructure<FRotator>::Get();
+    }
+
+    // Row length of a bulk number array property, or INDEX_NONE for other arrays (0 means transform rows)
+    int32 GetPackedStride(const FArrayProperty* ArrayProperty)
+    {
+        const FProperty* Inner = ArrayProperty->Inner;
+        if (const FStructProperty* StructInner = CastField<FStructProperty>(Inner))
+        {
+            if (StructInner->Struct == TBaseStructure<FVector>::Get())
+            {
+                return 3;
+            }
+            return StructInner->Struct == TBaseStructure<FTransform>::Get() ? 0 : INDEX_NONE;
+        }
+        if ((Inner->IsA<FDoubleProperty>() || Inner->IsA<FFloatProperty>()) && ArrayProperty->HasMetaData(TEXT("MCPStride")))
+        {
+            return FMath::Max(1, FCString::Atoi(*ArrayProperty->GetMetaData(TEXT("MCPStride"))));
+        }
+        return INDEX_NONE;
+    }
+
+    /**
+     * Whether FJsonObjectConverter can fill Property without looking up or loading
+     * UObjects, including inside nested structs and containers, so decoding it
+     * off the game thread is safe. Soft references stay paths and are fine.
+     */
+    bool IsPlainData(const FProperty* Property, TSet<const UStruct*>& Visited)
+    {
+        if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+        {
+            return ObjectProperty->IsA<FSoftObjectProperty>();
+        }
+        if (Property->IsA<FInterfaceProperty>() || Property->IsA<FDelegateProperty>() ||
+            Property->IsA<FMulticastDelegateProperty>() || Property->IsA<FFieldPathProperty>())
+        {
+            return false;
+        }
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            if (StructProperty->Struct == FJsonObjectWrapper::StaticStruct())
+            {
+                return true;
+            }
+            bool bAlreadyVisited = false;
+            Visited.Add(StructProperty->Struct, &bAlreadyVisited);
+            if (bAlreadyVisited)
+            {
+                return true;
+            }
+            for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+            {
+                if (!IsPlainData(*It, Visited))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return IsPlainData(ArrayProperty->Inner, Visited);
+        }
+        if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            return IsPlainData(SetProperty->ElementProp, Visited);
+        }
+        if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            return IsPlainData(MapProperty->KeyProp, Visited) && IsPlainData(MapProperty->ValueProp, Visited);
+        }
+        return true;
+    }
+
+    bool GetParamType(const FProperty* Property, EMCPParamType& OutType, int32& OutStride)
+    {
+        OutStride = INDEX_NONE;
+
+        // Hard object references, even nested, would need loading while decoding, which may be off the game thread
+        TSet<const UStruct*> Visited;
+        if (!IsPlainData(Property, Visited))
+        {
+            return false;
+        }
+
+        if (Property->IsA<FBoolProperty>())
+        {
+            OutType = EMCPParamType::Boolean;
+        }
+        else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+        {
+            if (NumericProperty->IsEnum())
+            {
+                OutType = EMCPParamType::String;
+            }
+            else
+            {
+                OutType = NumericProperty->IsFloatingPoint() ? EMCPParamType::Number : EMCPParamType::Integer;
+            }
+        }
+        else if (Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>() ||
+                 Property->IsA<FEnumProperty>() || Property->IsA<FSoftObjectProperty>() || Property->IsA<FSoftClassProperty>())
+        {
+            OutType = EMCPParamType::String;
+        }
+        else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            OutType = IsVectorStruct(StructProperty->Struct) ? EMCPParamType::Vector : EMCPParamType::Object;
+        }
+        else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            OutStride = GetPackedStride(ArrayProperty);
+            OutType = OutStride != INDEX_NONE ? EMCPParamType::NumberArray : EMCPParamType::Array;
+        }
+        else if (Property->IsA<FSetProperty>())
+        {
+            OutType = EMCPParamType::Array;
+        }
+        else if (Property->IsA<FMapProperty>())
+        {
+            OutType = EMCPParamType::Object;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // StaticMesh -> static_mesh, bIncludeBounds -> include_bounds, HTTPPort -> http_port
+    FString MakeParamName(const FProperty* Property)
+    {
+        FString Name = Property->GetName();
+        if (Property->IsA<FBoolProperty>() && Name.Len() > 1 && Name[0] == TEXT('b') && FChar::IsUpper(Name[1]))
+        {
+            Name.RightChopInline(1);
+        }
+
+        FString Result;
+        Result.Reserve(Name.Len() + 4);
+        for (int32 Index = 0; Index < Name.Len(); ++Index)
+        {
+            const TCHAR Char = Name[Index];
+            if (FChar::IsUpper(Char) && Index > 0)
+            {
+                const TCHAR Previous = Name[Index - 1];
+                const bool bNextIsLower = Index + 1 < Name.Len() && FChar::IsLower(Name[Index + 1]);
+                if (FChar::IsLower(Previous) || FChar::IsDigit(Previous) || (FChar::IsUpper(Previous) && bNextIsLower))
+                {
+                    Result.AppendChar(TEXT('_'));
+                }
+            }
+            Result.AppendChar(FChar::ToLower(Char));
+        }
+        return Result;
+    }
+
+    // Exclusive upper bound: int64's max rounds up to 2^63 as a double
+    template <typename T>
+    bool FitsInteger(double Number)
+    {
+        return Number >= static_cast<double>(TNumericLimits<T>::Lowest()) && Number < static_cast<double>(TNumericLimits<T>::Max()) + 1.0;
+    }
+
+    bool IsInIntegerRange(const FNumericProperty* Property, double Number)
+    {
+        if (Property->IsA<FInt8Property>())   return FitsInteger<int8>(Number);
+        if (Property->IsA<FInt16Property>())  return FitsInteger<int16>(Number);
+        if (Property->IsA<FIntProperty>())    return FitsInteger<int32>(Number);
+        if (Property->IsA<FInt64Property>())  return FitsInteger<int64>(Number);
+        if (Property->IsA<FByteProperty>())   return FitsInteger<uint8>(Number);
+        if (Property->IsA<FUInt16Property>()) return FitsInteger<uint16>(Number);
+        if (Property->IsA<FUInt32Property>()) return FitsInteger<uint32>(Number);
+        if (Property->IsA<FUInt64Property>()) return FitsInteger<uint64>(Number);
+        return false;
+    }
+
+    // [n, n, ...] or [[n, n, n], [n, n, n], ...] from the DOM, packed the way the request parser would
+    bool ReadPackedArray(const FJsonValue& Value, FMCPPackedArray& OutArray)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+        if (!Value.TryGetArray(Items))
+        {
+            return false;
+        }
+
+        OutArray.Stride = 1;
+        bool bRows = false;
+        for (int32 Index = 0; Index < Items->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonValue>& Item = (*Items)[Index];
+            if (!Item.IsValid())
+            {
+                return false;
+            }
+            if (Item->Type == EJson::Number && !bRows)
+            {
+                OutArray.Values.Add(Item->AsNumber());
+                continue;
+            }
+
+            // Flat numbers and rows can't be mixed
+            const TArray<TSharedPtr<FJsonValue>>* Row = nullptr;
+            if ((Index > 0 && !bRows) || !Item->TryGetArray(Row) || Row->Num() == 0 || (bRows && Row->Num() != OutArray.Stride))
+            {
+                return false;
+            }
+            bRows = true;
+            OutArray.Stride = Row->Num();
+            for (const TSharedPtr<FJsonValue>& Number : *Row)
+            {
+                if (!Number.IsValid() || Number->Type != EJson::Number)
+                {
+                    return false;
+                }
+                OutArray.Values.Add(Number->AsNumber());
+            }
+        }
+        return true;
+    }
+}
+
+FMCPParamStructInfo::FMCPParamStructInfo(const UScriptStruct* InStruct)
+    : Struct(InStruct)
+{
+    check(Struct);
+
+    // Bool properties named by MCPPresentFlag are filled in by Decode, not sent by clients
+    TSet<const FProperty*> PresentFlags;
+    for (TFieldIterator<FProperty> It(Struct); It; ++It)
+    {
+        if (It->HasMetaData(TEXT("MCPPresentFlag")))
+        {
+            const FName FlagName(*It->GetMetaData(TEXT("MCPPresentFlag")));
+            if (FProperty* Flag = Struct->FindPropertyByName(FlagName))
+            {
+                PresentFlags.Add(Flag);
+            }
+        }
+    }
+
+    for (TFieldIterator<FProperty> It(Struct); It; ++It)
+    {
+        FProperty* Property = *It;
+        if (PresentFlags.Contains(Property))
+        {
+            continue;
+        }
+
+        EMCPParamType Type;
+        int32 Stride;
+        if (!GetParamType(Property, Type, Stride))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPParamStructInfo: %s.%s has an unsupported parameter type, skipping"),
+                   *Struct->GetName(), *Property->GetName());
+            continue;
+        }
+
+        FField Field;
+        Field.Name = Property->HasMetaData(TEXT("MCPName")) ? Property->GetMetaData(TEXT("MCPName")) : MakeParamName(Property);
+        Field.Property = Property;
+        Field.Type = Type;
+        Field.bRequired = Property->HasMetaData(TEXT("MCPRequired"));
+        Field.PresentFlag = nullptr;
+        Field.Stride = Stride;
+
+        if (Property->HasMetaData(TEXT("MCPPresentFlag")))
+        {
+            const FName FlagName(*Property->GetMetaData(TEXT("MCPPresentFlag")));
+            Field.PresentFlag = CastField<FBoolProperty>(Struct->FindPropertyByName(FlagName));
+            if (!Field.PresentFlag)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("MCPParamStructInfo: %s.%s names missing bool flag '%s'"),
+                       *Struct->GetName(), *Property->GetName(), *FlagName.ToString());
+            }
+        }
+
+        FString Description;
+#if WITH_METADATA
+        Description = Property->GetMetaData(TEXT("ToolTip"));
+#endif
+
+        Specs.Add({ Field.Name, Field.Type, Field.bRequired, Description });
+        FieldIndices.Add(Field.Name, Fields.Num());
+        Fields.Add(MoveTemp(Field));
+    }
+}
+
+TSharedPtr<FStructOnScope> FMCPParamStructInfo::Decode(const FJsonObject& Params, const FMCPBulkParams* Bulk, FString& OutError) const
+{
+    TSharedPtr<FStructOnScope> Result = MakeShared<FStructOnScope>(Struct);
+    uint8* StructData = Result->GetStructMemory();
+
+    TBitArray<> Seen(false, Fields.Num());
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Member : Params.Values)
+    {
+        const int32* Index = FieldIndices.Find(Member.Key);
+        if (!Index)
+        {
+            OutError = MakeUnknownFieldError(Member.Key);
+            return nullptr;
+        }
+
+        // An explicit null is the same as leaving the parameter out
+        if (!Member.Value.IsValid() || Member.Value->IsNull())
+        {
+            continue;
+        }
+
+        const FField& Field = Fields[*Index];
+        if (!DecodeField(Field, Member.Value, StructData, OutError))
+        {
+            return nullptr;
+        }
+
+        Seen[*Index] = true;
+        if (Field.PresentFlag)
+        {
+            Field.PresentFlag->SetPropertyValue_InContainer(StructData, true);
+        }
+    }
+
+    // Fields the request parser packed never reached the DOM
+    if (Bulk)
+    {
+        for (const TPair<FString, FMCPPackedArray>& Packed : Bulk->Fields)
+        {
+            const int32* Index = FieldIndices.Find(Packed.Key);
+            if (!Index)
+            {
+                OutError = MakeUnknownFieldError(Packed.Key);
+                return nullptr;
+            }
+
+            const FField& Field = Fields[*Index];
+            if (!DecodePackedField(Field, Packed.Value, StructData, OutError))
+            {
+                return nullptr;
+            }
+
+            Seen[*Index] = true;
+            if (Field.PresentFlag)
+            {
+                Field.PresentFlag->SetPropertyValue_InContainer(StructData, true);
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < Fields.Num(); ++Index)
+    {
+        if (Fields[Index].bRequired && !Seen[Index])
+        {
+            OutError = FString::Printf(TEXT("Missing '%s' parameter"), *Fields[Index].Name);
+            return nullptr;
+        }
+    }
+
+    return Result;
+}
+
+bool FMCPParamStructInfo::DecodeField(const FField& Field, const TSharedPtr<FJsonValue>& Value, void* StructData, FString& OutError) const
+{
+    void* ValuePtr = Field.Property->ContainerPtrToValuePtr<void>(StructData);
+
+    switch (Field.Type)
+    {
+    case EMCPParamType::Boolean:
+    {
+        bool bValue = false;
+        if (!Value->TryGetBool(bValue))
+        {
+            OutError = FString::Printf(TEXT("'%s' must be a boolean"), *Field.Name);
+            return false;
+        }
+        CastFieldChecked<FBoolProperty>(Field.Property)->SetPropertyValue(ValuePtr, bValue);
+        return true;
+    }
+    case EMCPParamType::Integer:
+    case EMCPParamType::Number:
+    {
+        double Number = 0.0;
+        if (Value->Type != EJson::Number || !Value->TryGetNumber(Number))
+        {
+            OutError = FString::Printf(TEXT("'%s' must be a number"), *Field.Name);
+            return false;
+        }
+
+        const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Field.Property);
+        if (Field.Type == EMCPParamType::Number)
+        {
+            NumericProperty->SetFloatingPointPropertyValue(ValuePtr, Number);
+            return true;
+        }
+        if (FMath::FloorToDouble(Number) != Number)
+        {
+            OutError = FString::Printf(TEXT("'%s' must be an integer"), *Field.Name);
+            return false;
+        }
+        if (!IsInIntegerRange(NumericProperty, Number))
+        {
+            OutError = FString::Printf(TEXT("'%s' is out of range: %.0f"), *Field.Name, Number);
+            return false;
+        }
+        if (Number >= 0.0)
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<uint64>(Number));
+        }
+        else
+        {
+            NumericProperty->SetIntPropertyValue(ValuePtr, static_cast<int64>(Number));
+        }
+        return true;
+    }
+    case EMCPParamType::Vector:
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+        double Components[3];
+        bool bValid = Value->TryGetArray(Items) && Items->Num() == 3;
+        for (int32 Index = 0; bValid && Index < 3; ++Index)
+        {
+            bValid = (*Items)[Index].IsValid() && (*Items)[Index]->Type == EJson::Number && (*Items)[Index]->TryGetNumber(Components[Index]);
+        }
+        if (!bValid)
+        {
+            OutError = FString::Printf(TEXT("'%s' must be an array of 3 numbers"), *Field.Name);
+            return false;
+        }
+
+        if (CastFieldChecked<FStructProperty>(Field.Property)->Struct == TBaseStructure<FRotator>::Get())
+        {
+            *static_cast<FRotator*>(ValuePtr) = FRotator(Components[0], Components[1], Components[2]);
+        }
+        else
+        {
+            *static_cast<FVector*>(ValuePtr) = FVector(Components[0], Components[1], Components[2]);
+        }
+        return true;
+    }
+    case EMCPParamType::String:
+        if (Value->Type != EJson::String)
+        {
+            OutError = FString::Printf(TEXT("'%s' must be a string"), *Field.Name);
+            return false;
+        }
+        if (Field.Property->IsA<FStrProperty>())
+        {
+            *static_cast<FString*>(ValuePtr) = Value->AsString();
+            return true;
+        }
+        if (Field.Property->IsA<FNameProperty>())
+        {
+            *static_cast<FName*>(ValuePtr) = FName(*Value->AsString());
+            return true;
+        }
+        break;
+    case EMCPParamType::Array:
+    {
+        // Lists of free-form objects (shapes, instances, ...) are kept as is for the handler
+        const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Field.Property);
+        const FStructProperty* StructInner = ArrayProperty ? CastField<FStructProperty>(ArrayProperty->Inner) : nullptr;
+        if (StructInner && StructInner->Struct == FJsonObjectWrapper::StaticStruct())
+        {
+            const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+            if (!Value->TryGetArray(Items))
+            {
+                OutError = FString::Printf(TEXT("'%s' must be an array of objects"), *Field.Name);
+                return false;
+            }
+
+            TArray<FJsonObjectWrapper>& Objects = *static_cast<TArray<FJsonObjectWrapper>*>(ValuePtr);
+            Objects.SetNum(Items->Num());
+            for (int32 Index = 0; Index < Items->Num(); ++Index)
+            {
+                const TSharedPtr<FJsonValue>& Item = (*Items)[Index];
+                if (!Item.IsValid() || Item->Type != EJson::Object)
+                {
+                    OutError = FString::Printf(TEXT("%s[%d] must be an object"), *Field.Name, Index);
+                    return false;
+                }
+                Objects[Index].JsonObject = Item->AsObject();
+            }
+            return true;
+        }
+        break;
+    }
+    case EMCPParamType::NumberArray:
+    {
+        FMCPPackedArray Packed;
+        if (!ReadPackedArray(*Value, Packed))
+        {
+            OutError = FString::Printf(TEXT("'%s' must be an array of numbers or an array of equal-length number arrays"), *Field.Name);
+            return false;
+        }
+        return DecodePackedField(Field, Packed, StructData, OutError);
+    }
+    case EMCPParamType::Object:
+    {
+        // Free-form JSON is kept as is for the handler
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Field.Property);
+        if (StructProperty && StructProperty->Struct == FJsonObjectWrapper::StaticStruct())
+        {
+            if (Value->Type != EJson::Object)
+            {
+                OutError = FString::Printf(TEXT("'%s' must be an object"), *Field.Name);
+                return false;
+            }
+            static_cast<FJsonObjectWrapper*>(ValuePtr)->JsonObject = Value->AsObject();
+            return true;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    // Enums, soft references, nested structs and containers; none hold hard object references, see IsPlainData
+    if (!FJsonObjectConverter::JsonValueToUProperty(Value, Field.Property, ValuePtr, 0, 0))
+    {
+        OutError = FString::Printf(TEXT("Invalid value for '%s'"), *Field.Name);
+        return false;
+    }
+    return true;
+}
+
+bool FMCPParamStructInfo::DecodePackedField(const FField& Field, const FMCPPackedArray& Packed, void* StructData, FString& OutError) const
+{
+    if (Field.Type != EMCPParamType::NumberArray)
+    {
+        OutError = FString::Printf(TEXT("Invalid value for '%s'"), *Field.Name);
+        return false;
+    }
+
+    // A flat list is read as consecutive rows when its length allows it
+    int32 Stride = Packed.Stride;
+    if (Field.Stride > 0 && Stride == 1 && Packed.Values.Num() % Field.Stride == 0)
+    {
+        Stride = Field.Stride;
+    }
+
+    const bool bTransforms = Field.Stride == 0;
+    if (bTransforms ? (Stride != 3 && Stride != 6 && Stride != 9) : Stride != Field.Stride)
+    {
+        OutError = bTransforms
+            ? FString::Printf(TEXT("Rows of '%s' must have 3, 6 or 9 numbers (location, rotation, scale)"), *Field.Name)
+            : FString::Printf(TEXT("'%s' must be rows of %d numbers"), *Field.Name, Field.Stride);
+        return false;
+    }
+
+    const FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Field.Property);
+    void* ValuePtr = ArrayProperty->ContainerPtrToValuePtr<void>(StructData);
+    const int32 NumRows = Packed.Values.Num() / Stride;
+    const double* Values = Packed.Values.GetData();
+
+    if (bTransforms)
+    {
+        TArray<FTransform>& Transforms = *static_cast<TArray<FTransform>*>(ValuePtr);
+        Transforms.SetNum(NumRows);
+        for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+        {
+            const double* Row = Values + RowIndex * Stride;
+            const FRotator Rotation = Stride >= 6 ? FRotator(Row[3], Row[4], Row[5]) : FRotator::ZeroRotator;
+            const FVector Scale = Stride == 9 ? FVector(Row[6], Row[7], Row[8]) : FVector::OneVector;
+            Transforms[RowIndex] = FTransform(Rotation, FVector(Row[0], Row[1], Row[2]), Scale);
+        }
+    }
+    else if (ArrayProperty->Inner->IsA<FStructProperty>())
+    {
+        TArray<FVector>& Vectors = *static_cast<TArray<FVector>*>(ValuePtr);
+        Vectors.SetNum(NumRows);
+        for (int32 RowIndex = 0; RowIndex < NumRows; ++RowIndex)
+        {
+            Vectors[RowIndex] = FVector(Values[RowIndex * 3], Values[RowIndex * 3 + 1], Values[RowIndex * 3 + 2]);
+        }
+    }
+    else if (ArrayProperty->Inner->IsA<FDoubleProperty>())
+    {
+        *static_cast<TArray<double>*>(ValuePtr) = Packed.Values;
+    }
+    else
+    {
+        TArray<float>& Floats = *static_cast<TArray<float>*>(ValuePtr);
+        Floats.SetNumUninitialized(Packed.Values.Num());
+        for (int32 Index = 0; Index < Packed.Values.Num(); ++Index)
+        {
+            Floats[Index] = static_cast<float>(Values[Index]);
+        }
+    }
+    return true;
+}
+
+FString FMCPParamStructInfo::MakeUnknownFieldError(const FString& Name) const
+{
+    // Suggest the closest known name for likely typos
+    const FString LowerName = Name.ToLower();
+    const FString* Closest = nullptr;
+    int32 ClosestDistance = FMath::Max(2, Name.Len() / 3) + 1;
+    for (const FField& Field : Fields)
+    {
+        const int32 Distance = Algo::LevenshteinDistance(LowerName, Field.Name);
+        if (Distance < ClosestDistance)
+        {
+            Closest = &Field.Name;
+            ClosestDistance = Distance;
+        }
+    }
+
+    if (Closest)
+    {
+        return FString::Printf(TEXT("Unknown parameter '%s' (did you mean '%s'?)"), *Name, **Closest);
+    }
+    return FString::Printf(TEXT("Unknown parameter '%s'"), *Name);
+}
@@ -0,0 +1,483 @@
+#include "MCPPayloadWriter.h"
+
+TUniquePtr<FMCPPayloadWriter> FMCPPayloadWriter::Create(EMCPEncoding Encoding)
+{
+    switch (Encoding)
+    {
+    case EMCPEncoding::MessagePack:
+        return MakeUnique<FMCPMessagePackWriter>();
+    case EMCPEncoding::Json:
+    default:
+        return MakeUnique<FMCPJsonPayloadWriter>();
+    }
+}
+
+bool FMCPPayloadWriter::ParseEncoding(const FString& Name, EMCPEncoding& OutEncoding)
+{
+    if (Name.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+    {
+        OutEncoding = EMCPEncoding::Json;
+        return true;
+    }
+    if (Name.Equals(TEXT("msgpack"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("messagepack"), ESearchCase::IgnoreCase))
+    {
+        OutEncoding = EMCPEncoding::MessagePack;
+        return true;
+    }
+    return false;
+}
+
+const TCHAR* FMCPPayloadWriter::GetEncodingName(EMCPEncoding Encoding)
+{
+    return Encoding == EMCPEncoding::MessagePack ? TEXT("msgpack") : TEXT("json");
+}
+
+void FMCPPayloadWriter::WriteName(FName Value)
+{
+    TCHAR Buffer[NAME_SIZE];
+    const uint32 Len = Value.ToString(Buffer, UE_ARRAY_COUNT(Buffer));
+    WriteString(FStringView(Buffer, Len));
+}
+
+void FMCPPayloadWriter::WriteVector(double X, double Y, double Z)
+{
+    BeginArray(3);
+    WriteNumber(X);
+    WriteNumber(Y);
+    WriteNumber(Z);
+    EndArray();
+}
+
+void FMCPPayloadWriter::WriteJsonValue(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+        WriteString(Value->AsString());
+        break;
+    case EJson::Number:
+        WriteNumber(Value->AsNumber());
+        break;
+    case EJson::Boolean:
+        WriteBool(Value->AsBool());
+        break;
+    case EJson::Array:
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Items = Value->AsArray();
+            BeginArray(Items.Num());
+            for (const TSharedPtr<FJsonValue>& Item : Items)
+            {
+                WriteJsonValue(Item);
+            }
+            EndArray();
+        }
+        break;
+    case EJson::Object:
+        WriteJsonObject(Value->AsObject());
+        break;
+    case EJson::None:
+    case EJson::Null:
+    default:
+        WriteNull();
+        break;
+    }
+}
+
+void FMCPPayloadWriter::WriteJsonObject(const TSharedPtr<FJsonObject>& Object)
+{
+    if (!Object.IsValid())
+    {
+        WriteNull();
+        return;
+    }
+
+    BeginObject(Object->Values.Num());
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+    {
+        WriteKey(Field.Key);
+        WriteJsonValue(Field.Value);
+    }
+    EndObject();
+}
+
+// JSON
+
+FMCPJsonPayloadWriter::FMCPJsonPayloadWriter()
+    : bAfterKey(false)
+{
+}
+
+void FMCPJsonPayloadWriter::BeginValue()
+{
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+
+    if (NeedsSeparator.Num() > 0)
+    {
+        if (NeedsSeparator.Last())
+        {
+            Bytes.Add(',');
+        }
+        NeedsSeparator.Last() = true;
+    }
+}
+
+void FMCPJsonPayloadWriter::AppendAscii(const ANSICHAR* Text, int32 Len)
+{
+    Bytes.Append(reinterpret_cast<const uint8*>(Text), Len);
+}
+
+void FMCPJsonPayloadWriter::AppendQuoted(FStringView Text)
+{
+    FTCHARToUTF8 Converted(Text.GetData(), Text.Len());
+    const uint8* Data = reinterpret_cast<const uint8*>(Converted.Get());
+    const int32 Len = Converted.Length();
+
+    Bytes.Reserve(Bytes.Num() + Len + 2);
+    Bytes.Add('"');
+    for (int32 Index = 0; Index < Len; ++Index)
+    {
+        const uint8 Char = Data[Index];
+        switch (Char)
+        {
+        case '"':  AppendAscii("\\\"", 2); break;
+        case '\\': AppendAscii("\\\\", 2); break;
+        case '\n': AppendAscii("\\n", 2); break;
+        case '\r': AppendAscii("\\r", 2); break;
+        case '\t': AppendAscii("\\t", 2); break;
+        default:
+            if (Char < 0x20)
+            {
+                ANSICHAR Escaped[8];
+                const int32 EscapedLen = FCStringAnsi::Snprintf(Escaped, UE_ARRAY_COUNT(Escaped), "\\u%04x", Char);
+                AppendAscii(Escaped, EscapedLen);
+            }
+            else
+            {
+                Bytes.Add(Char);
+            }
+            break;
+        }
+    }
+    Bytes.Add('"');
+}
+
+void FMCPJsonPayloadWriter::BeginObject(int32 NumFields)
+{
+    BeginValue();
+    Bytes.Add('{');
+    NeedsSeparator.Push(false);
+}
+
+void FMCPJsonPayloadWriter::EndObject()
+{
+    NeedsSeparator.Pop(EAllowShrinking::No);
+    Bytes.Add('}');
+}
+
+void FMCPJsonPayloadWriter::BeginArray(int32 NumItems)
+{
+    BeginValue();
+    Bytes.Add('[');
+    NeedsSeparator.Push(false);
+}
+
+void FMCPJsonPayloadWriter::EndArray()
+{
+    NeedsSeparator.Pop(EAllowShrinking::No);
+    Bytes.Add(']');
+}
+
+void FMCPJsonPayloadWriter::WriteKey(FStringView Key)
+{
+    if (NeedsSeparator.Num() > 0)
+    {
+        if (NeedsSeparator.Last())
+        {
+            Bytes.Add(',');
+        }
+        NeedsSeparator.Last() = true;
+    }
+
+    AppendQuoted(Key);
+    Bytes.Add(':');
+    bAfterKey = true;
+}
+
+void FMCPJsonPayloadWriter::WriteString(FStringView Value)
+{
+    BeginValue();
+    AppendQuoted(Value);
+}
+
+void FMCPJsonPayloadWriter::WriteNumber(double Value)
+{
+    BeginValue();
+
+    if (!FMath::IsFinite(Value))
+    {
+        AppendAscii("null", 4);
+        return;
+    }
+
+    ANSICHAR Buffer[32];
+    int32 Len;
+    if (Value == FMath::TruncToDouble(Value) && FMath::Abs(Value) < 1e15)
+    {
+        Len = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%lld", static_cast<long long>(Value));
+    }
+    else
+    {
+        Len = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%.15g", Value);
+    }
+    AppendAscii(Buffer, Len);
+}
+
+void FMCPJsonPayloadWriter::WriteInteger(int64 Value)
+{
+    BeginValue();
+
+    ANSICHAR Buffer[32];
+    const int32 Len = FCStringAnsi::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), "%lld", static_cast<long long>(Value));
+    AppendAscii(Buffer, Len);
+}
+
+void FMCPJsonPayloadWriter::WriteBool(bool bValue)
+{
+    BeginValue();
+    if (bValue)
+    {
+        AppendAscii("true", 4);
+    }
+    else
+    {
+        AppendAscii("false", 5);
+    }
+}
+
+void FMCPJsonPayloadWriter::WriteNull()
+{
+    BeginValue();
+    AppendAscii("null", 4);
+}
+
+TUniquePtr<FMCPPayloadWriter> FMCPJsonPayloadWriter::MakeFragmentWriter() const
+{
+    // Starts as if inside an array so consecutive items are comma separated
+    TUniquePtr<FMCPJsonPayloadWriter> Fragment = MakeUnique<FMCPJsonPayloadWriter>();
+    Fragment->NeedsSeparator.Push(false);
+    return Fragment;
+}
+
+void FMCPJsonPayloadWriter::AppendFragment(const FMCPPayloadWriter& Fragment)
+{
+    if (Fragment.GetBytes().Num() == 0)
+    {
+        return;
+    }
+
+    if (NeedsSeparator.Num() > 0)
+    {
+        if (NeedsSeparator.Last())
+        {
+            Bytes.Add(',');
+        }
+        NeedsSeparator.Last() = true;
+    }
+    Bytes.Append(Fragment.GetBytes());
+}
+
+FString FMCPJsonPayloadWriter::ToString() const
+{
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+// MessagePack
+
+void FMCPMessagePackWriter::WriteByte(uint8 Value)
+{
+    Bytes.Add(Value);
+}
+
+void FMCPMessagePackWriter::WriteBigEndian(uint64 Value, int32 NumBytes)
+{
+    for (int32 Shift = (NumBytes - 1) * 8; Shift >= 0; Shift -= 8)
+    {
+        Bytes.Add(static_cast<uint8>((Value >> Shift) & 0xFF));
+    }
+}
+
+void FMCPMessagePackWriter::WriteContainerHeader(int32 Num, uint8 FixBase, int32 FixMax, uint8 Header16, uint8 Header32)
+{
+    if (Num <= FixMax)
+    {
+        WriteByte(FixBase | static_cast<uint8>(Num));
+    }
+    else if (Num <= 0xFFFF)
+    {
+        WriteByte(Header16);
+        WriteBigEndian(Num, 2);
+    }
+    else
+    {
+        WriteByte(Header32);
+        WriteBigEndian(Num, 4);
+    }
+}
+
+void FMCPMessagePackWriter::BeginObject(int32 NumFields)
+{
+    WriteContainerHeader(NumFields, 0x80, 15, 0xde, 0xdf);
+}
+
+void FMCPMessagePackWriter::BeginArray(int32 NumItems)
+{
+    WriteContainerHeader(NumItems, 0x90, 15, 0xdc, 0xdd);
+}
+
+void FMCPMessagePackWriter::WriteKey(FStringView Key)
+{
+    WriteString(Key);
+}
+
+void FMCPMessagePackWriter::WriteString(FStringView Value)
+{
+    FTCHARToUTF8 Converted(Value.GetData(), Value.Len());
+    const int32 Len = Converted.Length();
+
+    if (Len <= 31)
+    {
+        WriteByte(0xa0 | static_cast<uint8>(Len));
+    }
+    else if (Len <= 0xFF)
+    {
+        WriteByte(0xd9);
+        WriteBigEndian(Len, 1);
+    }
+    else if (Len <= 0xFFFF)
+    {
+        WriteByte(0xda);
+        WriteBigEndian(Len, 2);
+    }
+    else
+    {
+        WriteByte(0xdb);
+        WriteBigEndian(Len, 4);
+    }
+    Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Len);
+}
+
+void FMCPMessagePackWriter::WriteNumber(double Value)
+{
+    // Whole numbers (counts, indices, most grid-aligned coordinates) as integers
+    if (FMath::IsFinite(Value) && Value == FMath::TruncToDouble(Value) && FMath::Abs(Value) < 9007199254740992.0)
+    {
+        WriteInteger(static_cast<int64>(Value));
+        return;
+    }
+
+    const float AsFloat = static_cast<float>(Value);
+    if (static_cast<double>(AsFloat) == Value || !FMath::IsFinite(Value))
+    {
+        uint32 Bits;
+        FMemory::Memcpy(&Bits, &AsFloat, sizeof(Bits));
+        WriteByte(0xca);
+        WriteBigEndian(Bits, 4);
+    }
+    else
+    {
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        WriteByte(0xcb);
+        WriteBigEndian(Bits, 8);
+    }
+}
+
+void FMCPMessagePackWriter::WriteInteger(int64 Value)
+{
+    if (Value >= 0)
+    {
+        if (Value <= 0x7F)
+        {
+            WriteByte(static_cast<uint8>(Value));
+        }
+        else if (Value <= 0xFF)
+        {
+            WriteByte(0xcc);
+            WriteBigEndian(Value, 1);
+        }
+        else if (Value <= 0xFFFF)
+        {
+            WriteByte(0xcd);
+            WriteBigEndian(Value, 2);
+        }
+        else if (Value <= 0xFFFFFFFFll)
+        {
+            WriteByte(0xce);
+            WriteBigEndian(Value, 4);
+        }
+        else
+        {
+            WriteByte(0xcf);
+            WriteBigEndian(Value, 8);
+        }
+    }
+    else
+    {
+        if (Value >= -32)
+        {
+            WriteByte(static_cast<uint8>(static_cast<int8>(Value)));
+        }
+        else if (Value >= MIN_int8)
+        {
+            WriteByte(0xd0);
+            WriteBigEndian(static_cast<uint64>(Value), 1);
+        }
+        else if (Value >= MIN_int16)
+        {
+            WriteByte(0xd1);
+            WriteBigEndian(static_cast<uint64>(Value), 2);
+        }
+        else if (Value >= MIN_int32)
+        {
+            WriteByte(0xd2);
+            WriteBigEndian(static_cast<uint64>(Value), 4);
+        }
+        else
+        {
+            WriteByte(0xd3);
+            WriteBigEndian(static_cast<uint64>(Value), 8);
+        }
+    }
+}
+
+void FMCPMessagePackWriter::WriteBool(bool bValue)
+{
+    WriteByte(bValue ? 0xc3 : 0xc2);
+}
+
+void FMCPMessagePackWriter::WriteNull()
+{
+    WriteByte(0xc0);
+}
+
+TUniquePtr<FMCPPayloadWriter> FMCPMessagePackWriter::MakeFragmentWriter() const
+{
+    return MakeUnique<FMCPMessagePackWriter>();
+}
+
+void FMCPMessagePackWriter::AppendFragment(const FMCPPayloadWriter& Fragment)
+{
+    // Item counts are part of the enclosing array header, so fragments are plain concatenation
+    Bytes.Append(Fragment.GetBytes());
+}
@@ -0,0 +1,592 @@
+#include "MCPProceduralMesh.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "DynamicMesh/MeshTransforms.h"
+#include "Algo/Reverse.h"
+#include "DynamicMeshEditor.h"
+#include "Operations/MeshBoolean.h"
+#include "DynamicMeshToMeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "EditorAssetLibrary.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/Package.h"
+#include "Misc/PackageName.h"
+
+using namespace UE::Geometry;
+
+// Centimetres per UV tile for the box-projected UVs
+#define MCP_MESH_UV_SCALE 100.0
+
+namespace
+{
+    /**
+     * Appends closed solids to a dynamic mesh. Faces share vertices so every solid stays
+     * watertight for the booleans, while normals and UVs are split per face.
+     */
+    class FSolidBuilder
+    {
+    public:
+        explicit FSolidBuilder(FDynamicMesh3& InMesh)
+            : Mesh(InMesh)
+        {
+            Mesh.EnableAttributes();
+            Normals = Mesh.Attributes()->PrimaryNormals();
+            UVs = Mesh.Attributes()->PrimaryUV();
+        }
+
+        int32 Vertex(const FVector3d& Position)
+        {
+            return Mesh.AppendVertex(Position);
+        }
+
+        FVector3d GetPosition(int32 VertexId) const
+        {
+            return Mesh.GetVertex(VertexId);
+        }
+
+        /**
+         * Add a planar, star-shaped polygon, fanned from its first corner. The winding is
+         * flipped if needed so the face points along Outward.
+         * @param CornerNormals - Optional smooth normals, one per corner; the face normal otherwise
+         */
+        void AddFace(TArray<int32> Corners, const FVector3d& Outward, TArray<FVector3d> CornerNormals = TArray<FVector3d>())
+        {
+            const int32 Count = Corners.Num();
+            FVector3d Normal = FVector3d::ZeroVector;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const FVector3d A = Mesh.GetVertex(Corners[Index]);
+                const FVector3d B = Mesh.GetVertex(Corners[(Index + 1) % Count]);
+                Normal += FVector3d((A.Y - B.Y) * (A.Z + B.Z), (A.Z - B.Z) * (A.X + B.X), (A.X - B.X) * (A.Y + B.Y));
+            }
+            if (Normal.Dot(Outward) < 0.0)
+            {
+                // Reverse all but the fan root so the root stays first
+                Algo::Reverse(Corners.GetData() + 1, Count - 1);
+                if (CornerNormals.Num() == Count)
+                {
+                    Algo::Reverse(CornerNormals.GetData() + 1, Count - 1);
+                }
+                Normal = -Normal;
+            }
+            Normal = Normal.GetSafeNormal();
+
+            // Project the UVs along the face's dominant axis
+            const FVector3d Abs = Normal.GetAbs();
+            const int32 U = Abs.X >= Abs.Y && Abs.X >= Abs.Z ? 1 : 0;
+            const int32 V = Abs.Z >= Abs.X && Abs.Z >= Abs.Y ? 1 : 2;
+
+            TArray<int32, TInlineAllocator<8>> NormalElements;
+            TArray<int32, TInlineAllocator<8>> UVElements;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const FVector3d Position = Mesh.GetVertex(Corners[Index]);
+                const FVector3d& CornerNormal = CornerNormals.Num() == Count ? CornerNormals[Index] : Normal;
+                NormalElements.Add(Normals->AppendElement(FVector3f(CornerNormal)));
+                UVElements.Add(UVs->AppendElement(FVector2f(float(Position[U] / MCP_MESH_UV_SCALE), float(-Position[V] / MCP_MESH_UV_SCALE))));
+            }
+
+            for (int32 Index = 1; Index + 1 < Count; ++Index)
+            {
+                const int32 Triangle = Mesh.AppendTriangle(Corners[0], Corners[Index], Corners[Index + 1]);
+                if (Triangle < 0)
+                {
+                    ++NumRejected;
+                    continue;
+                }
+                Normals->SetTriangle(Triangle, FIndex3i(NormalElements[0], NormalElements[Index], NormalElements[Index + 1]));
+                UVs->SetTriangle(Triangle, FIndex3i(UVElements[0], UVElements[Index], UVElements[Index + 1]));
+            }
+        }
+
+        // Axis-aligned box from Min to Max
+        void AddBox(const FVector3d& Min, const FVector3d& Max)
+        {
+            // Bit 0 picks X, bit 1 Y and bit 2 Z from Max
+            int32 Corners[8];
+            for (int32 Index = 0; Index < 8; ++Index)
+            {
+                Corners[Index] = Vertex(FVector3d(Index & 1 ? Max.X : Min.X, Index & 2 ? Max.Y : Min.Y, Index & 4 ? Max.Z : Min.Z));
+            }
+            AddFace({ Corners[0], Corners[2], Corners[6], Corners[4] }, FVector3d(-1, 0, 0));
+            AddFace({ Corners[1], Corners[3], Corners[7], Corners[5] }, FVector3d(1, 0, 0));
+            AddFace({ Corners[0], Corners[1], Corners[5], Corners[4] }, FVector3d(0, -1, 0));
+            AddFace({ Corners[2], Corners[3], Corners[7], Corners[6] }, FVector3d(0, 1, 0));
+            AddFace({ Corners[0], Corners[1], Corners[3], Corners[2] }, FVector3d(0, 0, -1));
+            AddFace({ Corners[4], Corners[5], Corners[7], Corners[6] }, FVector3d(0, 0, 1));
+        }
+
+        // Extrude a simple polygon in the XZ plane, star-shaped from its first point, across Y
+        void AddExtrudedProfile(const TArray<FVector2d>& Profile, double MinY, double MaxY)
+        {
+            const int32 Count = Profile.Num();
+            double TwiceArea = 0.0;
+            TArray<int32> Front;
+            TArray<int32> Back;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const FVector2d& A = Profile[Index];
+                const FVector2d& B = Profile[(Index + 1) % Count];
+                TwiceArea += A.X * B.Y - B.X * A.Y;
+                Front.Add(Vertex(FVector3d(A.X, MinY, A.Y)));
+                Back.Add(Vertex(FVector3d(A.X, MaxY, A.Y)));
+            }
+            AddFace(Front, FVector3d(0, -1, 0));
+            AddFace(Back, FVector3d(0, 1, 0));
+
+            // Counter-clockwise profiles have their outside on the right of each edge
+            const double Side = TwiceArea >= 0.0 ? 1.0 : -1.0;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                const int32 Next = (Index + 1) % Count;
+                const FVector2d Edge = Profile[Next] - Profile[Index];
+                AddFace({ Front[Index], Front[Next], Back[Next], Back[Index] }, FVector3d(Edge.Y, 0, -Edge.X) * Side);
+            }
+        }
+
+        int32 GetNumRejected() const
+        {
+            return NumRejected;
+        }
+
+    private:
+        FDynamicMesh3& Mesh;
+        FDynamicMeshNormalOverlay* Normals = nullptr;
+        FDynamicMeshUVOverlay* UVs = nullptr;
+        int32 NumRejected = 0;
+    };
+
+    double GetNumber(const TSharedPtr<FJsonObject>& Shape, const TCHAR* Field, double Default)
+    {
+        double Value = Default;
+        Shape->TryGetNumberField(Field, Value);
+        return Value;
+    }
+
+    FVector3d GetVector(const TSharedPtr<FJsonObject>& Shape, const TCHAR* Field, const FVector3d& Default)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (!Shape->TryGetArrayField(Field, Values) || Values->Num() < 2)
+        {
+            return Default;
+        }
+        return FVector3d((*Values)[0]->AsNumber(), (*Values)[1]->AsNumber(), Values->Num() > 2 ? (*Values)[2]->AsNumber() : Default.Z);
+    }
+
+    bool RequirePositive(const TCHAR* Type, const TCHAR* Field, double Value, FString& OutError)
+    {
+        if (Value > 0.0)
+        {
+            return true;
+        }
+        OutError = FString::Printf(TEXT("%s: %s must be positive"), Type, Field);
+        return false;
+    }
+
+    bool BuildBox(const TSharedPtr<FJsonObject>& Shape, FSolidBuilder& Builder, FString& OutError)
+    {
+        const FVector3d Size = GetVector(Shape, TEXT("size"), FVector3d(100.0));
+        if (!RequirePositive(TEXT("box"), TEXT("size"), Size.GetMin(), OutError))
+        {
+            return false;
+        }
+        Builder.AddBox(FVector3d(-Size.X / 2, -Size.Y / 2, 0.0), FVector3d(Size.X / 2, Size.Y / 2, Size.Z));
+        return true;
+    }
+
+    bool BuildCylinder(const TSharedPtr<FJsonObject>& Shape, FSolidBuilder& Builder, FString& OutError)
+    {
+        const double Radius = GetNumber(Shape, TEXT("radius"), 50.0);
+        const double Height = GetNumber(Shape, TEXT("height"), 100.0);
+        const int32 Segments = FMath::Clamp(FMath::RoundToInt32(GetNumber(Shape, TEXT("segments"), 24.0)), 3, 256);
+        if (!RequirePositive(TEXT("cylinder"), TEXT("radius"), Radius, OutError)
+            || !RequirePositive(TEXT("cylinder"), TEXT("height"), Height, OutError))
+        {
+            return false;
+        }
+
+        TArray<int32> Bottom;
+        TArray<int32> Top;
+        TArray<FVector3d> Radials;
+        for (int32 Index = 0; Index < Segments; ++Index)
+        {
+            const double Angle = 2.0 * UE_DOUBLE_PI * Index / Segments;
+            const FVector3d Radial(FMath::Cos(Angle), FMath::Sin(Angle), 0.0);
+            Radials.Add(Radial);
+            Bottom.Add(Builder.Vertex(Radial * Radius));
+            Top.Add(Builder.Vertex(Radial * Radius + FVector3d(0, 0, Height)));
+        }
+        Builder.AddFace(Bottom, FVector3d(0, 0, -1));
+        Builder.AddFace(Top, FVector3d(0, 0, 1));
+        for (int32 Index = 0; Index < Segments; ++Index)
+        {
+            const int32 Next = (Index + 1) % Segments;
+            Builder.AddFace({ Bottom[Index], Bottom[Next], Top[Next], Top[Index] }, Radials[Index] + Radials[Next],
+                { Radials[Index], Radials[Next], Radials[Next], Radials[Index] });
+        }
+        return true;
+    }
+
+    bool BuildPyramid(const TSharedPtr<FJsonObject>& Shape, FSolidBuilder& Builder, FString& OutError)
+    {
+        const FVector3d Size = GetVector(Shape, TEXT("size"), FVector3d(300.0, 300.0, 200.0));
+        const int32 Steps = FMath::Clamp(FMath::RoundToInt32(GetNumber(Shape, TEXT("steps"), 0.0)), 0, 1000);
+        if (!RequirePositive(TEXT("pyramid"), TEXT("size"), Size.GetMin(), OutError))
+        {
+            return false;
+        }
+
+        if (Steps > 0)
+        {
+            // Stacked tiers, each a closed box resting on the one below
+            const double TierHeight = Size.Z / Steps;
+            for (int32 Tier = 0; Tier < Steps; ++Tier)
+            {
+                const double Shrink = 1.0 - double(Tier) / Steps;
+                const FVector3d Half(Size.X * Shrink / 2, Size.Y * Shrink / 2, 0.0);
+                Builder.AddBox(FVector3d(-Half.X, -Half.Y, Tier * TierHeight), FVector3d(Half.X, Half.Y, (Tier + 1) * TierHeight));
+            }
+            return true;
+        }
+
+        const int32 Base[4] = {
+            Builder.Vertex(FVector3d(-Size.X / 2, -Size.Y / 2, 0.0)),
+            Builder.Vertex(FVector3d(Size.X / 2, -Size.Y / 2, 0.0)),
+            Builder.Vertex(FVector3d(Size.X / 2, Size.Y / 2, 0.0)),
+            Builder.Vertex(FVector3d(-Size.X / 2, Size.Y / 2, 0.0))
+        };
+        const FVector3d ApexPosition(0.0, 0.0, Size.Z);
+        const int32 Apex = Builder.Vertex(ApexPosition);
+        Builder.AddFace({ Base[0], Base[1], Base[2], Base[3] }, FVector3d(0, 0, -1));
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            const int32 Next = (Index + 1) % 4;
+            // Outward from the solid's centroid through the face's centroid
+            const FVector3d FaceCenter = (ApexPosition + Builder.GetPosition(Base[Index]) + Builder.GetPosition(Base[Next])) / 3.0;
+            Builder.AddFace({ Apex, Base[Index], Base[Next] }, FaceCenter - FVector3d(0.0, 0.0, Size.Z / 4));
+        }
+        return true;
+    }
+
+    bool BuildStairs(const TSharedPtr<FJsonObject>& Shape, FSolidBuilder& Builder, FString& OutError)
+    {
+        const int32 Steps = FMath::Clamp(FMath::RoundToInt32(GetNumber(Shape, TEXT("steps"), 8.0)), 1, 1000);
+        const double Width = GetNumber(Shape, TEXT("step_width"), 150.0);
+        const double StepHeight = GetNumber(Shape, TEXT("step_height"), 20.0);
+        const double StepDepth = GetNumber(Shape, TEXT("step_depth"), 30.0);
+        if (!RequirePositive(TEXT("stairs"), TEXT("step_width"), Width, OutError)
+            || !RequirePositive(TEXT("stairs"), TEXT("step_height"), StepHeight, OutError)
+            || !RequirePositive(TEXT("stairs"), TEXT("step_depth"), StepDepth, OutError))
+        {
+            return false;
+        }
+
+        // Side profile: up the back wall, then down the treads and risers to the front edge.
+        // Every corner is visible from the bottom of the back wall, so the sides fan from there
+        const double StartX = -Steps * StepDepth / 2;
+        const double EndX = Steps * StepDepth / 2;
+        TArray<FVector2d> Profile;
+        Profile.Add(FVector2d(EndX, 0.0));
+        Profile.Add(FVector2d(EndX, Steps * StepHeight));
+        for (int32 Step = Steps - 1; Step >= 0; --Step)
+        {
+            Profile.Add(FVector2d(StartX + Step * StepDepth, (Step + 1) * StepHeight));
+            Profile.Add(FVector2d(StartX + Step * StepDepth, Step * StepHeight));
+        }
+        Builder.AddExtrudedProfile(Profile, -Width / 2, Width / 2);
+        return true;
+    }
+
+    bool BuildArch(const TSharedPtr<FJsonObject>& Shape, FSolidBuilder& Builder, FString& OutError)
+    {
+        const double Span = GetNumber(Shape, TEXT("span"), 300.0);
+        const double Thickness = GetNumber(Shape, TEXT("thickness"), 50.0);
+        const double Depth = GetNumber(Shape, TEXT("depth"), 100.0);
+        const double LegHeight = FMath::Max(GetNumber(Shape, TEXT("leg_height"), 0.0), 0.0);
+        const int32 Segments = FMath::Clamp(FMath::RoundToInt32(GetNumber(Shape, TEXT("segments"), 16.0)), 2, 256);
+        if (!RequirePositive(TEXT("arch"), TEXT("span"), Span, OutError)
+            || !RequirePositive(TEXT("arch"), TEXT("thickness"), Thickness, OutError)
+            || !RequirePositive(TEXT("arch"), TEXT("depth"), Depth, OutError))
+        {
+            return false;
+        }
+
+        // Cross sections along the arch from the +X foot to the -X foot
+        struct FRing
+        {
+            FVector3d Radial;
+            int32 InnerFront, OuterFront, OuterBack, InnerBack;
+        };
+        const double InnerRadius = Span / 2;
+        const double OuterRadius = InnerRadius + Thickness;
+        TArray<FRing> Rings;
+        auto AddRing = [&](const FVector3d& Radial, double Z)
+        {
+            const FVector3d Inner(Radial.X * InnerRadius, 0.0, Z + Radial.Z * InnerRadius);
+            const FVector3d Outer(Radial.X * OuterRadius, 0.0, Z + Radial.Z * OuterRadius);
+            Rings.Add({ Radial,
+                Builder.Vertex(Inner - FVector3d(0, Depth / 2, 0)), Builder.Vertex(Outer - FVector3d(0, Depth / 2, 0)),
+                Builder.Vertex(Outer + FVector3d(0, Depth / 2, 0)), Builder.Vertex(Inner + FVector3d(0, Depth / 2, 0)) });
+        };
+        if (LegHeight > 0.0)
+        {
+            AddRing(FVector3d(1, 0, 0), 0.0);
+        }
+        for (int32 Segment = 0; Segment <= Segments; ++Segment)
+        {
+            const double Angle = UE_DOUBLE_PI * Segment / Segments;
+            AddRing(FVector3d(FMath::Cos(Angle), 0.0, FMath::Sin(Angle)), LegHeight);
+        }
+        if (LegHeight > 0.0)
+        {
+            AddRing(FVector3d(-1, 0, 0), 0.0);
+        }
+
+        for (int32 Index = 0; Index + 1 < Rings.Num(); ++Index)
+        {
+            const FRing& A = Rings[Index];
+            const FRing& B = Rings[Index + 1];
+            const FVector3d Radial = (A.Radial + B.Radial).GetSafeNormal();
+            Builder.AddFace({ A.InnerFront, B.InnerFront, B.InnerBack, A.InnerBack }, -Radial, { -A.Radial, -B.Radial, -B.Radial, -A.Radial });
+            Builder.AddFace({ A.OuterFront, B.OuterFront, B.OuterBack, A.OuterBack }, Radial, { A.Radial, B.Radial, B.Radial, A.Radial });
+            Builder.AddFace({ A.InnerFront, A.OuterFront, B.OuterFront, B.InnerFront }, FVector3d(0, -1, 0));
+            Builder.AddFace({ A.InnerBack, A.OuterBack, B.OuterBack, B.InnerBack }, FVector3d(0, 1, 0));
+        }
+        const FRing& First = Rings[0];
+        const FRing& Last = Rings.Last();
+        Builder.AddFace({ First.InnerFront, First.OuterFront, First.OuterBack, First.InnerBack },
+            Builder.GetPosition(First.OuterFront) - Builder.GetPosition(Rings[1].OuterFront));
+        Builder.AddFace({ Last.InnerFront, Last.OuterFront, Last.OuterBack, Last.InnerBack },
+            Builder.GetPosition(Last.OuterFront) - Builder.GetPosition(Rings[Rings.Num() - 2].OuterFront));
+        return true;
+    }
+
+    bool BuildShape(const TSharedPtr<FJsonObject>& Shape, const FString& Type, FDynamicMesh3& OutMesh, FString& OutError)
+    {
+        FSolidBuilder Builder(OutMesh);
+        bool bBuilt = false;
+        if (Type == TEXT("box"))
+        {
+            bBuilt = BuildBox(Shape, Builder, OutError);
+        }
+        else if (Type == TEXT("cylinder"))
+        {
+            bBuilt = BuildCylinder(Shape, Builder, OutError);
+        }
+        else if (Type == TEXT("pyramid"))
+        {
+            bBuilt = BuildPyramid(Shape, Builder, OutError);
+        }
+        else if (Type == TEXT("stairs"))
+        {
+            bBuilt = BuildStairs(Shape, Builder, OutError);
+        }
+        else if (Type == TEXT("arch"))
+        {
+            bBuilt = BuildArch(Shape, Builder, OutError);
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown shape type: %s (expected box, cylinder, pyramid, stairs or arch)"), *Type);
+            return false;
+        }
+
+        if (bBuilt && Builder.GetNumRejected() > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FMCPProceduralMesh: %d non-manifold triangles dropped from a %s"), Builder.GetNumRejected(), *Type);
+        }
+        return bBuilt;
+    }
+}
+
+bool FMCPProceduralMesh::BuildFromJson(const TArray<FJsonObjectWrapper>& Shapes, FDynamicMesh3& OutMesh, FString& OutError)
+{
+    OutMesh.Clear();
+    OutMesh.EnableAttributes();
+
+    for (int32 Index = 0; Index < Shapes.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>& Shape = Shapes[Index].JsonObject;
+        FString Type;
+        if (!Shape.IsValid() || !Shape->TryGetStringField(TEXT("type"), Type))
+        {
+            OutError = FString::Printf(TEXT("shapes[%d]: expected an object with a type"), Index);
+            return false;
+        }
+
+        FDynamicMesh3 Part;
+        FString ShapeError;
+        if (!BuildShape(Shape, Type.ToLower(), Part, ShapeError))
+        {
+            OutError = FString::Printf(TEXT("shapes[%d]: %s"), Index, *ShapeError);
+            return false;
+        }
+
+        const FVector3d Rotation = GetVector(Shape, TEXT("rotation"), FVector3d::ZeroVector);
+        const FTransform Transform(FRotator(Rotation.X, Rotation.Y, Rotation.Z), GetVector(Shape, TEXT("location"), FVector3d::ZeroVector),
+            GetVector(Shape, TEXT("scale"), FVector3d::OneVector));
+        if (!Transform.Equals(FTransform::Identity))
+        {
+            MeshTransforms::ApplyTransform(Part, FTransformSRT3d(Transform), true);
+        }
+
+        FString Operation = TEXT("union");
+        Shape->TryGetStringField(TEXT("operation"), Operation);
+        Operation = Operation.ToLower();
+        if (Operation != TEXT("union") && Operation != TEXT("subtract") && Operation != TEXT("append"))
+        {
+            OutError = FString::Printf(TEXT("shapes[%d]: unknown operation %s (expected union, subtract or append)"), Index, *Operation);
+            return false;
+        }
+
+        if (OutMesh.TriangleCount() == 0)
+        {
+            // Nothing to cut from yet; a leading subtract leaves the mesh empty
+            if (Operation != TEXT("subtract"))
+            {
+                OutMesh = MoveTemp(Part);
+            }
+            continue;
+        }
+
+        if (Operation == TEXT("append"))
+        {
+            FDynamicMeshEditor Editor(&OutMesh);
+            FMeshIndexMappings Mappings;
+            Editor.AppendMesh(&Part, Mappings);
+            continue;
+        }
+
+        FDynamicMesh3 Result;
+        FMeshBoolean Boolean(&OutMesh, &Part, &Result,
+            Operation == TEXT("subtract") ? FMeshBoolean::EBooleanOp::Difference : FMeshBoolean::EBooleanOp::Union);
+        Boolean.bPutResultInInputSpace = true;
+        if (!Boolean.Compute() && Result.TriangleCount() == 0)
+        {
+            OutError = FString::Printf(TEXT("shapes[%d]: %s failed"), Index, *Operation);
+            return false;
+        }
+        if (Boolean.CreatedBoundaryEdges.Num() > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FMCPProceduralMesh: %s of shapes[%d] left %d open edges"),
+                *Operation, Index, Boolean.CreatedBoundaryEdges.Num());
+        }
+        OutMesh = MoveTemp(Result);
+    }
+
+    if (OutMesh.TriangleCount() == 0)
+    {
+        OutError = TEXT("The shapes produced an empty mesh");
+        return false;
+    }
+    return true;
+}
+
+UStaticMesh* FMCPProceduralMesh::BakeToStaticMesh(const FDynamicMesh3& Mesh, const FString& AssetPath, UMaterialInterface* Material,
+    ECollision Collision, bool bOverwrite, bool& bOutCreated, FString& OutError)
+{
+    bOutCreated = false;
+    FText Reason;
+    if (!FPackageName::IsValidLongPackageName(AssetPath, false, &Reason))
+    {
+        OutError = FString::Printf(TEXT("Invalid asset path %s: %s"), *AssetPath, *Reason.ToString());
+        return nullptr;
+    }
+    const FString AssetName = FPackageName::GetLongPackageAssetName(AssetPath);
+
+    UStaticMesh* StaticMesh = nullptr;
+    if (UEditorAssetLibrary::DoesAssetExist(AssetPath))
+    {
+        StaticMesh = Cast<UStaticMesh>(UEditorAssetLibrary::LoadAsset(AssetPath));
+        if (!StaticMesh)
+        {
+            OutError = FString::Printf(TEXT("%s exists and is not a static mesh"), *AssetPath);
+            return nullptr;
+        }
+        if (!bOverwrite)
+        {
+            OutError = FString::Printf(TEXT("%s already exists (pass overwrite to rebuild it)"), *AssetPath);
+            return nullptr;
+        }
+        StaticMesh->Modify();
+    }
+    else
+    {
+        UPackage* Package = CreatePackage(*AssetPath);
+        if (!Package)
+        {
+            OutError = FString::Printf(TEXT("Failed to create package %s"), *AssetPath);
+            return nullptr;
+        }
+        StaticMesh = NewObject<UStaticMesh>(Package, FName(*AssetName), RF_Public | RF_Standalone | RF_Transactional);
+        bOutCreated = true;
+    }
+
+    FMeshDescription MeshDescription;
+    FStaticMeshAttributes Attributes(MeshDescription);
+    Attributes.Register();
+    FDynamicMeshToMeshDescription Converter;
+    Converter.Convert(&Mesh, MeshDescription);
+
+    // One section, matched to the single material slot by name
+    const FName SlotName(TEXT("Material"));
+    TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+    for (const FPolygonGroupID GroupID : MeshDescription.PolygonGroups().GetElementIDs())
+    {
+        SlotNames[GroupID] = SlotName;
+    }
+
+    StaticMesh->SetNumSourceModels(1);
+    FMeshBuildSettings& BuildSettings = StaticMesh->GetSourceModel(0).BuildSettings;
+    BuildSettings.bRecomputeNormals = false;
+    BuildSettings.bRecomputeTangents = true;
+    BuildSettings.bGenerateLightmapUVs = true;
+    BuildSettings.SrcLightmapIndex = 0;
+    BuildSettings.DstLightmapIndex = 1;
+    StaticMesh->SetLightMapCoordinateIndex(1);
+    StaticMesh->GetStaticMaterials().Reset();
+    StaticMesh->GetStaticMaterials().Add(FStaticMaterial(Material, SlotName, SlotName));
+
+    StaticMesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+    StaticMesh->CommitMeshDescription(0);
+
+    StaticMesh->CreateBodySetup();
+    UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+    BodySetup->Modify();
+    BodySetup->RemoveSimpleCollision();
+    switch (Collision)
+    {
+    case ECollision::Box:
+    {
+        const FAxisAlignedBox3d Bounds = Mesh.GetBounds();
+        const FVector3d Extents = Bounds.Max - Bounds.Min;
+        FKBoxElem Box(Extents.X, Extents.Y, Extents.Z);
+        Box.Center = Bounds.Center();
+        BodySetup->AggGeom.BoxElems.Add(Box);
+        BodySetup->CollisionTraceFlag = CTF_UseDefault;
+        break;
+    }
+    case ECollision::Complex:
+        BodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+        break;
+    default:
+        // No simple shapes and no complex fallback: nothing to collide with
+        BodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+        break;
+    }
+    BodySetup->InvalidatePhysicsData();
+
+    StaticMesh->Build(true);
+    StaticMesh->PostEditChange();
+    StaticMesh->MarkPackageDirty();
+    if (bOutCreated)
+    {
+        FAssetRegistryModule::AssetCreated(StaticMesh);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FMCPProceduralMesh: Baked %d triangles into %s"), Mesh.TriangleCount(), *AssetPath);
+    return StaticMesh;
+}
@@ -0,0 +1,51 @@
+#include "MCPProgress.h"
+#include "Misc/ScopeLock.h"
+
+FMCPProgressChannel* FMCPProgressChannel::Current = nullptr;
+
+bool FMCPProgressChannel::Report(int32 Done, int32 Total, const FString& Message)
+{
+    check(IsInGameThread());
+
+    // Nobody is listening when the command was not sent in streaming mode
+    if (!Current)
+    {
+        return true;
+    }
+
+    FScopeLock ScopeLock(&Current->Lock);
+    Current->Done = Done;
+    Current->Total = Total;
+    Current->Message = Message;
+    Current->bPending = true;
+    return !Current->bCancelled;
+}
+
+TSharedPtr<FJsonObject> FMCPProgressChannel::TakeReport()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!bPending)
+    {
+        return nullptr;
+    }
+    bPending = false;
+
+    TSharedPtr<FJsonObject> Frame = MakeShared<FJsonObject>();
+    Frame->SetStringField(TEXT("stream"), TEXT("progress"));
+    Frame->SetNumberField(TEXT("done"), Done);
+    Frame->SetNumberField(TEXT("total"), Total);
+    Frame->SetStringField(TEXT("message"), Message);
+    return Frame;
+}
+
+FMCPProgressChannel::FScope::FScope(FMCPProgressChannel* Channel)
+    : Previous(Current)
+{
+    check(IsInGameThread());
+    Current = Channel;
+}
+
+FMCPProgressChannel::FScope::~FScope()
+{
+    Current = Previous;
+}
@@ -0,0 +1,518 @@
+#include "MCPPropertyPath.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+#include "Editor.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "JsonObjectConverter.h"
+
+// Distinct (class, path) pairs kept before the cache starts over
+#define MCP_PROPERTY_PATH_CACHE_LIMIT 4096
+
+// Object references followed by a single path, guards against reference cycles
+#define MCP_PROPERTY_PATH_MAX_HOPS 32
+
+namespace
+{
+    struct FPathSegment
+    {
+        FProperty* Property;
+        // Element of an array property, or INDEX_NONE for the property itself
+        int32 Index;
+    };
+
+    /**
+     * The part of a path that stays inside one object, plus the rest of the
+     * path when it continues through an object reference.
+     */
+    struct FCompiledChain
+    {
+        TArray<FPathSegment> Segments;
+        FString Remainder;
+        FString Error;
+    };
+
+    typedef TPair<TWeakObjectPtr<UClass>, FString> FChainKey;
+
+    TMap<FChainKey, FCompiledChain> ChainCache;
+    bool bFlushDelegatesBound = false;
+
+    void BindFlushDelegates()
+    {
+        if (bFlushDelegatesBound || !GEditor)
+        {
+            return;
+        }
+
+        // Compiling a Blueprint rebuilds its class's properties in place
+        GEditor->OnBlueprintCompiled().AddStatic(&FMCPPropertyPath::FlushCache);
+        FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+        {
+            FMCPPropertyPath::FlushCache();
+        });
+        bFlushDelegatesBound = true;
+    }
+
+    // "Name" or "Name[Index]"
+    bool ParseSegment(const FString& Segment, FString& OutName, int32& OutIndex)
+    {
+        OutIndex = INDEX_NONE;
+
+        int32 BracketStart;
+        if (!Segment.FindChar(TEXT('['), BracketStart))
+        {
+            OutName = Segment;
+            return !OutName.IsEmpty();
+        }
+
+        const FString IndexText = Segment.Mid(BracketStart + 1, Segment.Len() - BracketStart - 2);
+        if (!Segment.EndsWith(TEXT("]")) || BracketStart == 0 || !IndexText.IsNumeric() || IndexText.Contains(TEXT("-")))
+        {
+            return false;
+        }
+
+        OutName = Segment.Left(BracketStart);
+        OutIndex = FCString::Atoi(*IndexText);
+        return true;
+    }
+
+    FCompiledChain CompileChain(const UClass* Class, const FString& Path)
+    {
+        FCompiledChain Chain;
+
+        TArray<FString> Parts;
+        Path.ParseIntoArray(Parts, TEXT("."), false);
+        if (Parts.Num() == 0)
+        {
+            Chain.Error = TEXT("Empty property path");
+            return Chain;
+        }
+
+        const UStruct* Scope = Class;
+        for (int32 PartIndex = 0; PartIndex < Parts.Num(); ++PartIndex)
+        {
+            FString Name;
+            int32 Index;
+            if (!ParseSegment(Parts[PartIndex], Name, Index))
+            {
+                Chain.Error = FString::Printf(TEXT("Invalid path segment '%s' in '%s'"), *Parts[PartIndex], *Path);
+                return Chain;
+            }
+
+            FProperty* Property = FindFProperty<FProperty>(Scope, FName(*Name));
+            if (!Property)
+            {
+                Chain.Error = FString::Printf(TEXT("Property '%s' not found on %s"), *Name, *Scope->GetName());
+                return Chain;
+            }
+
+            FProperty* ValueProperty = Property;
+            if (Index != INDEX_NONE)
+            {
+                const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+                if (!ArrayProperty)
+                {
+                    Chain.Error = FString::Printf(TEXT("'%s' is not an array"), *Name);
+                    return Chain;
+                }
+                ValueProperty = ArrayProperty->Inner;
+            }
+
+            Chain.Segments.Add({ Property, Index });
+
+            if (PartIndex == Parts.Num() - 1)
+            {
+                break;
+            }
+
+            if (const FStructProperty* StructProperty = CastField<FStructProperty>(ValueProperty))
+            {
+                Scope = StructProperty->Struct;
+            }
+            else if (ValueProperty->IsA<FObjectPropertyBase>())
+            {
+                for (int32 RestIndex = PartIndex + 1; RestIndex < Parts.Num(); ++RestIndex)
+                {
+                    if (!Chain.Remainder.IsEmpty())
+                    {
+                        Chain.Remainder.AppendChar(TEXT('.'));
+                    }
+                    Chain.Remainder += Parts[RestIndex];
+                }
+                break;
+            }
+            else
+            {
+                Chain.Error = FString::Printf(TEXT("'%s' has no nested properties"), *Parts[PartIndex]);
+                return Chain;
+            }
+        }
+
+        return Chain;
+    }
+
+    const FCompiledChain& FindChain(UClass* Class, const FString& Path)
+    {
+        BindFlushDelegates();
+
+        const FChainKey Key(Class, Path);
+        if (const FCompiledChain* Chain = ChainCache.Find(Key))
+        {
+            return *Chain;
+        }
+
+        if (ChainCache.Num() >= MCP_PROPERTY_PATH_CACHE_LIMIT)
+        {
+            ChainCache.Reset();
+        }
+        return ChainCache.Add(Key, CompileChain(Class, Path));
+    }
+
+    // Component template a Blueprint's construction script creates for a component variable. A component
+    // inherited from a parent Blueprint resolves to this Blueprint's override of it; for edits the override
+    // is created on first use (reported through OutOverridingBlueprint), so the parent is left untouched
+    UObject* FindComponentTemplate(UClass* Class, FName VariableName, bool bForEdit, UBlueprint*& OutOverridingBlueprint)
+    {
+        for (UBlueprintGeneratedClass* BlueprintClass = Cast<UBlueprintGeneratedClass>(Class); BlueprintClass;
+             BlueprintClass = Cast<UBlueprintGeneratedClass>(BlueprintClass->GetSuperClass()))
+        {
+            if (!BlueprintClass->SimpleConstructionScript)
+            {
+                continue;
+            }
+            for (USCS_Node* Node : BlueprintClass->SimpleConstructionScript->GetAllNodes())
+            {
+                if (!Node || Node->GetVariableName() != VariableName)
+                {
+                    continue;
+                }
+
+                UBlueprint* Blueprint = Cast<UBlueprint>(Class->ClassGeneratedBy);
+                if (BlueprintClass == Class || !Blueprint)
+                {
+                    return Node->ComponentTemplate;
+                }
+
+                const FComponentKey Key(Node);
+                UInheritableComponentHandler* InheritedHandler = Blueprint->GetInheritableComponentHandler(bForEdit);
+                UActorComponent* Override = InheritedHandler ? InheritedHandler->GetOverridenComponentTemplate(Key) : nullptr;
+                if (!Override && bForEdit)
+                {
+                    Override = InheritedHandler->CreateOverridenComponentTemplate(Key);
+                    OutOverridingBlueprint = Override ? Blueprint : nullptr;
+                }
+                return Override ? Override : Node->ComponentTemplate.Get();
+            }
+        }
+        return nullptr;
+    }
+
+    bool IsVectorStruct(const FProperty* Property, const UScriptStruct*& OutStruct)
+    {
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        OutStruct = StructProperty ? StructProperty->Struct : nullptr;
+        return OutStruct && (OutStruct == TBaseStructure<FVector>::Get() || OutStruct == TBaseStructure<FRotator>::Get());
+    }
+
+    // Enum and its storage for enum-typed properties (enum class and TEnumAsByte)
+    UEnum* GetPropertyEnum(FProperty* Property, FNumericProperty*& OutUnderlying)
+    {
+        if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+        {
+            OutUnderlying = EnumProperty->GetUnderlyingProperty();
+            return EnumProperty->GetEnum();
+        }
+        if (FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+        {
+            OutUnderlying = ByteProperty;
+            return ByteProperty->Enum;
+        }
+        OutUnderlying = nullptr;
+        return nullptr;
+    }
+
+    bool ImportEnumValue(UEnum* Enum, FNumericProperty* Underlying, void* ValuePtr, const FProperty* Property,
+                         const TSharedPtr<FJsonValue>& Value, FString& OutError)
+    {
+        if (Value->Type != EJson::Number && Value->Type != EJson::String)
+        {
+            OutError = FString::Printf(TEXT("'%s' expects an enum name or number"), *Property->GetName());
+            return false;
+        }
+
+        // Numbers must be one of the enum's values (not the hidden _MAX), so an out-of-range byte is never stored
+        const FString EnumValueName = Value->AsString();
+        if (Value->Type == EJson::Number || EnumValueName.IsNumeric())
+        {
+            const int64 Number = Value->Type == EJson::Number ? static_cast<int64>(Value->AsNumber()) : FCString::Atoi64(*EnumValueName);
+            if (!Enum->IsValidEnumValue(Number) || Enum->GetIndexByValue(Number) == Enum->NumEnums() - 1)
+            {
+                OutError = FString::Printf(TEXT("%lld is not a value of %s"), Number, *Enum->GetName());
+                return false;
+            }
+            Underlying->SetIntPropertyValue(ValuePtr, Number);
+            return true;
+        }
+
+        // "Player0" and "EAutoReceiveInput::Player0" are both accepted
+        FString ShortName = EnumValueName;
+        EnumValueName.Split(TEXT("::"), nullptr, &ShortName);
+
+        int64 EnumValue = Enum->GetValueByNameString(ShortName);
+        if (EnumValue == INDEX_NONE)
+        {
+            EnumValue = Enum->GetValueByNameString(EnumValueName);
+        }
+        if (EnumValue != INDEX_NONE)
+        {
+            Underlying->SetIntPropertyValue(ValuePtr, EnumValue);
+            return true;
+        }
+
+        // The hidden _MAX entry is left out of the suggestions
+        TArray<FString> Options;
+        for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+        {
+            Options.Add(Enum->GetNameStringByIndex(Index));
+        }
+        OutError = FString::Printf(TEXT("Could not find enum value for '%s' (valid values: %s)"), *EnumValueName, *FString::Join(Options, TEXT(", ")));
+        return false;
+    }
+}
+
+bool FMCPPropertyPath::Resolve(UObject* Object, const FString& Path, FResolved& OutResolved, FString& OutError, bool bForEdit)
+{
+    check(IsInGameThread());
+
+    if (!Object)
+    {
+        OutError = TEXT("Invalid object");
+        return false;
+    }
+
+    UObject* Current = Object;
+    FString CurrentPath = Path;
+
+    for (int32 Hop = 0; Hop < MCP_PROPERTY_PATH_MAX_HOPS; ++Hop)
+    {
+        const FCompiledChain& Chain = FindChain(Current->GetClass(), CurrentPath);
+        if (!Chain.Error.IsEmpty())
+        {
+            OutError = Chain.Error;
+            return false;
+        }
+
+        void* Container = Current;
+        void* ValuePtr = nullptr;
+        FProperty* Leaf = nullptr;
+
+        for (const FPathSegment& Segment : Chain.Segments)
+        {
+            ValuePtr = Segment.Property->ContainerPtrToValuePtr<void>(Container);
+            Leaf = Segment.Property;
+
+            if (Segment.Index != INDEX_NONE)
+            {
+                FArrayProperty* ArrayProperty = CastFieldChecked<FArrayProperty>(Segment.Property);
+                FScriptArrayHelper Array(ArrayProperty, ValuePtr);
+                if (!Array.IsValidIndex(Segment.Index))
+                {
+                    OutError = FString::Printf(TEXT("Index %d is out of range for '%s' (%d elements)"),
+                                               Segment.Index, *Segment.Property->GetName(), Array.Num());
+                    return false;
+                }
+                ValuePtr = Array.GetRawPtr(Segment.Index);
+                Leaf = ArrayProperty->Inner;
+            }
+
+            Container = ValuePtr;
+        }
+
+        if (Chain.Remainder.IsEmpty())
+        {
+            OutResolved.Owner = Current;
+            OutResolved.OwnerProperty = Chain.Segments[0].Property;
+            OutResolved.Property = Leaf;
+            OutResolved.ValuePtr = ValuePtr;
+            return true;
+        }
+
+        const FPathSegment& Last = Chain.Segments.Last();
+        UObject* Next = CastFieldChecked<FObjectPropertyBase>(Leaf)->GetObjectPropertyValue(ValuePtr);
+        if (!Next && Last.Index == INDEX_NONE && Current->HasAnyFlags(RF_ClassDefaultObject))
+        {
+            Next = FindComponentTemplate(Current->GetClass(), Last.Property->GetFName(), bForEdit, OutResolved.OverridingBlueprint);
+        }
+        if (!Next)
+        {
+            OutError = FString::Printf(TEXT("'%s' is None on %s"), *Last.Property->GetName(), *Current->GetName());
+            return false;
+        }
+
+        Current = Next;
+        CurrentPath = Chain.Remainder;
+    }
+
+    OutError = FString::Printf(TEXT("Property path '%s' follows too many object references"), *Path);
+    return false;
+}
+
+bool FMCPPropertyPath::GetValue(UObject* Object, const FString& Path, TSharedPtr<FJsonValue>& OutValue, FString& OutError)
+{
+    FResolved Resolved;
+    if (!Resolve(Object, Path, Resolved, OutError))
+    {
+        return false;
+    }
+
+    OutValue = ExportJsonValue(Resolved.Property, Resolved.ValuePtr);
+    if (!OutValue.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Cannot export '%s'"), *Path);
+        return false;
+    }
+    return true;
+}
+
+bool FMCPPropertyPath::SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, FString& OutError, bool bNotify)
+{
+    FResolved Resolved;
+    if (!Resolve(Object, Path, Resolved, OutError, true))
+    {
+        return false;
+    }
+
+    // A new inherited component override changes the Blueprint's component hierarchy
+    if (Resolved.OverridingBlueprint)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Resolved.OverridingBlueprint);
+    }
+
+    // Import into a copy of the current value (structs keep the fields the JSON leaves out), so a value
+    // that fails part way through leaves the property untouched and the owner is only notified of real changes
+    FProperty* Property = Resolved.Property;
+    void* Scratch = Property->AllocateAndInitializeValue();
+    Property->CopyCompleteValue(Scratch, Resolved.ValuePtr);
+    const bool bSuccess = ImportJsonValue(Property, Scratch, Value, OutError);
+
+    if (bSuccess)
+    {
+        if (bNotify)
+        {
+            Resolved.Owner->Modify();
+            Resolved.Owner->PreEditChange(Resolved.OwnerProperty);
+        }
+
+        Property->CopyCompleteValue(Resolved.ValuePtr, Scratch);
+
+        if (bNotify)
+        {
+            FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
+            ChangedEvent.SetActiveMemberProperty(Resolved.OwnerProperty);
+            Resolved.Owner->PostEditChangeProperty(ChangedEvent);
+        }
+    }
+
+    Property->DestroyAndFreeValue(Scratch);
+    return bSuccess;
+}
+
+bool FMCPPropertyPath::ImportJsonValue(FProperty* Property, void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+{
+    if (!Value.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Missing value for '%s'"), *Property->GetName());
+        return false;
+    }
+
+    const UScriptStruct* Struct = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* Items = nullptr;
+    if (IsVectorStruct(Property, Struct) && Value->TryGetArray(Items))
+    {
+        double Components[3];
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            if (Items->Num() != 3 || !(*Items)[Index].IsValid() || !(*Items)[Index]->TryGetNumber(Components[Index]))
+            {
+                OutError = FString::Printf(TEXT("'%s' expects an array of 3 numbers"), *Property->GetName());
+                return false;
+            }
+        }
+
+        if (Struct == TBaseStructure<FRotator>::Get())
+        {
+            *static_cast<FRotator*>(ValuePtr) = FRotator(Components[0], Components[1], Components[2]);
+        }
+        else
+        {
+            *static_cast<FVector*>(ValuePtr) = FVector(Components[0], Components[1], Components[2]);
+        }
+        return true;
+    }
+
+    // Arrays and sets are rebuilt from a JSON array; anything else would be read as an empty one
+    if ((Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>()) && Value->Type != EJson::Array)
+    {
+        OutError = FString::Printf(TEXT("'%s' expects an array"), *Property->GetName());
+        return false;
+    }
+
+    FNumericProperty* Underlying = nullptr;
+    if (UEnum* Enum = GetPropertyEnum(Property, Underlying))
+    {
+        return ImportEnumValue(Enum, Underlying, ValuePtr, Property, Value, OutError);
+    }
+
+    if (!FJsonObjectConverter::JsonValueToUProperty(Value, Property, ValuePtr, 0, 0))
+    {
+        OutError = FString::Printf(TEXT("Cannot convert value for '%s' (%s)"), *Property->GetName(), *Property->GetCPPType());
+        return false;
+    }
+    return true;
+}
+
+TSharedPtr<FJsonValue> FMCPPropertyPath::ExportJsonValue(FProperty* Property, const void* ValuePtr)
+{
+    const UScriptStruct* Struct = nullptr;
+    if (IsVectorStruct(Property, Struct))
+    {
+        double Components[3];
+        if (Struct == TBaseStructure<FRotator>::Get())
+        {
+            const FRotator& Rotator = *static_cast<const FRotator*>(ValuePtr);
+            Components[0] = Rotator.Pitch;
+            Components[1] = Rotator.Yaw;
+            Components[2] = Rotator.Roll;
+        }
+        else
+        {
+            const FVector& Vector = *static_cast<const FVector*>(ValuePtr);
+            Components[0] = Vector.X;
+            Components[1] = Vector.Y;
+            Components[2] = Vector.Z;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> Items;
+        for (double Component : Components)
+        {
+            Items.Add(MakeShared<FJsonValueNumber>(Component));
+        }
+        return MakeShared<FJsonValueArray>(Items);
+    }
+
+    FNumericProperty* Underlying = nullptr;
+    if (UEnum* Enum = GetPropertyEnum(Property, Underlying))
+    {
+        return MakeShared<FJsonValueString>(Enum->GetNameStringByValue(Underlying->GetSignedIntPropertyValue(ValuePtr)));
+    }
+
+    return FJsonObjectConverter::UPropertyToJsonValue(Property, ValuePtr);
+}
+
+void FMCPPropertyPath::FlushCache()
+{
+    ChainCache.Reset();
+}
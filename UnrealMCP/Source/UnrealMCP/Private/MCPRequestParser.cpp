@@ -0,0 +1,292 @@
+#include "MCPRequestParser.h"
+#include "MCPCommandRegistry.h"
+#include "Serialization/JsonReader.h"
+
+// Deeper nesting than this is rejected rather than recursed into
+#define MCP_MAX_JSON_DEPTH 256
+
+const FMCPBulkParams* FMCPBulkParams::Current = nullptr;
+
+namespace
+{
+    typedef TJsonReader<TCHAR> FMCPJsonReader;
+
+    class FMCPTokenParser
+    {
+    public:
+        explicit FMCPTokenParser(const FString& Message)
+            : Reader(TJsonReaderFactory<TCHAR>::Create(Message))
+        {
+        }
+
+        bool Next(EJsonNotation& OutNotation)
+        {
+            if (Reader->ReadNext(OutNotation) && OutNotation != EJsonNotation::Error)
+            {
+                return true;
+            }
+            if (Error.IsEmpty())
+            {
+                Error = OutNotation == EJsonNotation::Error ? Reader->GetErrorMessage() : TEXT("Unexpected end of request");
+            }
+            return false;
+        }
+
+        const FString& GetIdentifier() const { return Reader->GetIdentifier(); }
+
+        // Build a DOM value for the token just read
+        TSharedPtr<FJsonValue> ReadValue(EJsonNotation Notation, int32 Depth)
+        {
+            switch (Notation)
+            {
+            case EJsonNotation::String:
+                return MakeShared<FJsonValueString>(Reader->GetValueAsString());
+            case EJsonNotation::Number:
+                return MakeShared<FJsonValueNumber>(Reader->GetValueAsNumber());
+            case EJsonNotation::Boolean:
+                return MakeShared<FJsonValueBoolean>(Reader->GetValueAsBoolean());
+            case EJsonNotation::Null:
+                return MakeShared<FJsonValueNull>();
+            case EJsonNotation::ObjectStart:
+            {
+                TSharedPtr<FJsonObject> Object = ReadObject(Depth + 1, nullptr, nullptr);
+                return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+            }
+            case EJsonNotation::ArrayStart:
+                return ReadArray(Depth + 1);
+            default:
+                SetError(TEXT("Unexpected token"));
+                return nullptr;
+            }
+        }
+
+        /**
+         * Read the members of an object whose ObjectStart was just consumed.
+         * Members named in BulkFields are packed into OutBulk instead of the DOM.
+         */
+        TSharedPtr<FJsonObject> ReadObject(int32 Depth, const TSet<FString>* BulkFields, TSharedPtr<FMCPBulkParams>* OutBulk)
+        {
+            if (Depth > MCP_MAX_JSON_DEPTH)
+            {
+                SetError(TEXT("Request is nested too deeply"));
+                return nullptr;
+            }
+
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            EJsonNotation Notation;
+            while (Next(Notation))
+            {
+                if (Notation == EJsonNotation::ObjectEnd)
+                {
+                    return Object;
+                }
+
+                const FString Identifier = GetIdentifier();
+
+                if (BulkFields && Notation == EJsonNotation::ArrayStart && BulkFields->Contains(Identifier))
+                {
+                    if (!OutBulk->IsValid())
+                    {
+                        *OutBulk = MakeShared<FMCPBulkParams>(Object);
+                    }
+                    if (!ReadPackedArray(Identifier, (*OutBulk)->Fields.Add(Identifier)))
+                    {
+                        return nullptr;
+                    }
+                    continue;
+                }
+
+                TSharedPtr<FJsonValue> Value = ReadValue(Notation, Depth);
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                Object->SetField(Identifier, Value);
+            }
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonValue> ReadArray(int32 Depth)
+        {
+            if (Depth > MCP_MAX_JSON_DEPTH)
+            {
+                SetError(TEXT("Request is nested too deeply"));
+                return nullptr;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> Items;
+            EJsonNotation Notation;
+            while (Next(Notation))
+            {
+                if (Notation == EJsonNotation::ArrayEnd)
+                {
+                    return MakeShared<FJsonValueArray>(MoveTemp(Items));
+                }
+
+                TSharedPtr<FJsonValue> Item = ReadValue(Notation, Depth);
+                if (!Item.IsValid())
+                {
+                    return nullptr;
+                }
+                Items.Add(Item);
+            }
+            return nullptr;
+        }
+
+        // Decode [n, n, ...] or [[n, n, n], [n, n, n], ...] whose ArrayStart was just consumed
+        bool ReadPackedArray(const FString& FieldName, FMCPPackedArray& OutArray)
+        {
+            bool bRows = false;
+            bool bFlat = false;
+            int32 Stride = INDEX_NONE;
+
+            EJsonNotation Notation;
+            while (Next(Notation))
+            {
+                if (Notation == EJsonNotation::ArrayEnd)
+                {
+                    OutArray.Stride = bRows ? FMath::Max(Stride, 1) : 1;
+                    return true;
+                }
+
+                if (Notation == EJsonNotation::Number && !bRows)
+                {
+                    bFlat = true;
+                    OutArray.Values.Add(Reader->GetValueAsNumber());
+                    continue;
+                }
+
+                if (Notation == EJsonNotation::ArrayStart && !bFlat)
+                {
+                    bRows = true;
+                    int32 RowLength = 0;
+                    while (Next(Notation) && Notation == EJsonNotation::Number)
+                    {
+                        OutArray.Values.Add(Reader->GetValueAsNumber());
+                        ++RowLength;
+                    }
+                    if (Notation != EJsonNotation::ArrayEnd)
+                    {
+                        break;
+                    }
+                    if (Stride != INDEX_NONE && RowLength != Stride)
+                    {
+                        SetError(FString::Printf(TEXT("Rows of '%s' must all have %d numbers"), *FieldName, Stride));
+                        return false;
+                    }
+                    Stride = RowLength;
+                    continue;
+                }
+
+                break;
+            }
+
+            SetError(FString::Printf(TEXT("'%s' must be an array of numbers or an array of equal-length number arrays"), *FieldName));
+            return false;
+        }
+
+        void SetError(const FString& Message)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = Message;
+            }
+        }
+
+        FString Error;
+
+    private:
+        TSharedRef<FMCPJsonReader> Reader;
+    };
+}
+
+const FMCPPackedArray* FMCPBulkParams::FindCurrent(const TSharedPtr<FJsonObject>& Params, const FString& FieldName)
+{
+    if (!Current || Current->Params != Params.Get())
+    {
+        return nullptr;
+    }
+    return Current->Fields.Find(FieldName);
+}
+
+FMCPBulkParams::FScope::FScope(const FMCPBulkParams* Bulk)
+    : Previous(Current)
+{
+    check(IsInGameThread());
+    Current = Bulk;
+}
+
+FMCPBulkParams::FScope::~FScope()
+{
+    Current = Previous;
+}
+
+bool FMCPRequestParser::Parse(const FString& Message, const FMCPCommandRegistry& Registry, FMCPParsedRequest& OutRequest, FString& OutError)
+{
+    FMCPTokenParser Parser(Message);
+
+    EJsonNotation Notation;
+    if (!Parser.Next(Notation) || Notation != EJsonNotation::ObjectStart)
+    {
+        OutError = TEXT("Request must be a JSON object");
+        return false;
+    }
+
+    OutRequest.Envelope = MakeShared<FJsonObject>();
+    TSet<FString> BulkFields;
+
+    while (Parser.Next(Notation))
+    {
+        if (Notation == EJsonNotation::ObjectEnd)
+        {
+            if (!OutRequest.Params.IsValid())
+            {
+                OutRequest.Params = MakeShared<FJsonObject>();
+            }
+            return true;
+        }
+
+        const FString Identifier = Parser.GetIdentifier();
+
+        // Command type ("command" is accepted as an alias of "type")
+        if (Notation == EJsonNotation::String &&
+            (Identifier == TEXT("type") || (Identifier == TEXT("command") && OutRequest.CommandType.IsEmpty())))
+        {
+            TSharedPtr<FJsonValue> TypeValue = Parser.ReadValue(Notation, 0);
+            OutRequest.CommandType = TypeValue->AsString();
+
+            BulkFields.Reset();
+            if (const FMCPCommandSpec* Command = Registry.Find(OutRequest.CommandType))
+            {
+                for (const FMCPParamSpec& Param : Command->Params)
+                {
+                    if (Param.Type == EMCPParamType::NumberArray)
+                    {
+                        BulkFields.Add(Param.Name);
+                    }
+                }
+            }
+            continue;
+        }
+
+        if (Identifier == TEXT("params") && Notation == EJsonNotation::ObjectStart)
+        {
+            OutRequest.Params = Parser.ReadObject(1, BulkFields.Num() > 0 ? &BulkFields : nullptr, &OutRequest.Bulk);
+            if (!OutRequest.Params.IsValid())
+            {
+                break;
+            }
+            continue;
+        }
+
+        TSharedPtr<FJsonValue> Value = Parser.ReadValue(Notation, 0);
+        if (!Value.IsValid())
+        {
+            break;
+        }
+        OutRequest.Envelope->SetField(Identifier, Value);
+    }
+
+    OutError = Parser.Error.IsEmpty() ? TEXT("Failed to parse request JSON") : FString::Printf(TEXT("Failed to parse request JSON: %s"), *Parser.Error);
+    return false;
+}
@@ -1,5 +1,6 @@
 #include "MCPServerRunnable.h"
 #include "EpicUnrealMCPBridge.h"
+#include "MCPRequestParser.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "Interfaces/IPv4/IPv4Address.h"
@@ -8,12 +9,131 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "JsonObjectConverter.h"
-#include "Misc/ScopeLock.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Async/Async.h"
 #include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
+
+// Number of clients served concurrently; further connections are refused with a busy error
+#define MCP_WORKER_THREADS 4
+// Close connections that send nothing for this long, so idle clients don't hold a worker
+#define MCP_CLIENT_IDLE_TIMEOUT_SECONDS 60.0
+// Close connections that stall halfway through a request for this long
+#define MCP_CLIENT_READ_TIMEOUT_SECONDS 10.0
+// Give up on a response when the client has not accepted any of it for this long
+#define MCP_CLIENT_WRITE_TIMEOUT_SECONDS 30.0
+// Reject requests larger than this instead of buffering without bound
+#define MCP_MAX_MESSAGE_SIZE (64 * 1024 * 1024)
+// Items per frame for streamed responses unless the request sets stream_chunk_size
+#define MCP_DEFAULT_STREAM_CHUNK_SIZE 500
+// Smallest payload worth compressing when the request does not set compression_threshold
+#define MCP_DEFAULT_COMPRESSION_THRESHOLD (16 * 1024)
+
+namespace
+{
+    // Sends a command's response frames over one client connection
+    class FMCPConnectionSink : public IMCPResponseSink
+    {
+    public:
+        FMCPConnectionSink(FMCPServerRunnable& InServer, TSharedPtr<FSocket> InClient, const FMCPConnectionOptions& InOptions, bool bInNewlineDelimited)
+            : Server(InServer)
+            , Client(InClient)
+            , Options(InOptions)
+            , bNewlineDelimited(bInNewlineDelimited)
+        {
+        }
+
+        virtual TUniquePtr<FMCPPayloadWriter> MakeWriter() override
+        {
+            return FMCPPayloadWriter::Create(Options.Encoding);
+        }
+
+        virtual bool SendFrame(const FMCPPayloadWriter& Writer) override
+        {
+            return Server.SendFrame(Client, Options, Writer.GetBytes(), bNewlineDelimited);
+        }
+
+    private:
+        FMCPServerRunnable& Server;
+        TSharedPtr<FSocket> Client;
+        FMCPConnectionOptions Options;
+        bool bNewlineDelimited;
+    };
+}
+
+void FMCPMessageFramer::Append(const uint8* Data, int32 Num)
+{
+    Buffer.Append(Data, Num);
+}
+
+bool FMCPMessageFramer::Next(FString& OutMessage)
+{
+    while (ScanPos < Buffer.Num())
+    {
+        const uint8 Char = Buffer[ScanPos++];
+
+        if (MessageStart == INDEX_NONE)
+        {
+            // Skip whitespace and separators between messages
+            if (Char == '{')
+            {
+                MessageStart = ScanPos - 1;
+                Depth = 1;
+            }
+            continue;
+        }
+
+        if (bInString)
+        {
+            if (bEscaped)
+            {
+                bEscaped = false;
+            }
+            else if (Char == '\\')
+            {
+                bEscaped = true;
+            }
+            else if (Char == '"')
+            {
+                bInString = false;
+            }
+            continue;
+        }
+
+        if (Char == '"')
+        {
+            bInString = true;
+        }
+        else if (Char == '{' || Char == '[')
+        {
+            ++Depth;
+        }
+        else if ((Char == '}' || Char == ']') && --Depth == 0)
+        {
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + MessageStart), ScanPos - MessageStart);
+            OutMessage = FString(Converted.Length(), Converted.Get());
+
+            Buffer.RemoveAt(0, ScanPos, EAllowShrinking::No);
+            ScanPos = 0;
+            MessageStart = INDEX_NONE;
+            return true;
+        }
+    }
+
+    // Drop skipped bytes when no message is in progress
+    if (MessageStart == INDEX_NONE)
+    {
+        Buffer.Reset();
+        ScanPos = 0;
+    }
+
+    return false;
+}
 
 FMCPServerRunnable::FMCPServerRunnable(UEpicUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket)
     : Bridge(InBridge)
     , ListenerSocket(InListenerSocket)
+    , WorkerPool(nullptr)
     , bRunning(true)
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Created server runnable"));
@@ -21,164 +141,73 @@ FMCPServerRunnable::FMCPServerRunnable(UEpicUnrealMCPBridge* InBridge, TSharedPt
 
 FMCPServerRunnable::~FMCPServerRunnable()
 {
-    // Note: We don't delete the sockets here as they're owned by the bridge
+    // Note: We don't delete the listener socket here as it's owned by the bridge
 }
 
 bool FMCPServerRunnable::Init()
 {
+    WorkerPool = FQueuedThreadPool::Allocate();
+    if (!WorkerPool->Create(MCP_WORKER_THREADS, 128 * 1024, TPri_Normal, TEXT("UnrealMCPWorkerPool")))
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to create worker pool"));
+        delete WorkerPool;
+        WorkerPool = nullptr;
+        return false;
+    }
     return true;
 }
 
 uint32 FMCPServerRunnable::Run()
 {
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread starting..."));
-    
+
     while (bRunning)
     {
-        // UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Waiting for client connection..."));
-        
         bool bPending = false;
         if (ListenerSocket->HasPendingConnection(bPending) && bPending)
         {
             UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection pending, accepting..."));
-            
-            ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
+
+            TSharedPtr<FSocket> ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
             if (ClientSocket.IsValid())
             {
                 UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection accepted"));
-                
+
                 // Set socket options to improve connection stability
                 ClientSocket->SetNoDelay(true);
                 int32 SocketBufferSize = 65536;  // 64KB buffer
                 ClientSocket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
                 ClientSocket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
-                
-                uint8 Buffer[8192];
-                while (bRunning)
+
+                // Refuse rather than queue behind connections that may stay open for a while
+                if (ActiveConnections.GetValue() >= MCP_WORKER_THREADS)
                 {
-                    int32 BytesRead = 0;
-                    if (ClientSocket->Recv(Buffer, sizeof(Buffer) - 1, BytesRead))
-                    {
-                        if (BytesRead == 0)
-                        {
-                            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
-                            break;
-                        }
-
-                        // Convert received data to string
-                        Buffer[BytesRead] = '\0';
-                        FString ReceivedText = UTF8_TO_TCHAR(Buffer);
-                        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *ReceivedText);
-
-                        // Parse JSON
-                        TSharedPtr<FJsonObject> JsonObject;
-                        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReceivedText);
-                        
-                        if (FJsonSerializer::Deserialize(Reader, JsonObject))
-                        {
-                            // Get command type
-                            FString CommandType;
-                            if (JsonObject->TryGetStringField(TEXT("type"), CommandType))
-                            {
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-
-                                // Execute command
-                                FString Response = Bridge->ExecuteCommand(CommandType, JsonObject->GetObjectField(TEXT("params")));
-
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Command executed, response length: %d"), Response.Len());
-
-                                // Log response for debugging (truncated for large responses)
-                                FString LogResponse = Response.Len() > 200 ? Response.Left(200) + TEXT("...") : Response;
-                                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
-                                       Response.Len(), *LogResponse);
-
-                                // Convert to UTF8 once
-                                FTCHARToUTF8 UTF8Response(*Response);
-                                const uint8* DataToSend = (const uint8*)UTF8Response.Get();
-                                int32 TotalDataSize = UTF8Response.Length();
-                                int32 TotalBytesSent = 0;
-                                bool bSuccess = true;
-
-                                // Send all data in a loop (TCP may not send everything at once)
-                                while (TotalBytesSent < TotalDataSize)
-                                {
-                                    int32 BytesSent = 0;
-                                    bool bSendResult = ClientSocket->Send(DataToSend + TotalBytesSent,
-                                                                          TotalDataSize - TotalBytesSent,
-                                                                          BytesSent);
-
-                                    if (!bSendResult)
-                                    {
-                                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                                        UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
-                                               TotalBytesSent, TotalDataSize, LastError);
-                                        bSuccess = false;
-                                        break;
-                                    }
-
-                                    TotalBytesSent += BytesSent;
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
-                                           BytesSent, TotalBytesSent, TotalDataSize);
-                                }
-
-                                if (bSuccess)
-                                {
-                                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
-                                           TotalBytesSent);
-                                }
-                            }
-                            else
-                            {
-                                UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
-                            }
-                        }
-                        else
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse JSON from: %s"), *ReceivedText);
-                        }
-                    }
-                    else
-                    {
-                        int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
-                        // Don't break the connection for WouldBlock error, which is normal for non-blocking sockets
-                        bool bShouldBreak = true;
-                        
-                        // Check for "would block" error which isn't a real error for non-blocking sockets
-                        if (LastError == SE_EWOULDBLOCK) 
-                        {
-                            UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Socket would block, continuing..."));
-                            bShouldBreak = false;
-                            // Small sleep to prevent tight loop when no data
-                            FPlatformProcess::Sleep(0.01f);
-                        }
-                        // Check for other transient errors we might want to tolerate
-                        else if (LastError == SE_EINTR) // Interrupted system call
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Socket read interrupted, continuing..."));
-                            bShouldBreak = false;
-                        }
-                        else 
-                        {
-                            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
-                        }
-                        
-                        if (bShouldBreak)
-                        {
-                            break;
-                        }
-                    }
+                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: All %d connections in use, refusing client"), MCP_WORKER_THREADS);
+                    SendError(ClientSocket, FMCPConnectionOptions(),
+                              FString::Printf(TEXT("Server busy: all %d connections are in use, retry later"), MCP_WORKER_THREADS));
+                    ClientSocket->Shutdown(ESocketShutdownMode::Write);
+                    ClientSocket->Close();
+                    continue;
                 }
+
+                // Parsing, execution and serialization for this client happen on a worker
+                ActiveConnections.Increment();
+                AsyncPool(*WorkerPool, [this, ClientSocket]()
+                {
+                    HandleClientConnection(ClientSocket);
+                    ActiveConnections.Decrement();
+                });
             }
             else
             {
                 UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to accept client connection"));
             }
         }
-        
+
         // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.1f);
+        FPlatformProcess::Sleep(0.01f);
     }
-    
+
     UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Server thread stopping"));
     return 0;
 }
@@ -190,6 +219,13 @@ void FMCPServerRunnable::Stop()
 
 void FMCPServerRunnable::Exit()
 {
+    // Waits for in-flight connections, which return once they see bRunning cleared
+    if (WorkerPool)
+    {
+        WorkerPool->Destroy();
+        delete WorkerPool;
+        WorkerPool = nullptr;
+    }
 }
 
 void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSocket)
@@ -200,170 +236,320 @@ void FMCPServerRunnable::HandleClientConnection(TSharedPtr<FSocket> InClientSock
         return;
     }
 
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting to handle client connection"));
-    
-    // Set socket options for better connection stability
-    InClientSocket->SetNonBlocking(false);
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Set socket to blocking mode"));
-    
-    // Properly read full message with timeout
-    const int32 MaxBufferSize = 4096;
-    uint8 Buffer[MaxBufferSize];
-    FString MessageBuffer;
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Starting message receive loop"));
-    
-    while (bRunning && InClientSocket.IsValid())
+    FMCPMessageFramer Framer;
+    FMCPConnectionOptions Options;
+    uint8 Buffer[8192];
+    double LastActivity = FPlatformTime::Seconds();
+
+    while (bRunning)
     {
-        // Log socket state
-        bool bIsConnected = InClientSocket->GetConnectionState() == SCS_Connected;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Socket state - Connected: %s"), 
-               bIsConnected ? TEXT("true") : TEXT("false"));
-        
-        // Log pending data status before receive
-        uint32 PendingDataSize = 0;
-        bool HasPendingData = InClientSocket->HasPendingData(PendingDataSize);
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Before Recv - HasPendingData=%s, Size=%d"), 
-               HasPendingData ? TEXT("true") : TEXT("false"), PendingDataSize);
-        
-        // Try to receive data with timeout
-        int32 BytesRead = 0;
-        bool bReadSuccess = false;
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Attempting to receive data..."));
-        bReadSuccess = InClientSocket->Recv(Buffer, MaxBufferSize - 1, BytesRead, ESocketReceiveFlags::None);
-        
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Recv attempt complete - Success=%s, BytesRead=%d"), 
-               bReadSuccess ? TEXT("true") : TEXT("false"), BytesRead);
-        
-        if (BytesRead > 0)
+        // Block briefly so we notice shutdown without spinning
+        if (!InClientSocket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
         {
-            // Log raw data for debugging
-            FString HexData;
-            for (int32 i = 0; i < FMath::Min(BytesRead, 50); ++i)
+            if (InClientSocket->GetConnectionState() != SCS_Connected)
             {
-                HexData += FString::Printf(TEXT("%02X "), Buffer[i]);
+                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client connection lost"));
+                break;
             }
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Raw data (first 50 bytes hex): %s%s"), 
-                   *HexData, BytesRead > 50 ? TEXT("...") : TEXT(""));
-            
-            // Convert and log received data
-            Buffer[BytesRead] = 0; // Null terminate
-            FString ReceivedData = UTF8_TO_TCHAR(Buffer);
-            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received data as string: '%s'"), *ReceivedData);
-            
-            // Append to message buffer
-            MessageBuffer.Append(ReceivedData);
-            
-            // Process complete messages (messages are terminated with newline)
-            if (MessageBuffer.Contains(TEXT("\n")))
+
+            // Half-open and forgotten connections would otherwise hold this worker forever
+            const double Timeout = Framer.GetBufferedSize() > 0 ? MCP_CLIENT_READ_TIMEOUT_SECONDS : MCP_CLIENT_IDLE_TIMEOUT_SECONDS;
+            if (FPlatformTime::Seconds() - LastActivity > Timeout)
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Newline detected in buffer, processing messages"));
-                
-                TArray<FString> Messages;
-                MessageBuffer.ParseIntoArray(Messages, TEXT("\n"), true);
-                
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Found %d message(s) in buffer"), Messages.Num());
-                
-                // Process all complete messages
-                for (int32 i = 0; i < Messages.Num() - 1; ++i)
-                {
-                    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message %d: '%s'"), 
-                           i + 1, *Messages[i]);
-                    ProcessMessage(InClientSocket, Messages[i]);
-                }
-                
-                // Keep any incomplete message in the buffer
-                MessageBuffer = Messages.Last();
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Remaining buffer after processing: %s"), 
-                       *MessageBuffer);
+                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Closing client after %.0f s without data"), Timeout);
+                break;
             }
-            else
+            continue;
+        }
+
+        int32 BytesRead = 0;
+        if (!InClientSocket->Recv(Buffer, sizeof(Buffer), BytesRead))
+        {
+            int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+
+            // Would block / interrupted aren't real errors for non-blocking sockets
+            if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
             {
-                UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: No complete message yet (no newline detected)"));
+                continue;
             }
+
+            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Client disconnected or error. Last error code: %d"), LastError);
+            break;
         }
-        else if (!bReadSuccess)
+
+        if (BytesRead == 0)
         {
-            UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Connection closed or error occurred - Last error: %d"), 
-                   (int32)ISocketSubsystem::Get()->GetLastErrorCode());
+            UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Client disconnected (zero bytes)"));
+            break;
+        }
+
+        Framer.Append(Buffer, BytesRead);
+
+        FString Message;
+        while (Framer.Next(Message))
+        {
+            ProcessMessage(InClientSocket, Message, Options);
+        }
+
+        // Time spent running commands doesn't count as idle
+        LastActivity = FPlatformTime::Seconds();
+
+        if (Framer.GetBufferedSize() > MCP_MAX_MESSAGE_SIZE)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Request exceeds %d bytes, closing connection"), MCP_MAX_MESSAGE_SIZE);
+            SendError(InClientSocket, Options, TEXT("Request too large"));
             break;
         }
-        
-        // Small sleep to prevent tight loop
-        FPlatformProcess::Sleep(0.01f);
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Exited message receive loop"));
+
+    InClientSocket->Close();
 }
 
-void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message)
+void FMCPServerRunnable::ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message, FMCPConnectionOptions& Options)
 {
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Processing message: %s"), *Message);
-    
-    // Parse message as JSON
-    TSharedPtr<FJsonObject> JsonMessage;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
+    FString LogMessage = Message.Len() > 200 ? Message.Left(200) + TEXT("...") : Message;
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Received: %s"), *LogMessage);
+
+    // Parse the envelope; bulk parameters are packed without building a DOM for them
+    FMCPParsedRequest Request;
+    FString ParseError;
+    if (!FMCPRequestParser::Parse(Message, Bridge->GetCommandRegistry(), Request, ParseError))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: %s"), *ParseError);
+        SendError(Client, Options, ParseError);
+        return;
+    }
+
+    const FString& CommandType = Request.CommandType;
+    const TSharedPtr<FJsonObject>& Params = Request.Params;
+    if (CommandType.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Missing 'type' field in command"));
+        SendError(Client, Options, TEXT("Missing 'type' field in command"));
+        return;
+    }
+
+    // Connection-level commands never reach the game thread
+    if (CommandType == TEXT("negotiate"))
     {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Failed to parse message as JSON"));
+        HandleNegotiate(Client, Params, Options);
         return;
     }
-    
-    // Extract command type and parameters using MCP protocol format
-    FString CommandType;
-    TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject());
-    
-    if (!JsonMessage->TryGetStringField(TEXT("command"), CommandType))
+
+    // Streaming mode: item frames followed by a final summary frame
+    bool bStream = false;
+    Request.Envelope->TryGetBoolField(TEXT("stream"), bStream);
+    if (bStream)
     {
-        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Message missing 'command' field"));
+        int32 ChunkSize = MCP_DEFAULT_STREAM_CHUNK_SIZE;
+        Request.Envelope->TryGetNumberField(TEXT("stream_chunk_size"), ChunkSize);
+
+        FMCPConnectionSink Sink(*this, Client, Options, true);
+        Bridge->ExecuteCommandStreaming(CommandType, Params, ChunkSize, Sink, Request.Bulk);
         return;
     }
-    
-    // Parameters are optional in MCP protocol
-    if (JsonMessage->HasField(TEXT("params")))
+
+    // Execute command; the response is encoded on this worker
+    FMCPConnectionSink Sink(*this, Client, Options, false);
+    Bridge->ExecuteCommand(CommandType, Params, Sink, Request.Bulk);
+}
+
+void FMCPServerRunnable::HandleNegotiate(TSharedPtr<FSocket> Client, const TSharedPtr<FJsonObject>& Params, FMCPConnectionOptions& Options)
+{
+    FMCPConnectionOptions NewOptions = Options;
+
+    FString EncodingName;
+    if (Params->TryGetStringField(TEXT("encoding"), EncodingName) &&
+        !FMCPPayloadWriter::ParseEncoding(EncodingName, NewOptions.Encoding))
     {
-        TSharedPtr<FJsonValue> ParamsValue = JsonMessage->TryGetField(TEXT("params"));
-        if (ParamsValue.IsValid() && ParamsValue->Type == EJson::Object)
+        SendError(Client, Options, FString::Printf(TEXT("Unsupported encoding: %s"), *EncodingName));
+        return;
+    }
+
+    FString CompressionName;
+    if (Params->TryGetStringField(TEXT("compression"), CompressionName))
+    {
+        if (CompressionName == TEXT("zlib"))
+        {
+            NewOptions.CompressionFormat = NAME_Zlib;
+        }
+        else if (CompressionName == TEXT("lz4"))
         {
-            Params = ParamsValue->AsObject();
+            NewOptions.CompressionFormat = NAME_LZ4;
+        }
+        else if (CompressionName == TEXT("none"))
+        {
+            NewOptions.CompressionFormat = NAME_None;
+        }
+        else
+        {
+            SendError(Client, Options, FString::Printf(TEXT("Unsupported compression: %s"), *CompressionName));
+            return;
         }
     }
-    
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Executing command: %s"), *CommandType);
-    
-    // Execute command
-    FString Response = Bridge->ExecuteCommand(CommandType, Params);
-    
-    // Send response with newline terminator
-    Response += TEXT("\n");
-
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sending response (%d bytes): %s"),
-           Response.Len(), *Response);
-
-    // Convert to UTF8 once
-    FTCHARToUTF8 UTF8Response(*Response);
-    const uint8* DataToSend = (const uint8*)UTF8Response.Get();
-    int32 TotalDataSize = UTF8Response.Length();
+
+    int32 CompressionThreshold = MCP_DEFAULT_COMPRESSION_THRESHOLD;
+    Params->TryGetNumberField(TEXT("compression_threshold"), CompressionThreshold);
+    NewOptions.CompressionThreshold = FMath::Max(CompressionThreshold, 0);
+
+    // Binary and compressed payloads need explicit framing; JSON can opt in
+    FString Framing;
+    Params->TryGetStringField(TEXT("framing"), Framing);
+    NewOptions.bLengthPrefixed = NewOptions.Encoding != EMCPEncoding::Json ||
+                                 !NewOptions.CompressionFormat.IsNone() ||
+                                 Framing == TEXT("length_prefixed");
+
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetStringField(TEXT("encoding"), FMCPPayloadWriter::GetEncodingName(NewOptions.Encoding));
+    ResultJson->SetStringField(TEXT("framing"), NewOptions.bLengthPrefixed ? TEXT("length_prefixed") : TEXT("none"));
+
+    TArray<TSharedPtr<FJsonValue>> SupportedEncodings;
+    SupportedEncodings.Add(MakeShared<FJsonValueString>(TEXT("json")));
+    SupportedEncodings.Add(MakeShared<FJsonValueString>(TEXT("msgpack")));
+    ResultJson->SetArrayField(TEXT("supported_encodings"), SupportedEncodings);
+
+    ResultJson->SetStringField(TEXT("compression"),
+        NewOptions.CompressionFormat == NAME_LZ4 ? TEXT("lz4") : NewOptions.CompressionFormat == NAME_Zlib ? TEXT("zlib") : TEXT("none"));
+    ResultJson->SetNumberField(TEXT("compression_threshold"), NewOptions.CompressionThreshold);
+
+    TArray<TSharedPtr<FJsonValue>> SupportedCompression;
+    SupportedCompression.Add(MakeShared<FJsonValueString>(TEXT("zlib")));
+    SupportedCompression.Add(MakeShared<FJsonValueString>(TEXT("lz4")));
+    ResultJson->SetArrayField(TEXT("supported_compression"), SupportedCompression);
+
+    FMCPConnectionSink Sink(*this, Client, Options, false);
+    TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+    Writer->WriteJsonObject(UEpicUnrealMCPBridge::MakeResponseObject(ResultJson));
+    Sink.SendFrame(*Writer);
+
+    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Connection negotiated encoding=%s framing=%s compression=%s"),
+           FMCPPayloadWriter::GetEncodingName(NewOptions.Encoding),
+           NewOptions.bLengthPrefixed ? TEXT("length_prefixed") : TEXT("none"),
+           *NewOptions.CompressionFormat.ToString());
+
+    Options = NewOptions;
+}
+
+void FMCPServerRunnable::SendError(TSharedPtr<FSocket> Client, const FMCPConnectionOptions& Options, const FString& ErrorMessage)
+{
+    FMCPConnectionSink Sink(*this, Client, Options, false);
+    TUniquePtr<FMCPPayloadWriter> Writer = Sink.MakeWriter();
+    UEpicUnrealMCPBridge::WriteError(*Writer, ErrorMessage);
+    Sink.SendFrame(*Writer);
+}
+
+bool FMCPServerRunnable::SendFrame(TSharedPtr<FSocket> Client, const FMCPConnectionOptions& Options, const TArray<uint8>& Payload, bool bNewlineDelimited)
+{
+    if (Options.bLengthPrefixed)
+    {
+        uint8 Flags = EMCPFrameFlags::None;
+        if (Options.Encoding == EMCPEncoding::MessagePack)
+        {
+            Flags |= EMCPFrameFlags::MessagePack;
+        }
+
+        const uint8* Body = Payload.GetData();
+        int32 BodySize = Payload.Num();
+
+        // Large payloads are compressed, prefixed with their uncompressed size
+        TArray<uint8> Compressed;
+        if (!Options.CompressionFormat.IsNone() && Payload.Num() >= Options.CompressionThreshold &&
+            CompressPayload(Options.CompressionFormat, Payload, Compressed))
+        {
+            Flags |= Options.CompressionFormat == NAME_LZ4 ? EMCPFrameFlags::LZ4 : EMCPFrameFlags::Zlib;
+            Body = Compressed.GetData();
+            BodySize = Compressed.Num();
+        }
+
+        // Length covers the flags byte and the body
+        const uint32 FrameLength = static_cast<uint32>(BodySize) + 1;
+        const uint8 Header[5] = {
+            static_cast<uint8>(FrameLength >> 24),
+            static_cast<uint8>(FrameLength >> 16),
+            static_cast<uint8>(FrameLength >> 8),
+            static_cast<uint8>(FrameLength),
+            Flags
+        };
+
+        return SendBytes(Client, Header, sizeof(Header)) && SendBytes(Client, Body, BodySize);
+    }
+
+    if (!SendBytes(Client, Payload.GetData(), Payload.Num()))
+    {
+        return false;
+    }
+
+    if (bNewlineDelimited)
+    {
+        const uint8 Newline = '\n';
+        return SendBytes(Client, &Newline, 1);
+    }
+    return true;
+}
+
+bool FMCPServerRunnable::CompressPayload(FName Format, const TArray<uint8>& Payload, TArray<uint8>& OutCompressed)
+{
+    const uint32 UncompressedSize = static_cast<uint32>(Payload.Num());
+    const int32 HeaderSize = 4;
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(Format, Payload.Num());
+    OutCompressed.SetNumUninitialized(HeaderSize + CompressedSize);
+    OutCompressed[0] = static_cast<uint8>(UncompressedSize >> 24);
+    OutCompressed[1] = static_cast<uint8>(UncompressedSize >> 16);
+    OutCompressed[2] = static_cast<uint8>(UncompressedSize >> 8);
+    OutCompressed[3] = static_cast<uint8>(UncompressedSize);
+
+    if (!FCompression::CompressMemory(Format, OutCompressed.GetData() + HeaderSize, CompressedSize, Payload.GetData(), Payload.Num()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: %s compression failed, sending %d bytes uncompressed"),
+               *Format.ToString(), Payload.Num());
+        return false;
+    }
+
+    // Not worth it for incompressible data
+    if (HeaderSize + CompressedSize >= Payload.Num())
+    {
+        return false;
+    }
+
+    OutCompressed.SetNum(HeaderSize + CompressedSize, EAllowShrinking::No);
+    return true;
+}
+
+bool FMCPServerRunnable::SendBytes(TSharedPtr<FSocket> Client, const uint8* Data, int32 Num)
+{
     int32 TotalBytesSent = 0;
+    double LastProgress = FPlatformTime::Seconds();
 
     // Send all data in a loop (TCP may not send everything at once)
-    while (TotalBytesSent < TotalDataSize)
+    while (TotalBytesSent < Num)
     {
         int32 BytesSent = 0;
-        if (!Client->Send(DataToSend + TotalBytesSent, TotalDataSize - TotalBytesSent, BytesSent))
+        if (!Client->Send(Data + TotalBytesSent, Num - TotalBytesSent, BytesSent))
         {
-            UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes"),
-                   TotalBytesSent, TotalDataSize);
-            return;
+            int32 LastError = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+            if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+            {
+                // A client that stopped reading, or a server shutting down, would otherwise hold this worker forever
+                if (!bRunning || FPlatformTime::Seconds() - LastProgress > MCP_CLIENT_WRITE_TIMEOUT_SECONDS)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("MCPServerRunnable: Gave up sending response after %d/%d bytes%s"),
+                           TotalBytesSent, Num, bRunning ? TEXT(" - client stopped reading") : TEXT(" - server stopping"));
+                    return false;
+                }
+                Client->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromMilliseconds(100));
+                continue;
+            }
+
+            UE_LOG(LogTemp, Error, TEXT("MCPServerRunnable: Failed to send response after %d/%d bytes - Error code: %d"),
+                   TotalBytesSent, Num, LastError);
+            return false;
         }
 
         TotalBytesSent += BytesSent;
-        UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Sent %d bytes (%d/%d total)"),
-               BytesSent, TotalBytesSent, TotalDataSize);
+        LastProgress = FPlatformTime::Seconds();
     }
 
-    UE_LOG(LogTemp, Display, TEXT("MCPServerRunnable: Response sent successfully (%d bytes)"),
-           TotalBytesSent);
-} 
\ No newline at end of file
+    UE_LOG(LogTemp, Verbose, TEXT("MCPServerRunnable: Sent %d bytes"), TotalBytesSent);
+    return true;
+}
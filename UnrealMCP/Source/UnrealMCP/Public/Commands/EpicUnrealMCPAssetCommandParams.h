@@ -0,0 +1,194 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonObjectWrapper.h"
+#include "EpicUnrealMCPAssetCommandParams.generated.h"
+
+/**
+ * Parameter structs for the asset commands, decoded by FMCPParamStructInfo.
+ * Doc comments on the properties are the tool schema descriptions.
+ */
+
+USTRUCT()
+struct FMCPUpsertDataTableRowsParams
+{
+    GENERATED_BODY()
+
+    /** DataTable asset path, e.g. /Game/Data/DT_Weapons */
+    UPROPERTY(meta = (MCPRequired))
+    FString Table;
+
+    /** Rows as {"RowName": {"Field": value, ...}, ...}; fields left out keep their current value */
+    UPROPERTY()
+    FJsonObjectWrapper Rows;
+
+    /** Rows as CSV text: a header row of field names, first column is the row name */
+    UPROPERTY()
+    FString Csv;
+
+    /** Remove all existing rows first (send with the first chunk only) */
+    UPROPERTY()
+    bool bReplace = false;
+};
+
+USTRUCT()
+struct FMCPExportDataTableParams
+{
+    GENERATED_BODY()
+
+    /** DataTable asset path */
+    UPROPERTY(meta = (MCPRequired))
+    FString Table;
+
+    /** "json" (default) or "csv" */
+    UPROPERTY()
+    FString Format = TEXT("json");
+
+    /** First row to export */
+    UPROPERTY()
+    int32 Offset = 0;
+
+    /** Maximum number of rows to export, 0 for all */
+    UPROPERTY()
+    int32 Limit = 0;
+};
+
+USTRUCT()
+struct FMCPSaveDirtyPackagesParams
+{
+    GENERATED_BODY()
+
+    /** Only save packages under this path, e.g. /Game/Generated */
+    UPROPERTY()
+    FString PathPrefix;
+
+    /** Only save packages that don't exist on disk yet (created this session) */
+    UPROPERTY()
+    bool bCreatedThisSession = false;
+
+    /** Include dirty asset packages */
+    UPROPERTY()
+    bool bIncludeContent = true;
+
+    /** Include dirty map packages */
+    UPROPERTY()
+    bool bIncludeMaps = true;
+
+    /** Serialize asset packages in parallel with the engine's concurrent save (maps are always saved one by one) */
+    UPROPERTY()
+    bool bConcurrent = false;
+
+    /** List the packages that would be saved without saving them */
+    UPROPERTY()
+    bool bDryRun = false;
+};
+
+USTRUCT()
+struct FMCPSearchAssetsParams
+{
+    GENERATED_BODY()
+
+    /** Words to match against asset names and paths; typos are tolerated */
+    UPROPERTY()
+    FString Query;
+
+    /** Asset class names to keep, e.g. ["StaticMesh", "Material"]; exact class match */
+    UPROPERTY()
+    TArray<FString> Classes;
+
+    /** Only assets under this path, e.g. /Game/Props */
+    UPROPERTY()
+    FString PathPrefix;
+
+    /** Maximum number of results */
+    UPROPERTY()
+    int32 Limit = 20;
+};
+
+USTRUCT()
+struct FMCPGenerateMeshParams
+{
+    GENERATED_BODY()
+
+    /** Shapes combined in order: {type: box|cylinder|pyramid|stairs|arch, location, rotation, scale, operation: union|subtract|append, ...}; box {size}, cylinder {radius, height, segments}, pyramid {size: [X, Y, Height], steps}, stairs {steps, step_width, step_height, step_depth}, arch {span, thickness, depth, leg_height, segments} */
+    UPROPERTY(meta = (MCPRequired))
+    TArray<FJsonObjectWrapper> Shapes;
+
+    /** Static mesh package to write, e.g. /Game/Generated/SM_Arch */
+    UPROPERTY(meta = (MCPRequired))
+    FString AssetPath;
+
+    /** Material asset path for the mesh */
+    UPROPERTY()
+    FString Material;
+
+    /** complex (default, the mesh itself), box or none */
+    UPROPERTY()
+    FString Collision = TEXT("complex");
+
+    /** Rebuild an existing static mesh at asset_path in place */
+    UPROPERTY()
+    bool bOverwrite = false;
+
+    /** Also place the mesh in the level as this StaticMeshActor; an existing one gets the new mesh */
+    UPROPERTY()
+    FString ActorName;
+
+    /** Actor location [X, Y, Z] */
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    /** Actor rotation [Pitch, Yaw, Roll] */
+    UPROPERTY()
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Group (or any actor) to attach the actor to, keeping its world transform */
+    UPROPERTY()
+    FString Parent;
+
+    /** Outliner folder for the actor */
+    UPROPERTY()
+    FString Folder;
+};
+
+USTRUCT()
+struct FMCPCreateMaterialInstancesParams
+{
+    GENERATED_BODY()
+
+    /** Instances: {name, parent, scalars: {Name: value}, vectors: {Name: [R, G, B, A]}, textures: {Name: path}, switches: {Name: bool}}; name is an asset path or a name under path */
+    UPROPERTY(meta = (MCPRequired))
+    TArray<FJsonObjectWrapper> Instances;
+
+    /** Folder for instances given by name (default /Game/Materials/Instances) */
+    UPROPERTY()
+    FString Path = TEXT("/Game/Materials/Instances");
+
+    /** Parent material for instances that don't set their own */
+    UPROPERTY()
+    FString Parent;
+
+    /** Wait for the shader compiles before returning (default false) */
+    UPROPERTY()
+    bool bWait = false;
+
+    /** Seconds to wait for compiles with wait (default 300) */
+    UPROPERTY()
+    double Timeout = 300.0;
+};
+
+USTRUCT()
+struct FMCPGetShaderCompileStatusParams
+{
+    GENERATED_BODY()
+};
+
+USTRUCT()
+struct FMCPWaitForShaderCompilesParams
+{
+    GENERATED_BODY()
+
+    /** Seconds to wait before returning with compiles still outstanding */
+    UPROPERTY()
+    double Timeout = 300.0;
+};
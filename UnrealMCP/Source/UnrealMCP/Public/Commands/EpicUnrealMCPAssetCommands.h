@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Commands/EpicUnrealMCPAssetCommandParams.h"
+
+class FMCPCommandRegistry;
+class FMCPAssetSearchIndex;
+struct FMCPStreamContext;
+
+/**
+ * Handler class for asset data MCP commands
+ * Bulk reads and writes of DataTables and other asset contents, generated meshes,
+ * batched material instances and shader compile scheduling
+ */
+class UNREALMCP_API FEpicUnrealMCPAssetCommands
+{
+public:
+    FEpicUnrealMCPAssetCommands();
+    ~FEpicUnrealMCPAssetCommands();
+
+    // Add this class's commands, with their parameter schemas, to the bridge's registry
+    void RegisterCommands(FMCPCommandRegistry& Registry);
+
+private:
+    // DataTable commands
+    TSharedPtr<FJsonObject> HandleUpsertDataTableRows(const FMCPUpsertDataTableRowsParams& Params);
+    TSharedPtr<FJsonObject> HandleExportDataTable(const FMCPExportDataTableParams& Params);
+
+    /**
+     * export_datatable in streaming mode with JSON rows (worker thread). Rows are read and
+     * encoded on the game thread one frame at a time and sent as
+     * {"stream":"items","field":"rows",...} frames, so the table is never held in one result.
+     * Returns the result for the end frame, or null once the client has gone away.
+     */
+    TSharedPtr<FJsonObject> StreamExportDataTable(const FMCPExportDataTableParams& Params, const FMCPStreamContext& Context);
+
+    // Package saving
+    TSharedPtr<FJsonObject> HandleSaveDirtyPackages(const FMCPSaveDirtyPackagesParams& Params);
+
+    // Asset search
+    TSharedPtr<FJsonObject> HandleSearchAssets(const FMCPSearchAssetsParams& Params);
+
+    // Procedural meshes
+    TSharedPtr<FJsonObject> HandleGenerateMesh(const FMCPGenerateMeshParams& Params);
+
+    // Material instances and shader compilation
+    TSharedPtr<FJsonObject> HandleCreateMaterialInstances(const FMCPCreateMaterialInstancesParams& Params);
+    TSharedPtr<FJsonObject> HandleGetShaderCompileStatus(const FMCPGetShaderCompileStatusParams& Params);
+    TSharedPtr<FJsonObject> HandleWaitForShaderCompiles(const FMCPWaitForShaderCompilesParams& Params);
+
+    // Built on the first search_assets call
+    TUniquePtr<FMCPAssetSearchIndex> SearchIndex;
+};
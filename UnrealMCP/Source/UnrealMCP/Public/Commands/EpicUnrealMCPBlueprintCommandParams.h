@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonObjectWrapper.h"
+#include "EpicUnrealMCPBlueprintCommandParams.generated.h"
+
+/**
+ * Parameter structs for the Blueprint commands, decoded by FMCPParamStructInfo.
+ * Doc comments on the properties are the tool schema descriptions.
+ */
+
+USTRUCT()
+struct FMCPCreateBlueprintVariantParams
+{
+    GENERATED_BODY()
+
+    /** Blueprint to duplicate, by name or asset path */
+    UPROPERTY(meta = (MCPRequired))
+    FString Template;
+
+    /** Name of the new Blueprint */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Content folder for the new Blueprint */
+    UPROPERTY()
+    FString Path = TEXT("/Game/Blueprints");
+
+    /** Component overrides as {"ComponentName": {"Property.Path": value, ...}, ...} */
+    UPROPERTY()
+    FJsonObjectWrapper Components;
+
+    /** Class default overrides as {"Property.Path": value, ...} */
+    UPROPERTY()
+    FJsonObjectWrapper Defaults;
+
+    /** Material colors as {"ComponentName": [R, G, B, A], ...}, set through a dynamic material instance */
+    UPROPERTY()
+    FJsonObjectWrapper Colors;
+
+    /** Vector parameter the colors are written to */
+    UPROPERTY()
+    FString ColorParameter = TEXT("BaseColor");
+
+    /** Material slot the colors are applied to */
+    UPROPERTY()
+    int32 MaterialSlot = 0;
+
+    /** Return an existing Blueprint with this name unchanged instead of failing */
+    UPROPERTY()
+    bool bReuseExisting = false;
+
+    /** Recompile the new Blueprint even though overrides only change defaults */
+    UPROPERTY()
+    bool bCompile = false;
+};
@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "Commands/EpicUnrealMCPBlueprintCommandParams.h"
+
+class FMCPCommandRegistry;
 
 /**
  * Handler class for Blueprint-related MCP commands
@@ -14,15 +17,23 @@ public:
     // Handle blueprint commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Add this class's commands, with their parameter schemas, to the bridge's registry
+    void RegisterCommands(FMCPCommandRegistry& Registry);
+
 private:
     // Specific blueprint command handlers (only used functions)
     TSharedPtr<FJsonObject> HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleAddComponentToBlueprint(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleDefineComponents(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetPhysicsProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleCompileBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleSpawnBlueprintActors(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetStaticMeshProperties(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleSetMeshMaterialColor(const TSharedPtr<FJsonObject>& Params);
+
+    // Duplicate a template Blueprint and apply default overrides in one step
+    TSharedPtr<FJsonObject> HandleCreateBlueprintVariant(const FMCPCreateBlueprintVariantParams& Params);
     
     // Material management functions
     TSharedPtr<FJsonObject> HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params);
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class FMCPCommandRegistry;
+
 class FEpicUnrealMCPBlueprintGraphCommands
 {
 public:
@@ -19,6 +21,9 @@ public:
      */
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Add this class's commands, with their parameter schemas, to the bridge's registry
+    void RegisterCommands(FMCPCommandRegistry& Registry);
+
 private:
     // Add node to Blueprint graph
     TSharedPtr<FJsonObject> HandleAddBlueprintNode(const TSharedPtr<FJsonObject>& Params);
@@ -5,6 +5,7 @@
 
 // Forward declarations
 class AActor;
+class UWorld;
 class UBlueprint;
 class UEdGraph;
 class UEdGraphNode;
@@ -31,10 +32,16 @@ public:
     static FVector2D GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FVector GetVectorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
     static FRotator GetRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName);
+    // Rows of [x, y, z], [x, y, z, pitch, yaw, roll] or [..., sx, sy, sz] (or location/rotation/scale objects); false if malformed
+    static bool GetTransformArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<FTransform>& OutTransforms);
     
-    // Actor utilities
+    // Actor utilities (bulk listings encode FMCPActorRecord copies instead, see MCPActorRecord.h)
     static TSharedPtr<FJsonValue> ActorToJson(AActor* Actor);
     static TSharedPtr<FJsonObject> ActorToJsonObject(AActor* Actor, bool bDetailed = false);
+    static AActor* FindActorByName(UWorld* World, const FString& ActorName);
+    // Attach Actor under Parent keeping its world transform (if Parent is set) and move it to Folder (if not empty).
+    // The actor's root is made as mobile as the parent's first; false if the attachment was still refused
+    static bool AddActorToGroup(AActor* Actor, AActor* Parent, const FString& Folder);
     
     // Blueprint utilities
     static UBlueprint* FindBlueprint(const FString& BlueprintName);
@@ -53,7 +60,7 @@ public:
     static UEdGraphPin* FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction = EGPD_MAX);
     static UK2Node_Event* FindExistingEventNode(UEdGraph* Graph, const FString& EventName);
 
-    // Property utilities
+    // Property utilities (PropertyName may be a dotted path, see FMCPPropertyPath)
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
 }; 
\ No newline at end of file
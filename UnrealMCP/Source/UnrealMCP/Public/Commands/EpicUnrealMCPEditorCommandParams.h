@@ -0,0 +1,384 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "JsonObjectWrapper.h"
+#include "EpicUnrealMCPEditorCommandParams.generated.h"
+
+/**
+ * Parameter structs for the editor actor commands, decoded by FMCPParamStructInfo.
+ * Doc comments on the properties are the tool schema descriptions.
+ */
+
+USTRUCT()
+struct FMCPGetActorsInLevelParams
+{
+    GENERATED_BODY()
+
+    /** Include each actor's world bounding box */
+    UPROPERTY()
+    bool bIncludeBounds = false;
+
+    /** Only list actors attached, directly or indirectly, under this group actor */
+    UPROPERTY()
+    FString Group;
+
+    /** Only list actors of this class or a subclass, e.g. "StaticMeshActor", "Light" or a Blueprint name */
+    UPROPERTY()
+    FString ClassName;
+
+    /** Only list actors in this outliner folder or one of its subfolders */
+    UPROPERTY()
+    FString Folder;
+
+    /** Only list actors that have all of these tags */
+    UPROPERTY()
+    TArray<FString> Tags;
+};
+
+USTRUCT()
+struct FMCPFindActorsByNameParams
+{
+    GENERATED_BODY()
+
+    /** Substring to match against actor names */
+    UPROPERTY(meta = (MCPRequired))
+    FString Pattern;
+
+    /** Include each actor's world bounding box */
+    UPROPERTY()
+    bool bIncludeBounds = false;
+
+    /** Only list actors attached, directly or indirectly, under this group actor */
+    UPROPERTY()
+    FString Group;
+
+    /** Only list actors of this class or a subclass, e.g. "StaticMeshActor", "Light" or a Blueprint name */
+    UPROPERTY()
+    FString ClassName;
+
+    /** Only list actors in this outliner folder or one of its subfolders */
+    UPROPERTY()
+    FString Folder;
+
+    /** Only list actors that have all of these tags */
+    UPROPERTY()
+    TArray<FString> Tags;
+};
+
+USTRUCT()
+struct FMCPSpawnActorParams
+{
+    GENERATED_BODY()
+
+    /** Unique actor name */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Actor class to spawn */
+    UPROPERTY(meta = (MCPRequired))
+    FString Type;
+
+    /** World location [X, Y, Z] */
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    /** Rotation [Pitch, Yaw, Roll] in degrees */
+    UPROPERTY()
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Scale [X, Y, Z] */
+    UPROPERTY()
+    FVector Scale = FVector::OneVector;
+
+    /** Mesh asset path for StaticMeshActor */
+    UPROPERTY()
+    FString StaticMesh;
+
+    /** Group (or any actor) to attach the new actor to, keeping its world transform */
+    UPROPERTY()
+    FString Parent;
+
+    /** Outliner folder for the new actor */
+    UPROPERTY()
+    FString Folder;
+};
+
+USTRUCT()
+struct FMCPDeleteActorParams
+{
+    GENERATED_BODY()
+
+    /** Actor name */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Also delete every actor attached under it, e.g. all parts of a group */
+    UPROPERTY()
+    bool bIncludeAttached = false;
+};
+
+USTRUCT()
+struct FMCPCreateGroupParams
+{
+    GENERATED_BODY()
+
+    /** Unique name of the group actor */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Pivot of the group [X, Y, Z]; parts keep their world transforms when attached */
+    UPROPERTY()
+    FVector Location = FVector::ZeroVector;
+
+    /** Rotation [Pitch, Yaw, Roll] in degrees */
+    UPROPERTY()
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Outliner folder for the group actor */
+    UPROPERTY()
+    FString Folder;
+};
+
+USTRUCT()
+struct FMCPSetActorHiddenParams
+{
+    GENERATED_BODY()
+
+    /** Actor or group name */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Hide (true) or show (false) */
+    UPROPERTY()
+    bool bHidden = true;
+
+    /** Apply to every actor attached under it as well */
+    UPROPERTY()
+    bool bIncludeAttached = true;
+
+    /** Also set the in-game hidden flag, which is saved with the level; otherwise only the editor viewport is affected */
+    UPROPERTY()
+    bool bInGame = false;
+};
+
+USTRUCT()
+struct FMCPSetActorTransformParams
+{
+    GENERATED_BODY()
+
+    /** Actor name */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** World location [X, Y, Z] */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasLocation"))
+    FVector Location = FVector::ZeroVector;
+
+    /** Rotation [Pitch, Yaw, Roll] in degrees */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasRotation"))
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Scale [X, Y, Z] */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasScale"))
+    FVector Scale = FVector::OneVector;
+
+    UPROPERTY()
+    bool bHasLocation = false;
+
+    UPROPERTY()
+    bool bHasRotation = false;
+
+    UPROPERTY()
+    bool bHasScale = false;
+};
+
+USTRUCT()
+struct FMCPGetPropertiesParams
+{
+    GENERATED_BODY()
+
+    /** Names of the actors to read */
+    UPROPERTY()
+    TArray<FString> Actors;
+
+    /** Blueprints (name or path) whose class defaults to read */
+    UPROPERTY()
+    TArray<FString> Blueprints;
+
+    /** Dotted property paths, e.g. "StaticMeshComponent.BodyInstance.bSimulatePhysics" or "Tags[0]" */
+    UPROPERTY(meta = (MCPRequired))
+    TArray<FString> Paths;
+};
+
+USTRUCT()
+struct FMCPSetPropertiesParams
+{
+    GENERATED_BODY()
+
+    /** Names of the actors to modify */
+    UPROPERTY()
+    TArray<FString> Actors;
+
+    /** Blueprints (name or path) whose class defaults to modify */
+    UPROPERTY()
+    TArray<FString> Blueprints;
+
+    /** Map of dotted property path to new value, applied to every target */
+    UPROPERTY(meta = (MCPRequired))
+    FJsonObjectWrapper Properties;
+};
+
+USTRUCT()
+struct FMCPSpawnSplineMeshParams
+{
+    GENERATED_BODY()
+
+    /** Unique actor name */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** World-space control points, rows of [X, Y, Z]; at least 2 */
+    UPROPERTY(meta = (MCPRequired))
+    TArray<FVector> Points;
+
+    /** Mesh deformed along the spline (default /Engine/BasicShapes/Cube.Cube) */
+    UPROPERTY()
+    FString StaticMesh = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+    /** Mesh axis laid along the spline: x (default), y or z, e.g. z for the engine cylinder */
+    UPROPERTY()
+    FString ForwardAxis = TEXT("x");
+
+    /** Material asset path for the mesh */
+    UPROPERTY()
+    FString Material;
+
+    /** Cross-section width in cm (default: the mesh's own size) */
+    UPROPERTY()
+    double Width = 0.0;
+
+    /** Cross-section height in cm (default: the mesh's own size) */
+    UPROPERTY()
+    double Height = 0.0;
+
+    /** curve (default, smooth through the points) or linear (straight runs with corners) */
+    UPROPERTY()
+    FString CurveType = TEXT("curve");
+
+    /** Join the last point back to the first */
+    UPROPERTY()
+    bool bClosed = false;
+
+    /** Split the spline into mesh pieces of about this length; default one piece per pair of points */
+    UPROPERTY()
+    double SegmentLength = 0.0;
+
+    /** center (default) centers the mesh on the spline; bottom rests it on the spline, for walls and roads */
+    UPROPERTY()
+    FString Align = TEXT("center");
+
+    /** Give the mesh pieces collision (default true) */
+    UPROPERTY()
+    bool bCollision = true;
+
+    /** Group (or any actor) to attach the new actor to, keeping its world transform */
+    UPROPERTY()
+    FString Parent;
+
+    /** Outliner folder for the new actor */
+    UPROPERTY()
+    FString Folder;
+};
+
+USTRUCT()
+struct FMCPRunGeneratorParams
+{
+    GENERATED_BODY()
+
+    /** Registered generator name (e.g. castle, town, mansion) */
+    UPROPERTY(meta = (MCPRequired))
+    FString Generator;
+
+    /** Keyword arguments for the generator */
+    UPROPERTY()
+    FJsonObjectWrapper Arguments;
+
+    /** Reimport the generator modules under the configured GeneratorScriptRoot, picking up edits */
+    UPROPERTY()
+    bool bReload = false;
+};
+
+USTRUCT()
+struct FMCPExecutePCGGraphParams
+{
+    GENERATED_BODY()
+
+    /** Volume (or any actor with a PCG component) to generate on; a PCG volume is created if missing */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** PCG graph asset path; required when the component has no graph yet */
+    UPROPERTY()
+    FString Graph;
+
+    /** Volume center [X, Y, Z] */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasLocation"))
+    FVector Location = FVector::ZeroVector;
+
+    /** Volume size [X, Y, Z] in cm (default 1000 for a new volume) */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasSize"))
+    FVector Size = FVector(1000.0);
+
+    /** Graph user parameter overrides, {name: value}; vectors and rotators as [X, Y, Z] / [Pitch, Yaw, Roll] */
+    UPROPERTY()
+    FJsonObjectWrapper Parameters;
+
+    /** Component seed */
+    UPROPERTY(meta = (MCPPresentFlag = "bHasSeed"))
+    int32 Seed = 0;
+
+    /** Start generating after updating (default true); false only reports what was generated last */
+    UPROPERTY()
+    bool bGenerate = true;
+
+    /** Group (or any actor) to attach a new volume to, keeping its world transform */
+    UPROPERTY()
+    FString Parent;
+
+    /** Outliner folder for a new volume */
+    UPROPERTY()
+    FString Folder;
+
+    UPROPERTY()
+    bool bHasLocation = false;
+
+    UPROPERTY()
+    bool bHasSize = false;
+
+    UPROPERTY()
+    bool bHasSeed = false;
+};
+
+USTRUCT()
+struct FMCPGetPCGGenerationStatusParams
+{
+    GENERATED_BODY()
+
+    /** Actor execute_pcg_graph generated on */
+    UPROPERTY(meta = (MCPRequired))
+    FString Name;
+
+    /** Cancel the generation if it is still running */
+    UPROPERTY()
+    bool bCancel = false;
+};
+
+USTRUCT()
+struct FMCPGetEditorStatsParams
+{
+    GENERATED_BODY()
+
+    /** Run a full garbage collection first, so memory figures are comparable between calls */
+    UPROPERTY()
+    bool bCollectGarbage = false;
+};
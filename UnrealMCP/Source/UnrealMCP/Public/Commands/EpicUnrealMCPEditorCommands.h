@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Json.h"
+#include "Commands/EpicUnrealMCPEditorCommandParams.h"
+
+class FMCPCommandRegistry;
 
 /**
  * Handler class for Editor-related MCP commands
@@ -15,14 +18,38 @@ public:
     // Handle editor commands
     TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+    // Add this class's commands, with their parameter schemas, to the bridge's registry
+    void RegisterCommands(FMCPCommandRegistry& Registry);
+
 private:
     // Actor manipulation commands
-    TSharedPtr<FJsonObject> HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleFindActorsByName(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleSpawnActor(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleDeleteActor(const TSharedPtr<FJsonObject>& Params);
-    TSharedPtr<FJsonObject> HandleSetActorTransform(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetActorsInLevel(const FMCPGetActorsInLevelParams& Params);
+    TSharedPtr<FJsonObject> HandleFindActorsByName(const FMCPFindActorsByNameParams& Params);
+    TSharedPtr<FJsonObject> HandleSpawnActor(const FMCPSpawnActorParams& Params);
+    TSharedPtr<FJsonObject> HandleDeleteActor(const FMCPDeleteActorParams& Params);
+    TSharedPtr<FJsonObject> HandleSetActorTransform(const FMCPSetActorTransformParams& Params);
+
+    // Groups: a root actor that generated parts are attached under
+    TSharedPtr<FJsonObject> HandleCreateGroup(const FMCPCreateGroupParams& Params);
+    TSharedPtr<FJsonObject> HandleSetActorHidden(const FMCPSetActorHiddenParams& Params);
+
+    // Reflection property access on actors and Blueprint class defaults
+    TSharedPtr<FJsonObject> HandleGetProperties(const FMCPGetPropertiesParams& Params);
+    TSharedPtr<FJsonObject> HandleSetProperties(const FMCPSetPropertiesParams& Params);
+
+    // Editor memory and level statistics, for benchmarks
+    TSharedPtr<FJsonObject> HandleGetEditorStats(const FMCPGetEditorStatsParams& Params);
 
     // Blueprint actor spawning
     TSharedPtr<FJsonObject> HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params);
+
+    // One actor with a mesh deformed along a spline through many points
+    TSharedPtr<FJsonObject> HandleSpawnSplineMesh(const FMCPSpawnSplineMeshParams& Params);
+
+    // Generator scripts run in the editor's Python
+    TSharedPtr<FJsonObject> HandleRunGenerator(const FMCPRunGeneratorParams& Params);
+
+    // PCG graphs generated on a volume, for high-volume scattering
+    TSharedPtr<FJsonObject> HandleExecutePCGGraph(const FMCPExecutePCGGraphParams& Params);
+    TSharedPtr<FJsonObject> HandleGetPCGGenerationStatus(const FMCPGetPCGGenerationStatusParams& Params);
 }; 
\ No newline at end of file
@@ -11,9 +11,17 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPBlueprintGraphCommands.h"
+#include "Commands/EpicUnrealMCPAssetCommands.h"
+#include "MCPActorSnapshot.h"
+#include "MCPPayloadWriter.h"
+#include "MCPCommandRegistry.h"
+#include "MCPRequestParser.h"
+#include "MCPProgress.h"
 #include "EpicUnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
+class FMCPHttpEndpoint;
+class FStructOnScope;
 
 /**
  * Editor subsystem for MCP Bridge
@@ -39,10 +47,49 @@ public:
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
 
-	// Command execution
+	// Command execution (any thread except the game thread); writes one response frame to the sink
+	void ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, IMCPResponseSink& Sink,
+	                    const TSharedPtr<FMCPBulkParams>& Bulk = nullptr);
+	// Same, returning the JSON response text
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Execute a command in streaming mode (any thread except the game thread).
+	 * While the handler runs, its FMCPProgressChannel reports are sent as
+	 * {"stream":"progress","done":...,"total":...,"message":...} frames.
+	 * Top-level arrays of the result are sent as {"stream":"items","field":...,"items":[...]}
+	 * frames of at most ChunkSize items, followed by the usual response envelope
+	 * marked with "stream":"end" whose result lists the streamed item counts.
+	 * Commands with a registered streaming handler (export_datatable) send their items themselves instead.
+	 */
+	void ExecuteCommandStreaming(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 ChunkSize, IMCPResponseSink& Sink,
+	                             const TSharedPtr<FMCPBulkParams>& Bulk = nullptr);
+
+	/**
+	 * Run a registered command's handler directly (game thread only). Bulk holds fields
+	 * packed by FMCPRequestParser; TypedParams is the already decoded parameter struct
+	 * of a typed command, decoded here when null. In-process callers issuing many
+	 * commands in a row skip bPublishSnapshot and let the enclosing command publish once.
+	 */
+	TSharedPtr<FJsonObject> ExecuteCommandOnGameThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+	                                                   const FMCPBulkParams* Bulk = nullptr, const FStructOnScope* TypedParams = nullptr,
+	                                                   bool bPublishSnapshot = true);
+
+	const FMCPCommandRegistry& GetCommandRegistry() const { return CommandRegistry; }
+
+	// Wrap a handler result in the status/result envelope
+	static TSharedPtr<FJsonObject> MakeResponseObject(const TSharedPtr<FJsonObject>& ResultJson);
+	static void WriteError(FMCPPayloadWriter& Writer, const FString& ErrorMessage, bool bStreamEnd = false);
+
 private:
+	// Run a command on the game thread and wait for its result object, sending its progress reports to ProgressSink if given
+	TSharedPtr<FJsonObject> ExecuteCommandAndWait(const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+	                                              const TSharedPtr<FMCPBulkParams>& Bulk, const TSharedPtr<FStructOnScope>& TypedParams,
+	                                              FString& OutError, IMCPResponseSink* ProgressSink = nullptr);
+
+	// Run a task on the game thread and wait for it; false if the server began shutting down first
+	bool RunOnGameThreadAndWait(TFunction<void()> Task);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
@@ -57,4 +104,14 @@ private:
 	TSharedPtr<FEpicUnrealMCPEditorCommands> EditorCommands;
 	TSharedPtr<FEpicUnrealMCPBlueprintCommands> BlueprintCommands;
 	TSharedPtr<FEpicUnrealMCPBlueprintGraphCommands> BlueprintGraphCommands;
+	TSharedPtr<FEpicUnrealMCPAssetCommands> AssetCommands;
+
+	// Every command the handlers above expose, with its parameter schema
+	FMCPCommandRegistry CommandRegistry;
+
+	// MCP JSON-RPC endpoint serving the registry directly over HTTP
+	TSharedPtr<FMCPHttpEndpoint> HttpEndpoint;
+
+	// Plain-data copy of the level used to answer read-only queries on the server thread
+	TSharedPtr<FMCPActorSnapshot> ActorSnapshot;
 }; 
\ No newline at end of file
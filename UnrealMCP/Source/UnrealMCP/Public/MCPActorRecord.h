@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class FMCPPayloadWriter;
+
+/**
+ * Plain-data copy of a level actor.
+ * Contains no UObject pointers so it can be read and encoded on any thread.
+ */
+struct UNREALMCP_API FMCPActorRecord
+{
+	FName Name;
+	FName ClassName;
+	// Actor this one is attached to, None for top-level actors
+	FName Parent;
+	// Outliner folder, None at the root
+	FName FolderPath;
+	TArray<FName> Tags;
+	FTransform Transform;
+	FBox Bounds = FBox(ForceInit);
+
+	// Copy the actor's state (game thread)
+	static FMCPActorRecord Capture(const AActor* Actor);
+
+	// Write this record as an object with the same fields as FEpicUnrealMCPCommonUtils::ActorToJsonObject
+	void Write(FMCPPayloadWriter& Writer, bool bIncludeBounds) const;
+
+	/**
+	 * Write the records as an array.
+	 * Large arrays are split into chunks that are encoded in parallel into
+	 * fragment writers and then appended in order.
+	 */
+	static void WriteArray(FMCPPayloadWriter& Writer, TConstArrayView<FMCPActorRecord> Records, bool bIncludeBounds);
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Containers/Ticker.h"
+#include "MCPActorRecord.h"
+#include "MCPPayloadWriter.h"
+
+class AActor;
+class UWorld;
+struct FPropertyChangedEvent;
+
+/**
+ * One published version of the level's actor table.
+ * The secondary indexes map a key to the ascending indices of the matching records,
+ * so a query on several keys is answered by intersecting their lists.
+ */
+struct FMCPActorTable
+{
+	TArray<FMCPActorRecord> Actors;
+	uint64 Version = 0;
+	double PublishTime = 0.0;
+
+	// Records by class name, including every parent class up to AActor
+	TMap<FName, TArray<int32>> ByClass;
+	// Records by outliner folder, including every parent folder
+	TMap<FName, TArray<int32>> ByFolder;
+	// Records by actor tag
+	TMap<FName, TArray<int32>> ByTag;
+	// Records by the name of the actor they are attached to
+	TMap<FName, TArray<int32>> ByParent;
+	// Record of each actor name, for updating single records in place
+	TMap<FName, int32> ByName;
+
+	void Reset();
+
+	// Capture the actor as the next record and add it to the indexes (game thread)
+	void Add(const AActor* Actor);
+
+	// Recapture an existing record in place, moving it in ByParent if its attachment changed (game thread)
+	void Update(int32 RecordIndex, const AActor* Actor);
+};
+
+/**
+ * Double-buffered snapshot of the editor world's actor table.
+ * The game thread builds the back buffer whenever the level changes and
+ * swaps it to the front; the server thread reads the front buffer to answer
+ * read-only queries without waiting for a game thread hop.
+ * Moves, attachments and new actors patch the changed records into the back
+ * buffer, which is brought up to date with the previous publish's changes first;
+ * only deletions and index changes (folders, tags, map loads) and the periodic
+ * refresh walk the whole level.
+ */
+class UNREALMCP_API FMCPActorSnapshot
+{
+public:
+	FMCPActorSnapshot();
+	~FMCPActorSnapshot();
+
+	// Register editor delegates and the publish ticker (game thread)
+	void Start();
+	void Stop();
+
+	// Rebuild and publish the table if the level changed since the last publish (game thread)
+	void PublishIfDirty();
+
+	// Get the most recently published table (any thread)
+	TSharedPtr<const FMCPActorTable, ESPMode::ThreadSafe> GetTable() const;
+
+	// Whether a command can be answered from the snapshot
+	static bool IsReadOnlyCommand(const FString& CommandType);
+
+	/**
+	 * Record that a command moved or edited Actor, along with everything attached under it (game thread).
+	 * Handlers call this after changes no editor delegate reports, such as SetActorTransform or property writes.
+	 */
+	static void NotifyActorChanged(AActor* Actor);
+
+	/**
+	 * Answer a read-only command from the published table (any thread)
+	 * @param Writer - Receives the complete response envelope; untouched when returning false
+	 * @return False if the snapshot can't serve the command yet
+	 */
+	bool ExecuteReadOnlyCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPPayloadWriter& Writer) const;
+
+	/**
+	 * Stream a read-only command's actors as item frames of at most ChunkSize records,
+	 * followed by a final summary frame (any thread)
+	 * @return False if the snapshot can't serve the command yet; nothing has been sent in that case
+	 */
+	bool StreamReadOnlyCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, int32 ChunkSize, IMCPResponseSink& Sink) const;
+
+private:
+	bool Tick(float DeltaTime);
+	void Publish();
+	void MarkDirty();
+
+	/**
+	 * Turn Back into the front table plus ChangedActors and AddedActors
+	 * @param bBackLagsFront - Back is the previous front, missing only the last publish's changes; otherwise it is copied from the front
+	 * @return False if a full rebuild is needed
+	 */
+	bool ApplyChanges(FMCPActorTable& Back, bool bBackLagsFront) const;
+
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorChanged(AActor* Actor);
+	void OnActorAttachmentChanged(AActor* Actor, const AActor* Parent);
+	void OnActorFolderChanged(const AActor* Actor, FName OldPath);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+	void OnMapChanged(uint32 MapChangeFlags);
+
+	// Front and back buffers; readers hold a reference to the front while they read it
+	TSharedPtr<FMCPActorTable, ESPMode::ThreadSafe> Buffers[2];
+	int32 FrontIndex;
+	mutable FCriticalSection SwapLock;
+
+	uint64 NextVersion;
+	// The whole table must be rebuilt
+	bool bDirty;
+	double LastPublishTime;
+
+	// Actors whose records changed in place (moved, attached) and new actors, since the last publish
+	TSet<TWeakObjectPtr<const AActor>> ChangedActors;
+	TSet<TWeakObjectPtr<const AActor>> AddedActors;
+
+	// Changes the last incremental publish applied, which the back buffer (the previous front) still lacks
+	TSet<TWeakObjectPtr<const AActor>> LastChangedActors;
+	TSet<TWeakObjectPtr<const AActor>> LastAddedActors;
+	// False after a rebuild, when the back buffer has to be copied from the front
+	bool bBackLagsFront;
+
+	// The started snapshot that NotifyActorChanged reports to
+	static FMCPActorSnapshot* Active;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorAttachedHandle;
+	FDelegateHandle ActorDetachedHandle;
+	FDelegateHandle ActorFolderChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+};
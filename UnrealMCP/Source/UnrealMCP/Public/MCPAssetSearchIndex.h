@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/TopLevelAssetPath.h"
+
+struct FAssetData;
+
+/**
+ * One ranked search_assets hit
+ */
+struct FMCPAssetSearchHit
+{
+	FTopLevelAssetPath ObjectPath;
+	FTopLevelAssetPath ClassPath;
+	float Score = 0.0f;
+};
+
+/**
+ * In-memory trigram index over the asset registry's object paths.
+ * Built from the registry once, on the first search, then kept current from the
+ * registry's added/removed/renamed events, so queries never enumerate the registry.
+ * Each asset's lowercased path is split into trigrams with one posting list per
+ * trigram; a query scores the assets that share at least half of its trigrams, which
+ * tolerates typos, then ranks them by overlap and by how well the asset name matches.
+ * Game thread only.
+ */
+class UNREALMCP_API FMCPAssetSearchIndex
+{
+public:
+	FMCPAssetSearchIndex();
+	~FMCPAssetSearchIndex();
+
+	// Drop the index and unregister the registry delegates
+	void Stop();
+
+	/**
+	 * Rank assets against a free-text query; whitespace separates terms
+	 * @param ClassFilters - Asset class names (e.g. "StaticMesh") or class paths to keep; empty keeps all
+	 * @param PathPrefix - Only assets whose package path starts with this, case-insensitive
+	 * @param OutTotalMatches - Number of matching assets before Limit was applied
+	 */
+	void Search(const FString& Query, const TArray<FString>& ClassFilters, const FString& PathPrefix, int32 Limit,
+		TArray<FMCPAssetSearchHit>& OutHits, int32& OutTotalMatches);
+
+	int32 NumAssets() const { return Entries.Num() - NumRemoved; }
+
+private:
+	struct FEntry
+	{
+		FTopLevelAssetPath ObjectPath;
+		// Lowercased package name, plus ".assetname" when the asset isn't named after its package
+		FString Text;
+		// Offset of the asset name within Text
+		int32 NameStart = 0;
+		int32 ClassIndex = INDEX_NONE;
+		bool bRemoved = false;
+	};
+
+	void Build();
+	void Compact();
+	void AddEntry(const FTopLevelAssetPath& ObjectPath, const FTopLevelAssetPath& ClassPath);
+	void RemoveEntry(const FTopLevelAssetPath& ObjectPath);
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	float ScoreEntry(const FEntry& Entry, const TArray<FString>& Terms, int32 MatchedTrigrams, int32 QueryTrigrams) const;
+
+	TArray<FEntry> Entries;
+	TMap<FTopLevelAssetPath, int32> EntryIndices;
+	int32 NumRemoved;
+
+	// Trigram -> ascending entry indices; removed entries stay until the next Compact
+	TMap<uint64, TArray<int32>> Postings;
+
+	TArray<FTopLevelAssetPath> Classes;
+	TMap<FTopLevelAssetPath, int32> ClassIndices;
+
+	// Per-entry trigram hit counts, reused across searches
+	TArray<uint16> Counts;
+	TArray<int32> Touched;
+
+	bool bBuilt;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+};
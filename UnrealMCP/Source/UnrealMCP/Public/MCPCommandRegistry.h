@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class FMCPBulkParams;
+class FMCPParamStructInfo;
+class FStructOnScope;
+class IMCPResponseSink;
+
+/**
+ * JSON type of a command parameter, used to generate tool input schemas
+ */
+enum class EMCPParamType : uint8
+{
+	String,
+	Number,
+	Integer,
+	Boolean,
+	Object,
+	Array,
+	// [X, Y, Z] array of three numbers
+	Vector,
+	// Bulk numbers, flat or as equal-length rows; decoded into FMCPPackedArray without a DOM
+	NumberArray
+};
+
+struct FMCPParamSpec
+{
+	FString Name;
+	EMCPParamType Type;
+	bool bRequired;
+	FString Description;
+};
+
+// Runs a command on the game thread and returns its result object (CreateErrorResponse on failure)
+typedef TFunction<TSharedPtr<FJsonObject>(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)> FMCPCommandHandler;
+
+// Same for commands with a USTRUCT parameter type; Params points at a decoded instance of that struct
+typedef TFunction<TSharedPtr<FJsonObject>(const void* Params)> FMCPTypedCommandHandler;
+
+// What a streaming handler sends through, on the server's worker thread
+struct FMCPStreamContext
+{
+	// Most items per frame
+	int32 ChunkSize;
+	IMCPResponseSink& Sink;
+	// Run a task on the game thread and wait for it; false if the server began shutting down first
+	TFunctionRef<bool(TFunction<void()>)> RunOnGameThread;
+};
+
+/**
+ * Sends a typed command's result as item frames itself in streaming mode (worker thread),
+ * instead of the bridge splitting the arrays of a complete result.
+ * Returns false to decline, leaving the command to run normally; otherwise OutResult is
+ * the result for the end frame, or null once the client has gone away.
+ */
+typedef TFunction<bool(const void* Params, const FMCPStreamContext& Context, TSharedPtr<FJsonObject>& OutResult)> FMCPStreamingHandler;
+
+struct FMCPCommandSpec
+{
+	FString Name;
+	FString Description;
+	TArray<FMCPParamSpec> Params;
+	FMCPCommandHandler Handler;
+
+	// Set instead of Handler for commands registered with RegisterTyped
+	TSharedPtr<const FMCPParamStructInfo> ParamStruct;
+	FMCPTypedCommandHandler TypedHandler;
+
+	// Optional, for typed commands that stream large results a frame at a time
+	FMCPStreamingHandler StreamingHandler;
+
+	// JSON schema for Params, built once at registration
+	TSharedPtr<FJsonObject> InputSchema;
+};
+
+/**
+ * Table of every command the bridge can execute.
+ * Command handler classes register their commands with a description and
+ * parameter list, so the same table routes TCP requests and describes the
+ * tools served over the MCP HTTP endpoint.
+ * Commands registered with RegisterTyped declare their parameters as a
+ * USTRUCT instead; the struct's reflection data gives both the schema and a
+ * decoder that validates requests before they reach the game thread.
+ * Filled in when the bridge is constructed and read-only afterwards.
+ */
+class UNREALMCP_API FMCPCommandRegistry
+{
+public:
+	void Register(const FString& Name, const FString& Description, TArray<FMCPParamSpec> Params, FMCPCommandHandler Handler);
+
+	template <typename TParams>
+	void RegisterTyped(const FString& Name, const FString& Description, TFunction<TSharedPtr<FJsonObject>(const TParams&)> Handler)
+	{
+		RegisterStruct(Name, Description, TParams::StaticStruct(), [Handler = MoveTemp(Handler)](const void* Params)
+		{
+			return Handler(*static_cast<const TParams*>(Params));
+		});
+	}
+
+	// Give a command registered with RegisterTyped<TParams> its own streaming mode, see FMCPStreamingHandler
+	template <typename TParams>
+	void SetStreamingHandler(const FString& Name, TFunction<bool(const TParams&, const FMCPStreamContext&, TSharedPtr<FJsonObject>&)> Handler)
+	{
+		SetStructStreamingHandler(Name, TParams::StaticStruct(), [Handler = MoveTemp(Handler)](const void* Params, const FMCPStreamContext& Context, TSharedPtr<FJsonObject>& OutResult)
+		{
+			return Handler(*static_cast<const TParams*>(Params), Context, OutResult);
+		});
+	}
+
+	const FMCPCommandSpec* Find(const FString& Name) const;
+
+	/**
+	 * Decode the params of a typed command (any thread). Bulk holds the fields the
+	 * request parser packed out of Params, if any. OutTypedParams stays null for
+	 * commands registered with plain JSON handlers or not registered at all.
+	 * Returns false with OutError set when the params don't match the struct.
+	 */
+	bool DecodeParams(const FString& Name, const TSharedPtr<FJsonObject>& Params, const FMCPBulkParams* Bulk,
+	                  TSharedPtr<FStructOnScope>& OutTypedParams, FString& OutError) const;
+
+	// Commands in registration order
+	const TArray<FMCPCommandSpec>& GetCommands() const { return Commands; }
+
+	static TSharedPtr<FJsonObject> MakeInputSchema(const TArray<FMCPParamSpec>& Params);
+
+private:
+	void RegisterStruct(const FString& Name, const FString& Description, const UScriptStruct* ParamsStruct, FMCPTypedCommandHandler Handler);
+	void SetStructStreamingHandler(const FString& Name, const UScriptStruct* ParamsStruct, FMCPStreamingHandler Handler);
+
+	TArray<FMCPCommandSpec> Commands;
+	TMap<FString, int32> CommandIndices;
+
+	// Field maps of parameter structs, shared by every command using the same struct
+	TMap<const UScriptStruct*, TSharedPtr<const FMCPParamStructInfo>> ParamStructs;
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "MCPGeneratorLibrary.generated.h"
+
+/**
+ * One static mesh actor for UMCPGeneratorLibrary::SpawnStaticMeshActors
+ */
+USTRUCT(BlueprintType)
+struct UNREALMCP_API FMCPGeneratorActor
+{
+	GENERATED_BODY()
+
+	// Requested name; a taken name gets a suffix
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FString Name;
+
+	// Static mesh asset path; empty leaves the actor without a mesh
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FString StaticMesh;
+
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FVector Scale = FVector::OneVector;
+
+	// Group actor to attach to, keeping the world transform
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FString Parent;
+
+	// Outliner folder
+	UPROPERTY(BlueprintReadWrite, Category = "MCP")
+	FString Folder;
+};
+
+/**
+ * Editor-side API for generator scripts run by the run_generator command.
+ * The scripts run inside the editor's Python (unreal.MCPGeneratorLibrary) and
+ * reach the same command handlers as the TCP bridge without a socket round trip;
+ * SpawnStaticMeshActors skips JSON entirely for the bulk of a generated scene.
+ * Game thread only.
+ */
+UCLASS()
+class UNREALMCP_API UMCPGeneratorLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Run a registered command in-process; ParamsJson is its params object, the return value its response envelope
+	UFUNCTION(BlueprintCallable, Category = "MCP|Generators")
+	static FString ExecuteCommand(const FString& CommandType, const FString& ParamsJson);
+
+	// Spawn static mesh actors in one call; returns each actor's final name, empty where spawning or attaching to its parent failed
+	UFUNCTION(BlueprintCallable, Category = "MCP|Generators")
+	static TArray<FString> SpawnStaticMeshActors(const TArray<FMCPGeneratorActor>& Actors);
+
+	// Send progress to the client of the running generator; false once it has gone away
+	UFUNCTION(BlueprintCallable, Category = "MCP|Generators")
+	static bool ReportProgress(int32 Done, int32 Total, const FString& Message);
+
+	// Arguments of the running generator as {"generator", "arguments", "script_root", "reload"};
+	// script_root is the editor-configured GeneratorScriptRoot, empty when unset
+	UFUNCTION(BlueprintCallable, Category = "MCP|Generators")
+	static FString GetGeneratorRequest();
+
+	// Hand the generator's result object back to run_generator
+	UFUNCTION(BlueprintCallable, Category = "MCP|Generators")
+	static void SetGeneratorResult(const FString& ResultJson);
+
+	/**
+	 * Run a generator through the editor's Python (the unreal_mcp_generators module shipped in Content/Python)
+	 * @param Request - Handed to the script as GetGeneratorRequest
+	 * @return The generator's result object, or null with OutError
+	 */
+	static TSharedPtr<FJsonObject> RunGenerator(const TSharedPtr<FJsonObject>& Request, FString& OutError);
+};
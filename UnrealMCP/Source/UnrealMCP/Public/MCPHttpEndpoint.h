@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+
+class UEpicUnrealMCPBridge;
+class IHttpRouter;
+struct FHttpServerRequest;
+
+/**
+ * Model Context Protocol endpoint (JSON-RPC 2.0 over streamable HTTP).
+ * Serves POST /mcp from the bridge's command registry, so MCP clients can
+ * call editor commands without going through the Python server. The engine
+ * HTTP server binds to its configured address, so requests from any peer
+ * other than this machine, and browser pages from other origins, are refused.
+ * Requests arrive on the game thread (the engine HTTP server ticks there),
+ * which lets tool calls run their handlers directly.
+ */
+class UNREALMCP_API FMCPHttpEndpoint
+{
+public:
+	explicit FMCPHttpEndpoint(UEpicUnrealMCPBridge* InBridge);
+	~FMCPHttpEndpoint();
+
+	bool Start(uint32 Port);
+	void Stop();
+	bool IsRunning() const { return RouteHandle.IsValid(); }
+
+private:
+	bool HandleRequest(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	// Answer one JSON-RPC message; returns null for notifications
+	TSharedPtr<FJsonObject> HandleMessage(const TSharedPtr<FJsonObject>& Message);
+
+	TSharedPtr<FJsonObject> HandleInitialize(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleToolsList();
+	TSharedPtr<FJsonObject> HandleToolsCall(const TSharedPtr<FJsonObject>& Params, FString& OutError);
+
+	static TSharedPtr<FJsonObject> MakeResult(const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Result);
+	static TSharedPtr<FJsonObject> MakeError(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message);
+
+	UEpicUnrealMCPBridge* Bridge;
+	TSharedPtr<IHttpRouter> Router;
+	FHttpRouteHandle RouteHandle;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "MCPCommandRegistry.h"
+
+class FStructOnScope;
+class FMCPBulkParams;
+struct FMCPPackedArray;
+
+/**
+ * Field map of a USTRUCT used as a command's parameter type, built once per struct.
+ *
+ * Each UPROPERTY becomes one parameter:
+ *  - JSON name is the property name in snake_case (StaticMesh -> "static_mesh",
+ *    bIncludeBounds -> "include_bounds"), or meta MCPName when given
+ *  - meta MCPRequired marks a required parameter
+ *  - meta MCPPresentFlag names a bool property set when an optional parameter was sent
+ *  - the property's doc comment is the schema description
+ * FVector and FRotator properties take [X, Y, Z] arrays like the rest of the API.
+ * FJsonObjectWrapper takes any JSON object and TArray<FJsonObjectWrapper> a list
+ * of them, handed to the handler as parsed.
+ * TArray<FVector> and TArray<FTransform> properties, and TArray<double> or
+ * TArray<float> properties with meta MCPStride (numbers per row), are bulk
+ * NumberArray parameters: the request parser packs them without building a DOM.
+ * Transform rows hold 3, 6 or 9 numbers (location, rotation, scale).
+ */
+class UNREALMCP_API FMCPParamStructInfo
+{
+public:
+	explicit FMCPParamStructInfo(const UScriptStruct* InStruct);
+
+	const UScriptStruct* GetStruct() const { return Struct; }
+
+	// Parameter list in declaration order, for schemas and the request parser
+	const TArray<FMCPParamSpec>& GetParamSpecs() const { return Specs; }
+
+	/**
+	 * Decode Params into a new instance of the struct in one pass over its members.
+	 * Bulk holds the NumberArray fields the request parser packed out of Params, if any.
+	 * Unknown parameters, mistyped values and missing required parameters fail
+	 * with OutError set. Safe to call off the game thread: properties that would
+	 * need UObject lookups while decoding (hard object references, also inside
+	 * nested structs and containers) are left out of the field map when it is built.
+	 */
+	TSharedPtr<FStructOnScope> Decode(const FJsonObject& Params, const FMCPBulkParams* Bulk, FString& OutError) const;
+
+private:
+	struct FField
+	{
+		FString Name;
+		FProperty* Property;
+		EMCPParamType Type;
+		bool bRequired;
+		FBoolProperty* PresentFlag;
+		// Numbers per row of a NumberArray field; 0 for transform rows of 3, 6 or 9
+		int32 Stride;
+	};
+
+	bool DecodeField(const FField& Field, const TSharedPtr<FJsonValue>& Value, void* StructData, FString& OutError) const;
+	bool DecodePackedField(const FField& Field, const FMCPPackedArray& Packed, void* StructData, FString& OutError) const;
+	FString MakeUnknownFieldError(const FString& Name) const;
+
+	const UScriptStruct* Struct;
+	TArray<FField> Fields;
+	TMap<FString, int32> FieldIndices;
+	TArray<FMCPParamSpec> Specs;
+};
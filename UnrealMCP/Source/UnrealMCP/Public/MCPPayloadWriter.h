@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Wire encodings a connection can negotiate for its responses
+ */
+enum class EMCPEncoding : uint8
+{
+	Json,
+	MessagePack
+};
+
+/**
+ * Streaming encoder for response payloads.
+ * Handlers and the actor snapshot describe their output once through this
+ * interface; the connection decides whether it becomes JSON text or MessagePack.
+ * Objects and arrays declare their size up front because MessagePack needs it.
+ */
+class UNREALMCP_API FMCPPayloadWriter
+{
+public:
+	virtual ~FMCPPayloadWriter() = default;
+
+	// Create an empty writer for the given encoding
+	static TUniquePtr<FMCPPayloadWriter> Create(EMCPEncoding Encoding);
+
+	static bool ParseEncoding(const FString& Name, EMCPEncoding& OutEncoding);
+	static const TCHAR* GetEncodingName(EMCPEncoding Encoding);
+
+	virtual EMCPEncoding GetEncoding() const = 0;
+
+	virtual void BeginObject(int32 NumFields) = 0;
+	virtual void EndObject() = 0;
+	virtual void BeginArray(int32 NumItems) = 0;
+	virtual void EndArray() = 0;
+
+	virtual void WriteKey(FStringView Key) = 0;
+	virtual void WriteString(FStringView Value) = 0;
+	virtual void WriteNumber(double Value) = 0;
+	virtual void WriteInteger(int64 Value) = 0;
+	virtual void WriteBool(bool bValue) = 0;
+	virtual void WriteNull() = 0;
+
+	/**
+	 * Create a writer whose output can later be appended to this writer's current array.
+	 * Fragments let array items be encoded on several threads at once.
+	 */
+	virtual TUniquePtr<FMCPPayloadWriter> MakeFragmentWriter() const = 0;
+
+	// Append the items written to a fragment from MakeFragmentWriter
+	virtual void AppendFragment(const FMCPPayloadWriter& Fragment) = 0;
+
+	// Convenience writers
+	void WriteName(FName Value);
+	void WriteVector(double X, double Y, double Z);
+	void WriteJsonValue(const TSharedPtr<FJsonValue>& Value);
+	void WriteJsonObject(const TSharedPtr<FJsonObject>& Object);
+
+	const TArray<uint8>& GetBytes() const { return Bytes; }
+	TArray<uint8>& GetMutableBytes() { return Bytes; }
+
+protected:
+	TArray<uint8> Bytes;
+};
+
+/**
+ * UTF-8 JSON text
+ */
+class UNREALMCP_API FMCPJsonPayloadWriter : public FMCPPayloadWriter
+{
+public:
+	FMCPJsonPayloadWriter();
+
+	virtual EMCPEncoding GetEncoding() const override { return EMCPEncoding::Json; }
+
+	virtual void BeginObject(int32 NumFields) override;
+	virtual void EndObject() override;
+	virtual void BeginArray(int32 NumItems) override;
+	virtual void EndArray() override;
+
+	virtual void WriteKey(FStringView Key) override;
+	virtual void WriteString(FStringView Value) override;
+	virtual void WriteNumber(double Value) override;
+	virtual void WriteInteger(int64 Value) override;
+	virtual void WriteBool(bool bValue) override;
+	virtual void WriteNull() override;
+
+	virtual TUniquePtr<FMCPPayloadWriter> MakeFragmentWriter() const override;
+	virtual void AppendFragment(const FMCPPayloadWriter& Fragment) override;
+
+	// Decode the written text (for callers that still want an FString)
+	FString ToString() const;
+
+private:
+	void BeginValue();
+	void AppendAscii(const ANSICHAR* Text, int32 Len);
+	void AppendQuoted(FStringView Text);
+
+	// One entry per open container: whether a separator is needed before the next item
+	TArray<bool, TInlineAllocator<16>> NeedsSeparator;
+	bool bAfterKey;
+};
+
+/**
+ * MessagePack (https://msgpack.org). Integral numbers use the smallest integer
+ * form and other numbers use float32 whenever that is lossless.
+ */
+class UNREALMCP_API FMCPMessagePackWriter : public FMCPPayloadWriter
+{
+public:
+	virtual EMCPEncoding GetEncoding() const override { return EMCPEncoding::MessagePack; }
+
+	virtual void BeginObject(int32 NumFields) override;
+	virtual void EndObject() override {}
+	virtual void BeginArray(int32 NumItems) override;
+	virtual void EndArray() override {}
+
+	virtual void WriteKey(FStringView Key) override;
+	virtual void WriteString(FStringView Value) override;
+	virtual void WriteNumber(double Value) override;
+	virtual void WriteInteger(int64 Value) override;
+	virtual void WriteBool(bool bValue) override;
+	virtual void WriteNull() override;
+
+	virtual TUniquePtr<FMCPPayloadWriter> MakeFragmentWriter() const override;
+	virtual void AppendFragment(const FMCPPayloadWriter& Fragment) override;
+
+private:
+	void WriteByte(uint8 Value);
+	void WriteBigEndian(uint64 Value, int32 NumBytes);
+	void WriteContainerHeader(int32 Num, uint8 FixBase, int32 FixMax, uint8 Header16, uint8 Header32);
+};
+
+/**
+ * Destination for the frames of one response.
+ * Implemented per connection so the same command code can answer in any
+ * negotiated encoding and framing.
+ */
+class UNREALMCP_API IMCPResponseSink
+{
+public:
+	virtual ~IMCPResponseSink() = default;
+
+	// Empty writer in the connection's encoding for one frame
+	virtual TUniquePtr<FMCPPayloadWriter> MakeWriter() = 0;
+
+	// Send a completed frame; returns false once the client has gone away
+	virtual bool SendFrame(const FMCPPayloadWriter& Writer) = 0;
+};
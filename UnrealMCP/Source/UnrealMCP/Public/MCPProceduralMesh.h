@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "JsonObjectWrapper.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+
+namespace UE::Geometry
+{
+	class FDynamicMesh3;
+}
+
+/**
+ * Procedural solids built on the CPU as one dynamic mesh and baked into a static mesh asset.
+ *
+ * Shapes are described as JSON objects:
+ *   {"type": "box", "size": [X, Y, Z]}
+ *   {"type": "cylinder", "radius": R, "height": H, "segments": N}
+ *   {"type": "pyramid", "size": [X, Y, Height], "steps": N}           (steps 0 for smooth sides)
+ *   {"type": "stairs", "steps": N, "step_width": W, "step_height": H, "step_depth": D}
+ *   {"type": "arch", "span": S, "thickness": T, "depth": D, "leg_height": L, "segments": N}
+ * each with optional "location", "rotation", "scale" and "operation" ("union", "subtract" or "append").
+ * Every shape is closed, sits on Z = 0 and is centered on its footprint in its own frame, with
+ * stairs rising towards +X and arches spanning X. Faces get hard normals (smooth around
+ * cylinders and arches) and box-projected UVs at one tile per metre.
+ * Game thread only for baking.
+ */
+class UNREALMCP_API FMCPProceduralMesh
+{
+public:
+	enum class ECollision : uint8
+	{
+		None,
+		// One box around the whole mesh
+		Box,
+		// The render triangles, exact for arches and stairs
+		Complex
+	};
+
+	// Build and combine the shapes in order; false with OutError on a malformed shape or a failed boolean
+	static bool BuildFromJson(const TArray<FJsonObjectWrapper>& Shapes, UE::Geometry::FDynamicMesh3& OutMesh, FString& OutError);
+
+	/**
+	 * Write the mesh into the static mesh asset at AssetPath (a long package name, e.g. /Game/Generated/SM_Arch)
+	 * @param bOverwrite - Rebuild an existing static mesh in place, keeping references to it; otherwise an existing asset is an error
+	 * @param bOutCreated - Whether a new asset was created
+	 * @return The asset, or null with OutError
+	 */
+	static UStaticMesh* BakeToStaticMesh(const UE::Geometry::FDynamicMesh3& Mesh, const FString& AssetPath, UMaterialInterface* Material,
+		ECollision Collision, bool bOverwrite, bool& bOutCreated, FString& OutError);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Json.h"
+
+/**
+ * Progress of a long-running command, reported by its handler on the game thread
+ * and sent to the client by the worker thread waiting for the result.
+ * Only the latest report is kept, so a handler may report as often as it likes;
+ * the waiting thread sends whatever is newest each time it wakes up.
+ */
+class UNREALMCP_API FMCPProgressChannel
+{
+public:
+	/**
+	 * Report progress of the command running on the game thread (game thread)
+	 * @param Total - 0 when the amount of work is not known up front
+	 * @return False once the client has gone away, so the handler can stop early
+	 */
+	static bool Report(int32 Done, int32 Total, const FString& Message);
+
+	// Take the newest report as a {"stream":"progress",...} frame object, if there is one since the last call (any thread)
+	TSharedPtr<FJsonObject> TakeReport();
+
+	// Tell the handler to stop at its next report (any thread)
+	void Cancel() { bCancelled = true; }
+
+	/** Routes Report to a channel while a command's handler runs (game thread) */
+	class UNREALMCP_API FScope
+	{
+	public:
+		explicit FScope(FMCPProgressChannel* Channel);
+		~FScope();
+
+	private:
+		FMCPProgressChannel* Previous;
+	};
+
+private:
+	FCriticalSection Lock;
+	int32 Done = 0;
+	int32 Total = 0;
+	FString Message;
+	bool bPending = false;
+	TAtomic<bool> bCancelled { false };
+
+	static FMCPProgressChannel* Current;
+};
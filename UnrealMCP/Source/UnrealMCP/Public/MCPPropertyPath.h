@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+
+/**
+ * Dotted property paths on UObjects, e.g. "StaticMeshComponent.BodyInstance.bSimulatePhysics",
+ * "Tags[0]" or "RootComponent.RelativeScale3D".
+ *
+ * Segments walk nested structs, array elements ([Index]) and object references;
+ * past an object reference the rest of the path is resolved against that object's
+ * runtime class. Each (class, path) pair is compiled into a property chain once and
+ * cached, so applying one path to many objects costs one lookup per object.
+ * On a Blueprint's class default object, component segments resolve to the
+ * component templates of its construction script; components inherited from a
+ * parent Blueprint resolve to this Blueprint's overrides of them.
+ * Game thread only. The cache is flushed whenever a Blueprint is compiled.
+ */
+class UNREALMCP_API FMCPPropertyPath
+{
+public:
+	struct FResolved
+	{
+		// Object that directly contains the leaf (the last object reached along the path)
+		UObject* Owner = nullptr;
+		// Property of Owner the path goes through, for edit change notifications
+		FProperty* OwnerProperty = nullptr;
+		FProperty* Property = nullptr;
+		void* ValuePtr = nullptr;
+		// Blueprint that gained an inherited component override while resolving for an edit
+		UBlueprint* OverridingBlueprint = nullptr;
+	};
+
+	// With bForEdit, inherited component templates are overridden in the Blueprint instead of read from its parent
+	static bool Resolve(UObject* Object, const FString& Path, FResolved& OutResolved, FString& OutError, bool bForEdit = false);
+
+	static bool GetValue(UObject* Object, const FString& Path, TSharedPtr<FJsonValue>& OutValue, FString& OutError);
+
+	// Set a value; with bNotify the owner gets Modify/PreEditChange/PostEditChangeProperty around the write.
+	// A value that fails to import leaves the property and its owner untouched
+	static bool SetValue(UObject* Object, const FString& Path, const TSharedPtr<FJsonValue>& Value, FString& OutError, bool bNotify = true);
+
+	/**
+	 * Convert between JSON and a property value. Vectors and rotators use [X, Y, Z]
+	 * arrays; enums accept names (optionally qualified), numbers and numeric strings.
+	 */
+	static bool ImportJsonValue(FProperty* Property, void* ValuePtr, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+	static TSharedPtr<FJsonValue> ExportJsonValue(FProperty* Property, const void* ValuePtr);
+
+	static void FlushCache();
+};
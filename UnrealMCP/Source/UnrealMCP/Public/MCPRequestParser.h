@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class FMCPCommandRegistry;
+
+/**
+ * Numbers from one bulk parameter, packed row by row.
+ * [[x,y,z],[x,y,z]] has Stride 3; a flat [a,b,c] has Stride 1.
+ */
+struct FMCPPackedArray
+{
+	TArray<double> Values;
+	int32 Stride = 1;
+
+	int32 NumRows() const { return Stride > 0 ? Values.Num() / Stride : 0; }
+};
+
+/**
+ * Bulk parameters decoded straight from the request text instead of into the
+ * params DOM. Only fields a command registers as EMCPParamType::NumberArray are
+ * packed; typed commands decode them into their param struct, and helpers in
+ * FEpicUnrealMCPCommonUtils look here before the DOM.
+ */
+class UNREALMCP_API FMCPBulkParams
+{
+public:
+	explicit FMCPBulkParams(const TSharedPtr<FJsonObject>& InParams) : Params(InParams.Get()) {}
+
+	TMap<FString, FMCPPackedArray> Fields;
+
+	// Packed field of the command currently running on the game thread, if Params is that command's params object
+	static const FMCPPackedArray* FindCurrent(const TSharedPtr<FJsonObject>& Params, const FString& FieldName);
+
+	/** Makes a request's bulk fields visible to FindCurrent while its handler runs (game thread) */
+	class UNREALMCP_API FScope
+	{
+	public:
+		explicit FScope(const FMCPBulkParams* Bulk);
+		~FScope();
+
+	private:
+		const FMCPBulkParams* Previous;
+	};
+
+private:
+	// Params object the packed fields were taken from
+	const FJsonObject* Params;
+
+	static const FMCPBulkParams* Current;
+};
+
+/**
+ * A request envelope parsed by FMCPRequestParser
+ */
+struct FMCPParsedRequest
+{
+	FString CommandType;
+
+	// Top-level fields other than type and params ("stream", "stream_chunk_size", ...)
+	TSharedPtr<FJsonObject> Envelope;
+	TSharedPtr<FJsonObject> Params;
+
+	// Null when the request carried no packed fields
+	TSharedPtr<FMCPBulkParams> Bulk;
+};
+
+/**
+ * Token-streaming parser for request envelopes.
+ * Walks the JSON once with TJsonReader; small control fields are built into
+ * a DOM as before, while registered bulk fields are decoded directly into
+ * packed number arrays, so a 50k-row transform list never becomes hundreds of
+ * thousands of FJsonValue nodes.
+ * Packing needs the command type to appear before "params", which is how all
+ * clients in this repo write requests; otherwise everything goes into the DOM.
+ */
+class UNREALMCP_API FMCPRequestParser
+{
+public:
+	static bool Parse(const FString& Message, const FMCPCommandRegistry& Registry, FMCPParsedRequest& OutRequest, FString& OutError);
+};
@@ -2,13 +2,79 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Sockets.h"
 #include "Interfaces/IPv4/IPv4Address.h"
+#include "MCPPayloadWriter.h"
 
 class UEpicUnrealMCPBridge;
+class FQueuedThreadPool;
 
 /**
- * Runnable class for the MCP server thread
+ * Flags byte that follows the length in a length-prefixed response frame
+ */
+namespace EMCPFrameFlags
+{
+	enum Type : uint8
+	{
+		None = 0x00,
+		// Payload is MessagePack rather than UTF-8 JSON
+		MessagePack = 0x01,
+		// Payload is compressed; it starts with the 4-byte big-endian uncompressed size
+		Zlib = 0x02,
+		LZ4 = 0x04
+	};
+}
+
+/**
+ * Per-connection wire options, changed by the "negotiate" command.
+ * The defaults keep the original protocol: bare JSON text per response.
+ */
+struct FMCPConnectionOptions
+{
+	EMCPEncoding Encoding = EMCPEncoding::Json;
+
+	// Frame responses as a 4-byte big-endian length, a flags byte and the payload
+	bool bLengthPrefixed = false;
+
+	// NAME_Zlib or NAME_LZ4 to compress large frames; NAME_None sends everything as is
+	FName CompressionFormat = NAME_None;
+
+	// Payloads smaller than this are never compressed
+	int32 CompressionThreshold = 0;
+};
+
+/**
+ * Splits a TCP byte stream into complete top-level JSON objects.
+ * Clients may send messages back to back, split across reads, or
+ * separated by newlines.
+ */
+class FMCPMessageFramer
+{
+public:
+	void Append(const uint8* Data, int32 Num);
+
+	// Pop the next complete message, if one has been received
+	bool Next(FString& OutMessage);
+
+	int32 GetBufferedSize() const { return Buffer.Num(); }
+
+private:
+	TArray<uint8> Buffer;
+	int32 ScanPos = 0;
+	int32 MessageStart = INDEX_NONE;
+	int32 Depth = 0;
+	bool bInString = false;
+	bool bEscaped = false;
+};
+
+/**
+ * Runnable class for the MCP server thread.
+ * Accepts clients and hands each connection to a worker pool, where
+ * requests are parsed and responses serialized, so the game thread only
+ * runs the command handlers themselves. Clients beyond the pool size are
+ * refused with a busy error, and silent connections are closed.
  */
 class FMCPServerRunnable : public FRunnable
 {
@@ -22,13 +88,28 @@ public:
 	virtual void Stop() override;
 	virtual void Exit() override;
 
+	// Frame and send one encoded payload according to the connection's options (worker thread)
+	bool SendFrame(TSharedPtr<FSocket> Client, const FMCPConnectionOptions& Options, const TArray<uint8>& Payload, bool bNewlineDelimited);
+
 protected:
+	// Serve one client until it disconnects (worker thread)
 	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	// Parse and execute one request and send its response (worker thread)
+	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message, FMCPConnectionOptions& Options);
+	// Switch the connection's encoding and framing; the reply still uses the old ones
+	void HandleNegotiate(TSharedPtr<FSocket> Client, const TSharedPtr<FJsonObject>& Params, FMCPConnectionOptions& Options);
+
+	void SendError(TSharedPtr<FSocket> Client, const FMCPConnectionOptions& Options, const FString& ErrorMessage);
+	bool SendBytes(TSharedPtr<FSocket> Client, const uint8* Data, int32 Num);
+
+	// Compress a frame payload behind its uncompressed size; false if it did not shrink
+	static bool CompressPayload(FName Format, const TArray<uint8>& Payload, TArray<uint8>& OutCompressed);
 
 private:
 	UEpicUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
\ No newline at end of file
+	FQueuedThreadPool* WorkerPool;
+	// Connections currently held by a worker
+	FThreadSafeCounter ActiveConnections;
+	FThreadSafeBool bRunning;
+};
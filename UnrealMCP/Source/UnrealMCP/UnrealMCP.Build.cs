@@ -38,6 +38,7 @@ public class UnrealMCP : ModuleRules
 				"Networking",
 				"Sockets",
 				"HTTP",
+				"HTTPServer",         // For the MCP JSON-RPC endpoint
 				"Json",
 				"JsonUtilities",
 				"DeveloperSettings",
@@ -58,7 +59,14 @@ public class UnrealMCP : ModuleRules
 				"SlateCore",
 				"Kismet",
 				"Projects",
-				"AssetRegistry"
+				"AssetRegistry",
+				"GeometryCore",          // For generate_mesh
+				"DynamicMesh",
+				"MeshConversion",
+				"MeshDescription",
+				"StaticMeshDescription",
+				"PythonScriptPlugin",    // For run_generator
+				"PCG"                    // For execute_pcg_graph
 			}
 		);
 		